@@ -2381,6 +2381,124 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_backward_desc_init(
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_layer_normalization_v2
+/// @{
+
+/// Initializes a descriptor for layer normalization v2 forward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_v2_forward_desc_init(
+        dnnl_layer_normalization_v2_desc_t *lnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
+
+/// Initializes a descriptor for a layer normalization v2 backward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the diff_dst can refer to the same
+///     memory as the diff_src.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_backward_data and #dnnl_backward (diffs for all parameters are
+///     computed in this case).
+/// @param diff_src_desc Diff source memory descriptor.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param src_desc Source memory descriptor.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_v2_backward_desc_init(
+        dnnl_layer_normalization_v2_desc_t *lnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc,
+        const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// Initializes a descriptor for group normalization forward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param groups Number of groups the channels are split into. Must divide
+///     the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_forward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *dst_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags);
+
+/// Initializes a descriptor for a group normalization backward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the diff_dst can refer to the same
+///     memory as the diff_src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_backward_data and #dnnl_backward (diffs for all parameters are
+///     computed in this case).
+/// @param diff_src_desc Diff source memory descriptor.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param src_desc Source memory descriptor.
+/// @param groups Number of groups the channels are split into. Must divide
+///     the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_backward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc,
+        const dnnl_memory_desc_t *src_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags);
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -2647,7 +2765,7 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_rnn_weights_projection_qparams(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @param alpha Negative slope if activation is #dnnl_eltwise_relu.
 /// @param beta Unused.
 /// @returns #dnnl_success on success and a status describing the error
@@ -2708,7 +2826,7 @@ dnnl_status_t DNNL_API dnnl_vanilla_rnn_forward_desc_init(
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @param alpha Negative slope if activation is #dnnl_eltwise_relu.
 /// @param beta Unused.
 /// @returns #dnnl_success on success and a status describing the error
@@ -2772,7 +2890,7 @@ dnnl_status_t DNNL_API dnnl_vanilla_rnn_backward_desc_init(
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -2829,7 +2947,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
@@ -2891,7 +3009,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
@@ -2965,7 +3083,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3050,7 +3168,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v2(
@@ -3146,7 +3264,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v2(
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v3(
@@ -3206,7 +3324,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v3(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3261,7 +3379,7 @@ dnnl_status_t DNNL_API dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_gru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3308,7 +3426,7 @@ dnnl_status_t DNNL_API dnnl_gru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3363,7 +3481,7 @@ dnnl_status_t DNNL_API dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_gru_backward_desc_init(
@@ -3416,7 +3534,7 @@ dnnl_status_t DNNL_API dnnl_lbr_gru_backward_desc_init(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3474,7 +3592,7 @@ dnnl_status_t DNNL_API dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_augru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3524,7 +3642,7 @@ dnnl_status_t DNNL_API dnnl_augru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_augru_forward_desc_init(
@@ -3583,7 +3701,7 @@ dnnl_status_t DNNL_API dnnl_lbr_augru_forward_desc_init(
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags RNN cell flags (@ref dnnl_rnn_flags_t).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_augru_backward_desc_init(
@@ -3702,6 +3820,37 @@ dnnl_status_t DNNL_API dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+/// @{
+
+/// Initializes a descriptor for a scaled dot-product attention primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param desc Output descriptor for a scaled dot-product attention
+///     primitive.
+/// @param prop_kind Propagation kind. Possible values:
+///     #dnnl_forward_inference.
+/// @param q_desc Queries memory descriptor.
+/// @param k_desc Keys memory descriptor.
+/// @param v_desc Values memory descriptor.
+/// @param mask_desc Attention mask memory descriptor. Passing NULL or a zero
+///     memory descriptor disables the mask.
+/// @param dst_desc Destination memory descriptor.
+/// @param scale Scale applied to the scores.
+/// @param flags Scaled dot-product attention flags (@ref dnnl_sdpa_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sdpa_desc_init(dnnl_sdpa_desc_t *desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *q_desc,
+        const dnnl_memory_desc_t *k_desc, const dnnl_memory_desc_t *v_desc,
+        const dnnl_memory_desc_t *mask_desc,
+        const dnnl_memory_desc_t *dst_desc, float scale, unsigned flags);
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -3740,6 +3889,41 @@ dnnl_status_t DNNL_API dnnl_engine_get_kind(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_engine_destroy(dnnl_engine_t engine);
 
+/// Returns the number of NUMA nodes a CPU engine can be bound to.
+///
+/// @returns Count of the NUMA nodes, or 0 if the CPU runtime does not
+///     support binding engines to NUMA nodes.
+size_t DNNL_API dnnl_cpu_engine_get_numa_node_count(void);
+
+/// Creates a CPU engine bound to a NUMA node.
+///
+/// The primitives executed on streams of the engine run on the CPUs of the
+/// node that belong to the process affinity mask, and the memory objects and
+/// scratchpads that the engine allocates are placed in the memory of the
+/// node. Primitives are not shared with engines bound to other nodes.
+///
+/// @note
+///     Only the threads of the OpenMP runtime are bound. The threads of the
+///     TBB and threadpool runtimes keep their affinity.
+///
+/// @param engine Output engine.
+/// @param numa_node NUMA node index that should be between 0 and the count
+///     of NUMA nodes returned by dnnl_cpu_engine_get_numa_node_count().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_create_on_numa_node(
+        dnnl_engine_t *engine, int numa_node);
+
+/// Returns the NUMA node a CPU engine is bound to.
+///
+/// @param engine CPU engine to query.
+/// @param numa_node Output NUMA node index, or -1 if the engine is not bound
+///     to a NUMA node.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_get_numa_node(
+        dnnl_engine_t engine, int *numa_node);
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream
@@ -3778,6 +3962,127 @@ dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_destroy(dnnl_stream_t stream);
 
+/// Enables or disables the execution profiling of a stream.
+///
+/// When enabled, the executions of primitives in the stream and the phases
+/// of their implementations are recorded in a ring buffer holding up to
+/// @p capacity records: once the buffer is full, the oldest records are
+/// overwritten. The stream is synchronized before and after every profiled
+/// primitive and phase to take the timestamps, so the execution becomes
+/// blocking. The previous records are dropped.
+///
+/// @param stream Execution stream.
+/// @param capacity Number of records to keep, or 0 to disable the
+///     profiling.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_profiling_capacity(
+        dnnl_stream_t stream, int capacity);
+
+/// Returns the number of profiling records held by a stream.
+///
+/// @param stream Execution stream.
+/// @param count Output number of records.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_profiling_records_count(
+        const_dnnl_stream_t stream, int *count);
+
+/// Returns a profiling record of a stream.
+///
+/// The records are ordered by their end timestamps, hence the phases of an
+/// implementation precede the record of the execution of the primitive. The
+/// strings of the record are valid until the record is overwritten or the
+/// profiling of the stream is reset or disabled.
+///
+/// @param stream Execution stream.
+/// @param index Index of the record, from 0 for the oldest one to the number
+///     of records minus one.
+/// @param record Output record.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_profiling_record(
+        const_dnnl_stream_t stream, int index, dnnl_profiling_record_t *record);
+
+/// Drops the profiling records of a stream.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_reset_profiling(dnnl_stream_t stream);
+
+/// Returns the profiling records of a stream in the JSON trace event format
+/// that can be loaded by Chrome tracing (chrome://tracing) or Perfetto.
+///
+/// @param stream Execution stream.
+/// @param size Size of the trace in bytes including the terminating null
+///     character. If @p trace is NULL, the size is returned; otherwise, it is
+///     the size of the buffer pointed to by @p trace.
+/// @param trace Output trace. If NULL, only the size is queried.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_get_profiling_trace(
+        const_dnnl_stream_t stream, size_t *size, char *trace);
+
+/// Starts capturing the executions of primitives in a stream.
+///
+/// Until the capture is ended with dnnl_stream_end_capture(), the primitives
+/// executed in the stream are not run but recorded with their arguments. The
+/// arguments are checked when the executions are recorded.
+///
+/// @param stream Execution stream.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, e.g. #dnnl_invalid_arguments if the stream is already
+///     capturing.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Ends capturing the executions of primitives in a stream and returns them
+/// as an execution graph.
+///
+/// The graph retains its primitives but references the memory objects passed
+/// as arguments, which must stay alive while the graph is replayed. The graph
+/// must be destroyed before the stream.
+///
+/// @param stream Execution stream.
+/// @param graph Output execution graph.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise, e.g. #dnnl_invalid_arguments if the stream is not
+///     capturing.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(
+        dnnl_stream_t stream, dnnl_exec_graph_t *graph);
+
+/// Replays an execution graph in the stream on which it was captured.
+///
+/// The primitives are executed in the order of their capture with the
+/// arguments they were captured with, without converting nor checking the
+/// arguments again. To run the graph on other data, change the data handles
+/// of the captured memory objects (e.g. with dnnl_memory_set_data_handle())
+/// between the replays. A graph must not be replayed concurrently from
+/// several threads.
+///
+/// @param stream Execution stream.
+/// @param graph Execution graph.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_replay(
+        dnnl_stream_t stream, dnnl_exec_graph_t graph);
+
+/// Returns the number of primitive executions of an execution graph.
+///
+/// @param graph Execution graph.
+/// @param size Output number of executions.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_exec_graph_get_size(
+        const_dnnl_exec_graph_t graph, int *size);
+
+/// Destroys an execution graph.
+///
+/// @param graph Execution graph to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_exec_graph_destroy(dnnl_exec_graph_t graph);
+
 /// @} dnnl_api_stream
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3806,8 +4111,101 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the total resident size in bytes of the primitives that can be
+/// held in the primitive cache at the same time.
+///
+/// @param capacity_bytes Primitive cache byte budget to query. A value of 0
+///     means that the cache is limited only by the number of entries.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity_bytes value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity_bytes(
+        size_t *capacity_bytes);
+
+/// Sets the total resident size in bytes of the primitives that can be held
+/// in the primitive cache at a time.
+///
+/// The byte budget is applied on top of the capacity in entries: the least
+/// recently used primitives are evicted until both limits are met. The
+/// resident size of a primitive is an estimate: it accounts for the code
+/// generated for it on the host, the kernel binaries of GPU primitives, and
+/// the descriptors and lookup tables kept by the implementations that
+/// precompute them. Scratchpad memory is not accounted for.
+///
+/// @param capacity_bytes Primitive cache byte budget to set. A value of 0
+///     removes the byte budget. If the primitives the cache already has
+///     exceed the new budget then the excess entries will be evicted.
+///     Concurrently modifying @p capacity_bytes is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity_bytes(
+        size_t capacity_bytes);
+
+/// Returns the primitive cache statistics accumulated since the library was
+/// loaded or since the last reset.
+///
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats);
+
+/// Resets the hits, misses, evictions and creation time counters of the
+/// primitive cache statistics. The number of entries and resident bytes
+/// reflect the cache content and are not affected.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_primitive_cache_stats();
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool
+/// @{
+
+/// Returns the total size in bytes of the scratchpad buffers that the
+/// library can retain for reuse.
+///
+/// @param capacity_bytes Scratchpad pool capacity to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity_bytes value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_pool_capacity_bytes(
+        size_t *capacity_bytes);
+
+/// Sets the total size in bytes of the scratchpad buffers that the library
+/// can retain for reuse.
+///
+/// The buffers of the library managed scratchpads are taken from a pool
+/// that belongs to the engine. When a primitive is destroyed its scratchpad
+/// buffer is returned to the pool unless the pools already retain
+/// @p capacity_bytes bytes. The default capacity is 64 MB and can be
+/// changed with the ONEDNN_SCRATCHPAD_POOL_CAPACITY_MB environment variable.
+///
+/// @param capacity_bytes Scratchpad pool capacity to set. A value of 0
+///     disables retaining the buffers. If the pools already retain more than
+///     the new capacity then the excess buffers are freed. Concurrently
+///     modifying @p capacity_bytes is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_scratchpad_pool_capacity_bytes(
+        size_t capacity_bytes);
+
+/// Returns the scratchpad pool statistics accumulated over all the engines.
+///
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_pool_stats(
+        dnnl_scratchpad_pool_stats_t *stats);
+
+/// Resets the hits and misses counters of the scratchpad pool statistics,
+/// and sets the peak to the current total size of the buffers.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_scratchpad_pool_stats();
+
+/// @} dnnl_api_scratchpad_pool
+
 /// @addtogroup dnnl_api_mathmode Floating-point Math Mode
 /// @{
 
@@ -3922,6 +4320,28 @@ dnnl_status_t DNNL_API dnnl_set_jit_profiling_flags(unsigned flags);
 /// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on Windows.
 dnnl_status_t DNNL_API dnnl_set_jit_profiling_jitdumpdir(const char *dir);
 
+/// Sets a directory for the JIT cache. When the directory is set, CPU
+/// primitives created for the first time store binaries of their JIT kernels
+/// in the directory, and subsequent creations of the same primitives, in the
+/// same or another process, restore the kernels from there instead of
+/// generating them again.
+///
+/// @sa @ref dev_guide_persistent_cache
+///
+/// @note
+///     This setting overrides ONEDNN_JIT_CACHE_DIR environment variable. The
+///     JIT cache is disabled by default. Passing NULL or an empty string
+///     disables it.
+///
+/// @note
+///     The directory must exist. Errors accessing the directory are ignored
+///     and the kernels are generated as usual.
+///
+/// @param dir JIT cache directory path.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_set_jit_cache_dir(const char *dir);
+
 /// Sets the maximal ISA the library can dispatch to on the CPU. See
 /// #dnnl_cpu_isa_t and #dnnl::cpu_isa for the list of the values accepted by
 /// the C and C++ API functions respectively.
@@ -4182,6 +4602,231 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single-precision matrix-matrix multiplies of the same
+/// shape with matrices placed at a constant stride from each other.
+///
+/// The operation is defined as:
+///
+/// `C_i := alpha * op( A_i ) * op( B_i ) + beta * C_i`
+///
+/// where `A_i = A + i * stride_a`, `B_i = B + i * stride_b` and
+/// `C_i = C + i * stride_c` for `i` from `0` to `batch_size - 1`. Refer to
+/// #dnnl_sgemm() for the meaning of the other parameters.
+///
+/// The whole batch is computed in a single parallel region: the threads
+/// compute separate problems unless the problems are few and large enough
+/// to be computed one after another by all the threads.
+///
+/// @param transa Transposition flag for the matrices A.
+/// @param transb Transposition flag for the matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance between two A matrices, in elements.
+/// @param B A pointer to the first B matrix.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance between two B matrices, in elements.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance between two C matrices, in elements.
+/// @param batch_size The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a group of independent single-precision matrix-matrix
+/// multiplies, each with its own parameters.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha[i] * op( A[i] ) * op( B[i] ) + beta[i] * C[i]`
+///
+/// for `i` from `0` to `count - 1`, where each of the array parameters holds
+/// the parameter of #dnnl_sgemm() for every problem. The whole group is
+/// computed in a single parallel region with the problems distributed
+/// across the threads according to their sizes.
+///
+/// The parameters are validated before any problem is computed.
+///
+/// @param count The number of matrix-matrix multiplies.
+/// @param transa The transposition flags for the matrices A.
+/// @param transb The transposition flags for the matrices B.
+/// @param M The M dimensions.
+/// @param N The N dimensions.
+/// @param K The K dimensions.
+/// @param alpha The alpha parameters.
+/// @param A Pointers to the A matrices.
+/// @param lda The leading dimensions for the matrices A.
+/// @param B Pointers to the B matrices.
+/// @param ldb The leading dimensions for the matrices B.
+/// @param beta The beta parameters.
+/// @param C Pointers to the C matrices.
+/// @param ldc The leading dimensions for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_grouped(dnnl_dim_t count, const char *transa,
+        const char *transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        const float *beta, float *const *C, const dnnl_dim_t *ldc);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B and 32-bit signed resulting matrices
+/// C of the same shape placed at a constant stride from each other.
+///
+/// Refer to #dnnl_gemm_u8s8s32() for the operation and to
+/// #dnnl_sgemm_batch_strided() for the batch parameters. The offsets @p ao,
+/// @p bo and @p co are the same for all the problems.
+///
+/// @param transa Transposition flag for the matrices A.
+/// @param transb Transposition flag for the matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to the
+///     matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance between two A matrices, in elements.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance between two B matrices, in elements.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance between two C matrices, in elements.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs a group of independent integer matrix-matrix multiplies on 8-bit
+/// unsigned matrices A, 8-bit signed matrices B and 32-bit signed resulting
+/// matrices C, each with its own parameters.
+///
+/// Refer to #dnnl_gemm_u8s8s32() for the operation and to
+/// #dnnl_sgemm_grouped() for the group parameters.
+///
+/// @param count The number of matrix-matrix multiplies.
+/// @param transa The transposition flags for the matrices A.
+/// @param transb The transposition flags for the matrices B.
+/// @param offsetc The flags specifying how offsets should be applied to the
+///     matrices C.
+/// @param M The M dimensions.
+/// @param N The N dimensions.
+/// @param K The K dimensions.
+/// @param alpha The alpha parameters.
+/// @param A Pointers to the A matrices.
+/// @param lda The leading dimensions for the matrices A.
+/// @param ao The offset values for the matrices A.
+/// @param B Pointers to the B matrices.
+/// @param ldb The leading dimensions for the matrices B.
+/// @param bo The offset values for the matrices B.
+/// @param beta The beta parameters.
+/// @param C Pointers to the C matrices.
+/// @param ldc The leading dimensions for the matrices C.
+/// @param co Pointers to the arrays of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_grouped(dnnl_dim_t count,
+        const char *transa, const char *transb, const char *offsetc,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const uint8_t *const *A, const dnnl_dim_t *lda,
+        const uint8_t *ao, const int8_t *const *B, const dnnl_dim_t *ldb,
+        const int8_t *bo, const float *beta, int32_t *const *C,
+        const dnnl_dim_t *ldc, const int32_t *const *co);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B and 32-bit signed resulting matrices
+/// C of the same shape placed at a constant stride from each other.
+///
+/// Refer to #dnnl_gemm_s8s8s32() for the operation and to
+/// #dnnl_gemm_u8s8s32_batch_strided() for the parameters.
+///
+/// @param transa Transposition flag for the matrices A.
+/// @param transb Transposition flag for the matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to the
+///     matrices C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance between two A matrices, in elements.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance between two B matrices, in elements.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance between two C matrices, in elements.
+/// @param co An array of offset values for the matrices C.
+/// @param batch_size The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs a group of independent integer matrix-matrix multiplies on 8-bit
+/// signed matrices A, 8-bit signed matrices B and 32-bit signed resulting
+/// matrices C, each with its own parameters.
+///
+/// Refer to #dnnl_gemm_s8s8s32() for the operation and to
+/// #dnnl_gemm_u8s8s32_grouped() for the parameters.
+///
+/// @param count The number of matrix-matrix multiplies.
+/// @param transa The transposition flags for the matrices A.
+/// @param transb The transposition flags for the matrices B.
+/// @param offsetc The flags specifying how offsets should be applied to the
+///     matrices C.
+/// @param M The M dimensions.
+/// @param N The N dimensions.
+/// @param K The K dimensions.
+/// @param alpha The alpha parameters.
+/// @param A Pointers to the A matrices.
+/// @param lda The leading dimensions for the matrices A.
+/// @param ao The offset values for the matrices A.
+/// @param B Pointers to the B matrices.
+/// @param ldb The leading dimensions for the matrices B.
+/// @param bo The offset values for the matrices B.
+/// @param beta The beta parameters.
+/// @param C Pointers to the C matrices.
+/// @param ldc The leading dimensions for the matrices C.
+/// @param co Pointers to the arrays of offset values for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_grouped(dnnl_dim_t count,
+        const char *transa, const char *transb, const char *offsetc,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const int8_t *const *A, const dnnl_dim_t *lda,
+        const int8_t *ao, const int8_t *const *B, const dnnl_dim_t *ldb,
+        const int8_t *bo, const float *beta, int32_t *const *C,
+        const dnnl_dim_t *ldc, const int32_t *const *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
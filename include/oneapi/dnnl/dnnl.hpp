@@ -315,6 +315,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         prelu = dnnl_prelu,
         /// A softmax version 2 primitive.
         softmax_v2 = dnnl_softmax_v2,
+        /// A layer normalization version 2 primitive.
+        layer_normalization_v2 = dnnl_layer_normalization_v2,
+        /// A scaled dot-product attention primitive.
+        sdpa = dnnl_sdpa,
+        /// A group normalization primitive.
+        group_normalization = dnnl_group_normalization,
     };
 
     using handle::handle;
@@ -753,7 +759,11 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
 /// RNN cell flags.
 enum class rnn_flags : unsigned {
     /// Undefined RNN flags
-    undef = dnnl_rnn_flags_undef
+    undef = dnnl_rnn_flags_undef,
+    /// The primitive takes the length of the sequence of each batch element
+    /// as an extra #DNNL_ARG_SEQ_LENGTHS input. Supported for
+    /// #dnnl::prop_kind::forward_inference only.
+    seq_lengths = dnnl_rnn_flags_seq_lengths,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -829,6 +839,31 @@ inline dnnl_rnn_direction_t convert_to_c(rnn_direction dir) {
 
 /// @} dnnl_api_rnn
 
+/// @addtogroup dnnl_api_sdpa
+/// @{
+
+/// Scaled dot-product attention flags.
+enum class sdpa_flags : unsigned {
+    /// Default flags.
+    none = dnnl_sdpa_flags_none,
+    /// Causal attention: a query attends only to the keys that are not
+    /// after it in the sequence.
+    causal = dnnl_sdpa_causal,
+};
+
+/// Converts scaled dot-product attention flags enum value from C++ API to C
+/// API type.
+/// @param flags C++ API scaled dot-product attention flags enum value.
+/// @returns Corresponding C API scaled dot-product attention flags enum
+///     value.
+inline dnnl_sdpa_flags_t convert_to_c(sdpa_flags flags) {
+    return static_cast<dnnl_sdpa_flags_t>(flags);
+}
+
+DNNL_DEFINE_BITMASK_OPS(sdpa_flags)
+
+/// @} dnnl_api_sdpa
+
 /// @addtogroup dnnl_api_primitives_common
 /// @{
 
@@ -881,6 +916,9 @@ enum class query {
     /// cache blob ID (pointer to array)
     cache_blob_id = dnnl_query_cache_blob_id,
 
+    /// whether a source may be placed in the destination memory
+    src_inplace_s32 = dnnl_query_src_inplace_s32,
+
     /// operation descriptor
     op_d = dnnl_query_op_d,
     /// convolution descriptor
@@ -915,6 +953,12 @@ enum class query {
     resampling_d = dnnl_query_resampling_d,
     /// reduction descriptor
     reduction_d = dnnl_query_reduction_d,
+    /// layer normalization version 2 descriptor
+    layer_normalization_v2_d = dnnl_query_layer_normalization_v2_d,
+    /// scaled dot-product attention descriptor
+    sdpa_d = dnnl_query_sdpa_d,
+    /// group normalization descriptor
+    group_normalization_d = dnnl_query_group_normalization_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -1009,6 +1053,31 @@ struct engine : public handle<dnnl_engine_t> {
         reset(engine);
     }
 
+    /// Returns the number of NUMA nodes a CPU engine can be bound to.
+    ///
+    /// @returns The number of NUMA nodes, or 0 if the CPU runtime does not
+    ///     support binding engines to NUMA nodes.
+    static size_t get_numa_node_count() {
+        return dnnl_cpu_engine_get_numa_node_count();
+    }
+
+    /// Constructs a CPU engine bound to a NUMA node.
+    ///
+    /// The primitives executed on streams of the engine run on the CPUs of
+    /// the node, and the memory objects and scratchpads that the engine
+    /// allocates are placed in the memory of the node.
+    ///
+    /// @param numa_node The index of the NUMA node. Must be less than the
+    ///     value returned by #get_numa_node_count().
+    /// @returns A CPU engine bound to the NUMA node.
+    static engine cpu_on_numa_node(int numa_node) {
+        dnnl_engine_t engine;
+        error::wrap_c_api(
+                dnnl_cpu_engine_create_on_numa_node(&engine, numa_node),
+                "could not create a CPU engine on a NUMA node");
+        return dnnl::engine(engine);
+    }
+
     /// Constructs an engine based on a primitive from the primitive
     /// descriptor @p pd by querying its engine.
     ///
@@ -1031,6 +1100,16 @@ struct engine : public handle<dnnl_engine_t> {
         return static_cast<engine::kind>(kind);
     }
 
+    /// Returns the NUMA node a CPU engine is bound to.
+    /// @returns The index of the NUMA node, or -1 if the engine is not bound
+    ///     to a NUMA node.
+    int get_numa_node() const {
+        int numa_node;
+        error::wrap_c_api(dnnl_cpu_engine_get_numa_node(get(), &numa_node),
+                "could not get a NUMA node of an engine");
+        return numa_node;
+    }
+
     /// Returns the engine of a primitive descriptor.
     ///
     /// @param pd The primitive descriptor to query.
@@ -1083,6 +1162,33 @@ struct handle_traits<dnnl_stream_t> {
 };
 /// @endcond
 
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_exec_graph_t> {
+    static dnnl_status_t destructor(dnnl_exec_graph_t p) {
+        return dnnl_exec_graph_destroy(p);
+    }
+};
+/// @endcond
+
+/// A sequence of primitive executions captured in a stream.
+/// @sa stream::begin_capture
+struct exec_graph : public handle<dnnl_exec_graph_t> {
+    using handle::handle;
+
+    /// Constructs an empty execution graph. An empty graph cannot be used in
+    /// any operations.
+    exec_graph() = default;
+
+    /// Returns the number of primitive executions of the graph.
+    int get_size() const {
+        int size = 0;
+        error::wrap_c_api(dnnl_exec_graph_get_size(get(), &size),
+                "could not get the size of an execution graph");
+        return size;
+    }
+};
+
 /// An execution stream.
 struct stream : public handle<dnnl_stream_t> {
     using handle::handle;
@@ -1129,6 +1235,96 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Profiling record.
+    using profiling_record = dnnl_profiling_record_t;
+
+    /// Enables or disables the execution profiling of the stream.
+    /// @sa dnnl_stream_set_profiling_capacity
+    ///
+    /// @param capacity Number of records to keep, or 0 to disable the
+    ///     profiling.
+    void set_profiling_capacity(int capacity) {
+        error::wrap_c_api(dnnl_stream_set_profiling_capacity(get(), capacity),
+                "could not set the profiling capacity of a stream");
+    }
+
+    /// Returns the profiling records of the stream from the oldest to the
+    /// most recent one. The strings of the records are valid until the
+    /// records are overwritten or the profiling is reset or disabled.
+    ///
+    /// @returns Vector of profiling records.
+    std::vector<profiling_record> get_profiling_records() const {
+        int count = 0;
+        error::wrap_c_api(
+                dnnl_stream_get_profiling_records_count(get(), &count),
+                "could not get the number of profiling records of a stream");
+
+        std::vector<profiling_record> records(count);
+        for (int i = 0; i < count; i++)
+            error::wrap_c_api(
+                    dnnl_stream_get_profiling_record(get(), i, &records[i]),
+                    "could not get a profiling record of a stream");
+        return records;
+    }
+
+    /// Drops the profiling records of the stream.
+    void reset_profiling() {
+        error::wrap_c_api(dnnl_stream_reset_profiling(get()),
+                "could not reset the profiling of a stream");
+    }
+
+    /// Returns the profiling records of the stream in the JSON trace event
+    /// format.
+    /// @sa dnnl_stream_get_profiling_trace
+    ///
+    /// @returns Trace.
+    std::string get_profiling_trace() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_stream_get_profiling_trace(get(), &size, nullptr),
+                "could not get the profiling trace size of a stream");
+
+        std::vector<char> trace(size);
+        error::wrap_c_api(
+                dnnl_stream_get_profiling_trace(get(), &size, trace.data()),
+                "could not get the profiling trace of a stream");
+        return std::string(trace.data());
+    }
+
+    /// Starts capturing the executions of primitives in the stream: until
+    /// end_capture() is called, the primitives are recorded instead of being
+    /// executed.
+    /// @sa dnnl_stream_begin_capture
+    ///
+    /// @returns The stream itself.
+    stream &begin_capture() {
+        error::wrap_c_api(dnnl_stream_begin_capture(get()),
+                "could not begin capturing a stream");
+        return *this;
+    }
+
+    /// Ends capturing the executions of primitives in the stream.
+    /// @sa dnnl_stream_end_capture
+    ///
+    /// @returns Execution graph holding the captured executions.
+    exec_graph end_capture() {
+        dnnl_exec_graph_t graph;
+        error::wrap_c_api(dnnl_stream_end_capture(get(), &graph),
+                "could not end capturing a stream");
+        return exec_graph(graph);
+    }
+
+    /// Replays an execution graph captured in the stream.
+    /// @sa dnnl_stream_replay
+    ///
+    /// @param graph Execution graph.
+    /// @returns The stream itself.
+    stream &replay(const exec_graph &graph) {
+        error::wrap_c_api(dnnl_stream_replay(get(), graph.get()),
+                "could not replay an execution graph");
+        return *this;
+    }
 };
 
 DNNL_DEFINE_BITMASK_OPS(stream::flags)
@@ -4407,6 +4603,25 @@ struct concat : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns whether a source may be placed in the destination memory.
+        ///
+        /// This is the case if the memory descriptor of the source is the
+        /// descriptor of its image in the destination, as created by
+        /// #dnnl::memory::desc::submemory_desc(), and the source is not
+        /// scaled. A source memory object created with that descriptor on
+        /// the buffer of the destination, e.g. written by the primitive
+        /// producing the source, is not copied by the concat, which becomes
+        /// a no-op if all the sources are placed in the destination.
+        ///
+        /// @param idx Source index.
+        /// @returns Whether the source may be placed in the destination.
+        bool src_inplace(int idx) const {
+            int res = 0;
+            dnnl_status_t status = dnnl_primitive_desc_query(get(),
+                    dnnl::convert_to_c(query::src_inplace_s32), idx, &res);
+            return status == dnnl_success && res != 0;
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -8108,80 +8323,81 @@ struct layer_normalization_backward : public primitive {
 
 /// @} dnnl_api_layer_normalization
 
-/// @addtogroup dnnl_api_inner_product Inner Product
+/// @addtogroup dnnl_api_layer_normalization_v2 Layer Normalization v2
 ///
-/// A primitive to compute an inner product.
+/// A primitive to perform layer normalization with source and destination
+/// tensors that may have different data types. Normalization is performed
+/// within the last logical dimension of data tensor.
 ///
-/// @sa @ref dev_guide_inner_product in developer guide
+/// @sa @ref dev_guide_layer_normalization in developer guide
 ///
 /// @{
 
-/// Inner product forward propagation primitive.
-struct inner_product_forward : public primitive {
-    /// Descriptor for an inner product forward propagation primitive.
+/// Layer normalization v2 forward propagation primitive.
+struct layer_normalization_v2_forward : public primitive {
+    /// Descriptor for a layer normalization v2 forward propagation primitive.
     struct desc {
-        dnnl_inner_product_desc_t data;
+        dnnl_layer_normalization_v2_desc_t data;
 
-        /// Constructs a descriptor for an inner product forward propagation
-        /// primitive with bias.
-        ///
-        /// @note
-        ///     All the memory descriptors may be initialized with the
-        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        /// Constructs a descriptor for layer normalization v2 forward
+        /// propagation primitive.
         ///
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
-        /// @param src_desc Memory descriptor for src.
-        /// @param weights_desc Memory descriptor for weights.
-        /// @param bias_desc Memory descriptor for bias.
-        /// @param dst_desc Memory descriptor for dst.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param stat_desc Statistics memory descriptors.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
         desc(prop_kind aprop_kind, const memory::desc &src_desc,
-                const memory::desc &weights_desc, const memory::desc &bias_desc,
-                const memory::desc &dst_desc) {
-            error::wrap_c_api(dnnl_inner_product_forward_desc_init(&data,
-                                      dnnl::convert_to_c(aprop_kind),
-                                      &src_desc.data, &weights_desc.data,
-                                      &bias_desc.data, &dst_desc.data),
-                    "could not create a descriptor for an inner product "
+                const memory::desc &dst_desc, const memory::desc &stat_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
                     "forward propagation primitive");
         }
 
-        /// Constructs a descriptor for an inner product forward propagation
-        /// primitive without bias.
-        ///
-        /// @note
-        ///     All the memory descriptors may be initialized with the
-        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        /// Constructs a descriptor for layer normalization v2 forward
+        /// propagation primitive.
         ///
         /// @param aprop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::forward_training, and
         ///     #dnnl::prop_kind::forward_inference.
-        /// @param src_desc Memory descriptor for src.
-        /// @param weights_desc Memory descriptor for weights.
-        /// @param dst_desc Memory descriptor for dst.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
         desc(prop_kind aprop_kind, const memory::desc &src_desc,
-                const memory::desc &weights_desc,
-                const memory::desc &dst_desc) {
+                const memory::desc &dst_desc, float epsilon,
+                normalization_flags flags) {
             error::wrap_c_api(
-                    dnnl_inner_product_forward_desc_init(&data,
+                    dnnl_layer_normalization_v2_forward_desc_init(&data,
                             dnnl::convert_to_c(aprop_kind), &src_desc.data,
-                            &weights_desc.data, nullptr, &dst_desc.data),
-                    "could not create a descriptor for an inner product "
+                            &dst_desc.data, nullptr, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
                     "forward propagation primitive");
         }
     };
 
-    /// Primitive descriptor for an inner product forward propagation primitive.
+    /// Primitive descriptor for a layer normalization v2 forward propagation
+    /// primitive.
     struct primitive_desc : public dnnl::primitive_desc {
         /// Default constructor. Produces an empty object.
         primitive_desc() = default;
 
-        /// Constructs a primitive descriptor for an inner product forward
-        /// propagation primitive.
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive.
         ///
-        /// @param adesc Descriptor for an inner product forward propagation
-        ///     primitive.
+        /// @param adesc Descriptor for a layer normalization v2 forward
+        ///     propagation primitive.
         /// @param aengine Engine to use.
         /// @param allow_empty A flag signifying whether construction is
         ///     allowed to fail without throwing an exception. In this case an
@@ -8192,11 +8408,11 @@ struct inner_product_forward : public primitive {
             : dnnl::primitive_desc(
                     &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
 
-        /// Constructs a primitive descriptor for an inner product forward
-        /// propagation primitive.
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive.
         ///
-        /// @param adesc Descriptor for an inner product forward propagation
-        ///     primitive.
+        /// @param adesc Descriptor for a layer normalization v2 forward
+        ///     propagation primitive.
         /// @param attr Primitive attributes to use.
         /// @param aengine Engine to use.
         /// @param allow_empty A flag signifying whether construction is
@@ -8208,105 +8424,739 @@ struct inner_product_forward : public primitive {
             : dnnl::primitive_desc(
                     &adesc.data, &attr, aengine, nullptr, allow_empty) {}
 
-        /// Constructs a primitive descriptor for an inner product forward
-        /// propagation primitive from a C API primitive descriptor that must
-        /// have a matching kind.
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
         ///
-        /// @param pd C API primitive descriptor for an inner product forward
-        ///     propagation primitive.
+        /// @param pd C API primitive descriptor for a layer normalization v2
+        ///     forward propagation primitive.
         primitive_desc(dnnl_primitive_desc_t pd)
-            : dnnl::primitive_desc(pd, dnnl::primitive::kind::inner_product,
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::layer_normalization_v2,
                     dnnl::prop_kind::forward_training,
                     dnnl::prop_kind::forward_inference) {}
 
         /// @copydoc dnnl::primitive_desc_base::src_desc()const
         memory::desc src_desc() const { return base::src_desc(0); }
 
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
         /// @copydoc dnnl::primitive_desc_base::weights_desc()const
         memory::desc weights_desc() const { return base::weights_desc(0); }
 
-        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
-        memory::desc dst_desc() const { return base::dst_desc(0); }
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
 
-        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
-        memory::desc bias_desc() const { return base::weights_desc(1); }
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_layer_normalization_v2_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(
+                                    query::layer_normalization_v2_d),
+                            0, &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for layer normalization forward propagation "
+                    "primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
     };
 
     /// Default constructor. Produces an empty object.
-    inner_product_forward() = default;
+    layer_normalization_v2_forward() = default;
 
-    /// Constructs an inner product forward propagation primitive.
-    /// @param pd Primitive descriptor for an inner product forward
+    /// Constructs a layer normalization v2 forward propagation primitive.
+    /// @param pd Primitive descriptor for a layer normalization v2 forward
     ///     propagation primitive.
-    inner_product_forward(const primitive_desc &pd) : primitive(pd) {}
+    layer_normalization_v2_forward(const primitive_desc &pd)
+        : primitive(pd) {}
 
-    /// Constructs an inner product forward propagation primitive from
+    /// Constructs a layer normalization v2 forward propagation primitive from
     ///     a cache blob.
-    /// @param pd Primitive descriptor for an inner product forward
+    /// @param pd Primitive descriptor for a layer normalization v2 forward
     ///     propagation primitive.
     /// @param cache_blob Cache blob.
-    inner_product_forward(
+    layer_normalization_v2_forward(
             const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
         : primitive(pd, cache_blob) {}
 };
 
-/// Inner product backward propagation primitive.
-struct inner_product_backward_data : public primitive {
-    /// Descriptor for an inner product backward propagation primitive.
+/// Layer normalization v2 backward propagation primitive.
+struct layer_normalization_v2_backward : public primitive {
+    /// Descriptor for a layer normalization v2 backward propagation
+    /// primitive.
     struct desc {
-        dnnl_inner_product_desc_t data;
+        dnnl_layer_normalization_v2_desc_t data;
 
-        /// Constructs a descriptor for an inner product backward propagation
-        /// primitive.
+        /// Constructs a descriptor for layer normalization v2 backward
+        /// propagation primitive.
         ///
-        /// @note
-        ///     All the memory descriptors may be initialized with the
-        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param stat_desc Statistics memory descriptors.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc,
+                const memory::desc &src_desc, const memory::desc &stat_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "backward propagation primitive");
+        }
+
+        /// Constructs a descriptor for layer normalization v2 backward
+        /// propagation primitive.
         ///
-        /// @param diff_src_desc Memory descriptor for diff src.
-        /// @param weights_desc Memory descriptor for weights.
-        /// @param diff_dst_desc Memory descriptor for diff dst.
-        desc(const memory::desc &diff_src_desc,
-                const memory::desc &weights_desc,
-                const memory::desc &diff_dst_desc) {
-            error::wrap_c_api(dnnl_inner_product_backward_data_desc_init(&data,
-                                      &diff_src_desc.data, &weights_desc.data,
-                                      &diff_dst_desc.data),
-                    "could not create a descriptor for an inner product "
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc,
+                const memory::desc &src_desc, float epsilon,
+                normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, nullptr, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
                     "backward propagation primitive");
         }
     };
 
-    /// Primitive descriptor for an inner product backward propagation
-    /// primitive.
+    /// Primitive descriptor for a layer normalization v2 backward
+    /// propagation primitive.
     struct primitive_desc : public dnnl::primitive_desc {
         /// Default constructor. Produces an empty object.
         primitive_desc() = default;
 
-        /// Constructs a primitive descriptor for an inner product backward
-        /// propagation primitive.
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive.
         ///
-        /// @param adesc Descriptor for an inner product backward propagation
-        ///     primitive.
+        /// @param adesc Descriptor for a layer normalization v2 backward
+        ///     propagation primitive.
         /// @param aengine Engine to use.
-        /// @param hint_fwd_pd Primitive descriptor for an inner product
-        ///     forward propagation primitive. It is used as a hint for
+        /// @param hint_fwd_pd Primitive descriptor for a layer normalization
+        ///     v2 forward propagation primitive. It is used as a hint for
         ///     deciding which memory format to use.
         /// @param allow_empty A flag signifying whether construction is
         ///     allowed to fail without throwing an exception. In this case an
         ///     empty object will be produced. This flag is optional and
         ///     defaults to false.
         primitive_desc(const desc &adesc, const engine &aengine,
-                const inner_product_forward::primitive_desc &hint_fwd_pd,
+                const layer_normalization_v2_forward::primitive_desc
+                        &hint_fwd_pd,
                 bool allow_empty = false)
             : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
                     hint_fwd_pd.get(), allow_empty) {}
 
-        /// Constructs a primitive descriptor for an inner product backward
-        /// propagation primitive.
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive.
         ///
-        /// @param adesc Descriptor for an inner product backward propagation
-        ///     primitive.
+        /// @param adesc Descriptor for a layer normalization v2 backward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a layer normalization
+        ///     v2 forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const layer_normalization_v2_forward::primitive_desc
+                        &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a layer normalization v2
+        ///     backward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::layer_normalization_v2,
+                    dnnl::prop_kind::backward, dnnl::prop_kind::backward_data) {
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return query_md(query::src_md, 1); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const {
+            return query_md(query::src_md, 2);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    layer_normalization_v2_backward() = default;
+
+    /// Constructs a layer normalization v2 backward propagation primitive.
+    /// @param pd Primitive descriptor for a layer normalization v2 backward
+    ///     propagation primitive.
+    layer_normalization_v2_backward(const primitive_desc &pd)
+        : primitive(pd) {}
+
+    /// Constructs a layer normalization v2 backward propagation primitive
+    ///     from a cache blob.
+    /// @param pd Primitive descriptor for a layer normalization v2 backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    layer_normalization_v2_backward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+///
+/// A primitive to perform group normalization. The channels are split into
+/// groups and normalization is performed within every group of channels of
+/// every image, across the channels of the group and the spatial dimensions.
+///
+/// @sa @ref dev_guide_group_normalization in developer guide
+///
+/// @{
+
+/// Group normalization forward propagation primitive.
+struct group_normalization_forward : public primitive {
+    /// Descriptor for a group normalization forward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Constructs a descriptor for group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param groups Number of groups the channels are split into.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, memory::dim groups,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, groups, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_group_normalization_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl::convert_to_c(query::group_normalization_d),
+                            0, &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for group normalization forward propagation "
+                    "primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_forward() = default;
+
+    /// Constructs a group normalization forward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    group_normalization_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a group normalization forward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    group_normalization_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// Group normalization backward propagation primitive.
+struct group_normalization_backward : public primitive {
+    /// Descriptor for a group normalization backward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Constructs a descriptor for group normalization backward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param groups Number of groups the channels are split into.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc,
+                const memory::desc &src_desc, memory::dim groups,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, groups, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "backward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization backward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     backward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::backward, dnnl::prop_kind::backward_data) {
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return query_md(query::src_md, 1); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const {
+            return query_md(query::src_md, 2);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_backward() = default;
+
+    /// Constructs a group normalization backward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization backward
+    ///     propagation primitive.
+    group_normalization_backward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a group normalization backward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for a group normalization backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    group_normalization_backward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_group_normalization
+
+/// @addtogroup dnnl_api_inner_product Inner Product
+///
+/// A primitive to compute an inner product.
+///
+/// @sa @ref dev_guide_inner_product in developer guide
+///
+/// @{
+
+/// Inner product forward propagation primitive.
+struct inner_product_forward : public primitive {
+    /// Descriptor for an inner product forward propagation primitive.
+    struct desc {
+        dnnl_inner_product_desc_t data;
+
+        /// Constructs a descriptor for an inner product forward propagation
+        /// primitive with bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Memory descriptor for src.
+        /// @param weights_desc Memory descriptor for weights.
+        /// @param bias_desc Memory descriptor for bias.
+        /// @param dst_desc Memory descriptor for dst.
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &bias_desc,
+                const memory::desc &dst_desc) {
+            error::wrap_c_api(dnnl_inner_product_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      &src_desc.data, &weights_desc.data,
+                                      &bias_desc.data, &dst_desc.data),
+                    "could not create a descriptor for an inner product "
+                    "forward propagation primitive");
+        }
+
+        /// Constructs a descriptor for an inner product forward propagation
+        /// primitive without bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Memory descriptor for src.
+        /// @param weights_desc Memory descriptor for weights.
+        /// @param dst_desc Memory descriptor for dst.
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &dst_desc) {
+            error::wrap_c_api(
+                    dnnl_inner_product_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &weights_desc.data, nullptr, &dst_desc.data),
+                    "could not create a descriptor for an inner product "
+                    "forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for an inner product forward propagation primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an inner product forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an inner product forward propagation
+        ///     primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an inner product forward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an inner product forward propagation
+        ///     primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an inner product forward
+        /// propagation primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an inner product forward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::inner_product,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
+        memory::desc bias_desc() const { return base::weights_desc(1); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    inner_product_forward() = default;
+
+    /// Constructs an inner product forward propagation primitive.
+    /// @param pd Primitive descriptor for an inner product forward
+    ///     propagation primitive.
+    inner_product_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an inner product forward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for an inner product forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    inner_product_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// Inner product backward propagation primitive.
+struct inner_product_backward_data : public primitive {
+    /// Descriptor for an inner product backward propagation primitive.
+    struct desc {
+        dnnl_inner_product_desc_t data;
+
+        /// Constructs a descriptor for an inner product backward propagation
+        /// primitive.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param diff_src_desc Memory descriptor for diff src.
+        /// @param weights_desc Memory descriptor for weights.
+        /// @param diff_dst_desc Memory descriptor for diff dst.
+        desc(const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_dst_desc) {
+            error::wrap_c_api(dnnl_inner_product_backward_data_desc_init(&data,
+                                      &diff_src_desc.data, &weights_desc.data,
+                                      &diff_dst_desc.data),
+                    "could not create a descriptor for an inner product "
+                    "backward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for an inner product backward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an inner product backward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an inner product backward propagation
+        ///     primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for an inner product
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const inner_product_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for an inner product backward
+        /// propagation primitive.
+        ///
+        /// @param adesc Descriptor for an inner product backward propagation
+        ///     primitive.
         /// @param attr Primitive attributes to use.
         /// @param aengine Engine to use.
         /// @param hint_fwd_pd Primitive descriptor for an inner product
@@ -8542,6 +9392,14 @@ struct rnn_primitive_desc_base : public primitive_desc {
         return base::query_md(query::exec_arg_md, DNNL_ARG_AUGRU_ATTENTION);
     }
 
+    /// Returns sequence lengths memory descriptor.
+    /// @returns Sequence lengths memory descriptor.
+    /// @returns A zero memory descriptor if the primitive was not created
+    ///          with the #dnnl::rnn_flags::seq_lengths flag.
+    memory::desc seq_lengths_desc() const {
+        return base::query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS);
+    }
+
     /// Returns source iteration memory descriptor.
     /// @returns Source iteration memory descriptor.
     /// @returns A zero memory descriptor if the primitive does not have a
@@ -8774,7 +9632,7 @@ struct vanilla_rnn_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         /// @param alpha Negative slope if activation is
         ///     #dnnl::algorithm::eltwise_relu.
         /// @param beta Unused.
@@ -8956,7 +9814,7 @@ struct vanilla_rnn_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         /// @param alpha Negative slope if activation is
         ///     #dnnl::algorithm::eltwise_relu.
         /// @param beta Unused.
@@ -9191,7 +10049,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9259,7 +10117,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9320,7 +10178,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9543,7 +10401,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9655,7 +10513,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9754,7 +10612,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10012,7 +10870,7 @@ struct gru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10181,7 +11039,7 @@ struct gru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10393,7 +11251,7 @@ struct lbr_gru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10565,7 +11423,7 @@ struct lbr_gru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10780,7 +11638,7 @@ struct augru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10958,7 +11816,7 @@ struct augru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -11184,7 +12042,7 @@ struct lbr_augru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -11365,7 +12223,7 @@ struct lbr_augru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags RNN cell flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -12835,6 +13693,171 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+///
+/// A primitive to compute scaled dot-product attention
+/// softmax(scale * Q * K^T + mask) * V without storing the scores tensor.
+///
+/// @sa @ref dev_guide_sdpa in developer guide
+///
+/// @{
+
+/// Scaled dot-product attention forward propagation.
+struct sdpa_forward : public primitive {
+    /// Descriptor for a scaled dot-product attention forward propagation
+    /// primitive.
+    struct desc {
+        dnnl_sdpa_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// forward propagation primitive without an attention mask.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values:
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the scores.
+        /// @param flags Scaled dot-product attention flags.
+        desc(prop_kind aprop_kind, const memory::desc &q_desc,
+                const memory::desc &k_desc, const memory::desc &v_desc,
+                const memory::desc &dst_desc, float scale,
+                sdpa_flags flags = sdpa_flags::none) {
+            error::wrap_c_api(
+                    dnnl_sdpa_desc_init(&data, dnnl::convert_to_c(aprop_kind),
+                            &q_desc.data, &k_desc.data, &v_desc.data, nullptr,
+                            &dst_desc.data, scale, convert_to_c(flags)),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention forward propagation primitive");
+        }
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// forward propagation primitive with an attention mask.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values:
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param mask_desc Attention mask memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the scores.
+        /// @param flags Scaled dot-product attention flags.
+        desc(prop_kind aprop_kind, const memory::desc &q_desc,
+                const memory::desc &k_desc, const memory::desc &v_desc,
+                const memory::desc &mask_desc, const memory::desc &dst_desc,
+                float scale, sdpa_flags flags = sdpa_flags::none) {
+            error::wrap_c_api(
+                    dnnl_sdpa_desc_init(&data, dnnl::convert_to_c(aprop_kind),
+                            &q_desc.data, &k_desc.data, &v_desc.data,
+                            &mask_desc.data, &dst_desc.data, scale,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a scaled dot-product attention forward
+    /// propagation primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param attr Primitive attributes to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive from a C API primitive
+        /// descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a scaled dot-product
+        ///     attention forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::sdpa,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// Returns a queries memory descriptor.
+        /// @returns Queries memory descriptor.
+        memory::desc queries_desc() const { return base::src_desc(0); }
+
+        /// Returns a keys memory descriptor.
+        /// @returns Keys memory descriptor.
+        memory::desc keys_desc() const { return base::src_desc(1); }
+
+        /// Returns a values memory descriptor.
+        /// @returns Values memory descriptor.
+        memory::desc values_desc() const { return base::src_desc(2); }
+
+        /// Returns an attention mask memory descriptor.
+        /// @returns Attention mask memory descriptor, or a zero memory
+        ///     descriptor if the primitive does not have an attention mask.
+        memory::desc mask_desc() const { return base::src_desc(3); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    sdpa_forward() = default;
+
+    /// Constructs a scaled dot-product attention forward propagation
+    /// primitive.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     forward propagation primitive.
+    sdpa_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a scaled dot-product attention forward propagation
+    /// primitive from a cache blob.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     forward propagation primitive.
+    /// @param cache_blob Cache blob.
+    sdpa_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -12906,6 +13929,11 @@ inline status set_jit_profiling_jitdumpdir(const std::string &dir) {
     return static_cast<status>(dnnl_set_jit_profiling_jitdumpdir(dir.c_str()));
 }
 
+/// @copydoc dnnl_set_jit_cache_dir()
+inline status set_jit_cache_dir(const std::string &dir) {
+    return static_cast<status>(dnnl_set_jit_cache_dir(dir.c_str()));
+}
+
 /// @copydoc dnnl_cpu_isa_t
 enum class cpu_isa {
     /// @copydoc dnnl_cpu_isa_all
@@ -12985,8 +14013,79 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_get_primitive_cache_capacity_bytes(size_t *capacity_bytes)
+inline size_t get_primitive_cache_capacity_bytes() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_capacity_bytes(&result),
+            "could not get primitive cache capacity in bytes");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_capacity_bytes(size_t capacity_bytes)
+inline void set_primitive_cache_capacity_bytes(size_t capacity_bytes) {
+    error::wrap_c_api(dnnl_set_primitive_cache_capacity_bytes(capacity_bytes),
+            "could not set primitive cache capacity in bytes");
+}
+
+/// Primitive cache statistics.
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// @copydoc dnnl_get_primitive_cache_stats(dnnl_primitive_cache_stats_t *stats)
+inline primitive_cache_stats_t get_primitive_cache_stats() {
+    primitive_cache_stats_t result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(&result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_reset_primitive_cache_stats()
+inline void reset_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_reset_primitive_cache_stats(),
+            "could not reset primitive cache statistics");
+}
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_pool Scratchpad Pool
+///
+/// A set of functions that control the pool of buffers backing the library
+/// managed scratchpads.
+///
+/// @{
+
+/// @copydoc dnnl_get_scratchpad_pool_capacity_bytes(size_t *capacity_bytes)
+inline size_t get_scratchpad_pool_capacity_bytes() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_scratchpad_pool_capacity_bytes(&result),
+            "could not get scratchpad pool capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_scratchpad_pool_capacity_bytes(size_t capacity_bytes)
+inline void set_scratchpad_pool_capacity_bytes(size_t capacity_bytes) {
+    error::wrap_c_api(dnnl_set_scratchpad_pool_capacity_bytes(capacity_bytes),
+            "could not set scratchpad pool capacity");
+}
+
+/// Scratchpad pool statistics.
+using scratchpad_pool_stats_t = dnnl_scratchpad_pool_stats_t;
+
+/// @copydoc dnnl_get_scratchpad_pool_stats(dnnl_scratchpad_pool_stats_t *stats)
+inline scratchpad_pool_stats_t get_scratchpad_pool_stats() {
+    scratchpad_pool_stats_t result {};
+    error::wrap_c_api(dnnl_get_scratchpad_pool_stats(&result),
+            "could not get scratchpad pool statistics");
+    return result;
+}
+
+/// @copydoc dnnl_reset_scratchpad_pool_stats()
+inline void reset_scratchpad_pool_stats() {
+    error::wrap_c_api(dnnl_reset_scratchpad_pool_stats(),
+            "could not reset scratchpad pool statistics");
+}
+
+/// @} dnnl_api_scratchpad_pool
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -13020,6 +14119,77 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch_size));
+}
+
+/// @copydoc dnnl_sgemm_grouped()
+inline status sgemm_grouped(dnnl_dim_t count, const char *transa,
+        const char *transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        const float *beta, float *const *C, const dnnl_dim_t *ldc) {
+    return static_cast<status>(dnnl_sgemm_grouped(count, transa, transb, M, N,
+            K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_grouped()
+inline status gemm_u8s8s32_grouped(dnnl_dim_t count, const char *transa,
+        const char *transb, const char *offsetc, const dnnl_dim_t *M,
+        const dnnl_dim_t *N, const dnnl_dim_t *K, const float *alpha,
+        const uint8_t *const *A, const dnnl_dim_t *lda, const uint8_t *ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dnnl_dim_t *ldc,
+        const int32_t *const *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_grouped(count, transa,
+            transb, offsetc, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C,
+            ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_grouped()
+inline status gemm_s8s8s32_grouped(dnnl_dim_t count, const char *transa,
+        const char *transb, const char *offsetc, const dnnl_dim_t *M,
+        const dnnl_dim_t *N, const dnnl_dim_t *K, const float *alpha,
+        const int8_t *const *A, const dnnl_dim_t *lda, const int8_t *ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dnnl_dim_t *ldc,
+        const int32_t *const *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_grouped(count, transa,
+            transb, offsetc, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C,
+            ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -1416,6 +1416,13 @@ typedef enum {
     /// A softmax version 2 primitive (softmax with destination memory
     /// descriptor and algorithm kind).
     dnnl_softmax_v2,
+    /// A layer normalization version 2 primitive (layer normalization with
+    /// destination memory descriptor).
+    dnnl_layer_normalization_v2,
+    /// A scaled dot-product attention primitive.
+    dnnl_sdpa,
+    /// A group normalization primitive.
+    dnnl_group_normalization,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2288,6 +2295,91 @@ typedef struct {
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_layer_normalization_v2
+/// @{
+
+/// A descriptor of a Layer Normalization version 2 operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_layer_normalization_v2.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, #dnnl_backward, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Scale and shift data and gradient memory descriptors.
+    ///
+    /// Scaleshift memory descriptor uses 2D #dnnl_ab
+    /// format[2, normalized_dim] where 1-st dimension contains gamma parameter,
+    /// 2-nd dimension contains beta parameter. Normalized_dim is equal to the
+    /// last logical dimension of the data tensor across which normalization is
+    /// performed.
+    dnnl_memory_desc_t data_scaleshift_desc;
+    dnnl_memory_desc_t diff_data_scaleshift_desc;
+    /// Mean and variance data memory descriptors.
+    ///
+    /// Statistics (mean and variance) memory descriptor is the k-dimensional tensor
+    /// where k is equal to data_tensor_ndims - 1 and may have any plain
+    /// (stride[last_dim] == 1) user-provided format.
+    dnnl_memory_desc_t stat_desc;
+    /// Layer normalization epsilon parameter.
+    float layer_norm_epsilon;
+    unsigned flags;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+} dnnl_layer_normalization_v2_desc_t;
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// A descriptor of a Group Normalization operation.
+///
+/// The channels (the second logical dimension of the data tensor) are split
+/// into @p groups groups of consecutive channels, and every group of every
+/// image is normalized independently over its channels and spatial points.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_group_normalization.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, #dnnl_backward, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Scale and shift data and gradient memory descriptors.
+    ///
+    /// Scale and shift memory descriptors use 1D #dnnl_x format[channels].
+    dnnl_memory_desc_t scaleshift_desc;
+    dnnl_memory_desc_t diff_scaleshift_desc;
+    /// Mean and variance data memory descriptors.
+    ///
+    /// Statistics (mean and variance) memory descriptor uses 2D #dnnl_ab
+    /// format[minibatch, groups].
+    dnnl_memory_desc_t stat_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+    /// Number of groups the channels are split into.
+    dnnl_dim_t groups;
+    /// Group normalization epsilon parameter.
+    float group_norm_epsilon;
+    /// Flags of the operation. Possible values are combinations of
+    /// #dnnl_use_global_stats, #dnnl_use_scale and #dnnl_use_shift.
+    unsigned flags;
+} dnnl_group_normalization_desc_t;
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -2328,7 +2420,13 @@ typedef struct {
 /// Flags for RNN cell.
 typedef enum {
     /// Undefined RNN flags
-    dnnl_rnn_flags_undef = 0x0
+    dnnl_rnn_flags_undef = 0x0,
+    /// The primitive takes the length of the sequence of each batch element
+    /// as an extra #DNNL_ARG_SEQ_LENGTHS input. Elements of the batch stop
+    /// being computed once their sequence ends: their part of `dst_layer`
+    /// is zeroed for the remaining time steps and `dst_iter` holds the state
+    /// of their last time step. Supported for #dnnl_forward_inference only.
+    dnnl_rnn_flags_seq_lengths = 0x1,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2536,6 +2634,53 @@ typedef struct {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa
+/// @{
+
+/// Flags for scaled dot-product attention primitive.
+typedef enum {
+    /// Default flags.
+    dnnl_sdpa_flags_none = 0x0U,
+    /// Causal attention.
+    ///
+    /// If specified, query @p i attends only to keys @p j such that
+    /// @p j <= @p i + Skv - Sq, where Sq and Skv are the query and the
+    /// key sequence lengths. The masked out scores do not contribute to the
+    /// result.
+    dnnl_sdpa_causal = 0x1U,
+} dnnl_sdpa_flags_t;
+
+/// A descriptor of a scaled dot-product attention operation.
+///
+/// The operation computes softmax(scale * Q * K^T + mask) * V independently
+/// for every batch (all the dimensions but the two innermost ones).
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_sdpa.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_inference.
+    dnnl_prop_kind_t prop_kind;
+    /// Queries memory descriptor (batch dimensions, Sq, D).
+    dnnl_memory_desc_t q_desc;
+    /// Keys memory descriptor (batch dimensions, Skv, D).
+    dnnl_memory_desc_t k_desc;
+    /// Values memory descriptor (batch dimensions, Skv, Dv).
+    dnnl_memory_desc_t v_desc;
+    /// Attention mask memory descriptor (batch dimensions, Sq, Skv). The mask
+    /// is added to the scaled scores and can be broadcast along any dimension
+    /// by setting it to one. A zero memory descriptor means no mask.
+    dnnl_memory_desc_t mask_desc;
+    /// Destination memory descriptor (batch dimensions, Sq, Dv).
+    dnnl_memory_desc_t dst_desc;
+    /// The scale applied to the scores, usually 1 / sqrt(D).
+    float scale;
+    /// Flags of the operation. Possible values are combinations of
+    /// #dnnl_sdpa_flags_t.
+    unsigned flags;
+} dnnl_sdpa_desc_t;
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -2696,6 +2841,9 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input vector. An alias for
 /// #DNNL_ARG_SRC_0.
 #define DNNL_ARG_SRC_LAYER DNNL_ARG_SRC_0
+/// A special mnemonic for scaled dot-product attention queries. An alias for
+/// #DNNL_ARG_SRC_0.
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
 /// A special mnemonic for reorder source argument. An alias for
 /// #DNNL_ARG_SRC_0.
 #define DNNL_ARG_FROM DNNL_ARG_SRC_0
@@ -2705,18 +2853,33 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An alias
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
+/// A special mnemonic for scaled dot-product attention keys. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
 /// A special mnemonic for RNN input recurrent cell state vector. An alias for
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
+/// A special mnemonic for scaled dot-product attention values. An alias for
+/// #DNNL_ARG_SRC_2.
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 
 /// Source argument #3.
 #define DNNL_ARG_SRC_3 4
 /// A special mnemonic for RNN input recurrent cell attention vector. An alias for
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
+/// A special mnemonic for scaled dot-product attention mask. An alias for
+/// #DNNL_ARG_SRC_3.
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SRC_3
+
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
 
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
@@ -2973,6 +3136,9 @@ typedef enum {
     dnnl_query_cache_blob_id_size_s64, ///< size of cache blob ID in bytes
     dnnl_query_cache_blob_id, ///< cache blob  ID (pointer to array)
 
+    dnnl_query_src_inplace_s32, ///< whether a source may be placed in the
+    ///  destination memory (concat only)
+
     // memory and op descriptor section
     dnnl_query_some_d = 64, ///< stub
     dnnl_query_op_d, ///< op descriptor
@@ -2996,6 +3162,9 @@ typedef enum {
     dnnl_query_reduction_d, ///< reduction descriptor
     dnnl_query_prelu_d, ///< prelu descriptor
     dnnl_query_softmax_v2_d, ///< softmax version 2 descriptor
+    dnnl_query_layer_normalization_v2_d, ///< layer normalization v2 descriptor
+    dnnl_query_sdpa_d, ///< scaled dot-product attention descriptor
+    dnnl_query_group_normalization_d, ///< group normalization descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -3038,8 +3207,86 @@ typedef struct dnnl_stream *dnnl_stream_t;
 /// A constant execution stream handle.
 typedef const struct dnnl_stream *const_dnnl_stream_t;
 
+/// Stream profiling record.
+///
+/// A record describes either the execution of a primitive or a phase of its
+/// implementation, e.g. the reorder of the weights or the computation of the
+/// post-ops.
+typedef struct {
+    /// Kind of the executed primitive.
+    dnnl_primitive_kind_t kind;
+    /// Name of the implementation of the primitive.
+    const char *impl_name;
+    /// Description of the primitive as printed by the verbose mode, which
+    /// includes the shapes and the memory formats.
+    const char *info;
+    /// Name of the phase of the implementation, or NULL if the record
+    /// describes the execution of the whole primitive.
+    const char *phase;
+    /// Nesting level of the phase: 0 for the execution of the whole
+    /// primitive, 1 for the phases of the implementation, 2 for the phases
+    /// nested in them, and so on.
+    int depth;
+    /// Start timestamp in nanoseconds. The timestamps are taken from a
+    /// monotonic clock on the host and are only meaningful relatively to
+    /// each other.
+    uint64_t start_ns;
+    /// End timestamp in nanoseconds.
+    uint64_t end_ns;
+} dnnl_profiling_record_t;
+
+/// @struct dnnl_exec_graph
+/// An opaque structure to describe a sequence of primitive executions
+/// captured in a stream.
+struct dnnl_exec_graph;
+/// An execution graph handle.
+typedef struct dnnl_exec_graph *dnnl_exec_graph_t;
+/// A constant execution graph handle.
+typedef const struct dnnl_exec_graph *const_dnnl_exec_graph_t;
+
 /// @} dnnl_api_stream
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics.
+typedef struct {
+    /// Number of primitive creations served by the cache.
+    uint64_t hits;
+    /// Number of primitive creations that missed the cache.
+    uint64_t misses;
+    /// Number of entries evicted from the cache.
+    uint64_t evictions;
+    /// Number of entries currently held by the cache.
+    uint64_t entries;
+    /// Total resident size in bytes of the primitives currently held by the
+    /// cache.
+    uint64_t resident_bytes;
+    /// Total time in nanoseconds spent creating primitives on cache misses.
+    uint64_t creation_time_ns;
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
+/// @addtogroup dnnl_api_scratchpad_pool
+/// @{
+
+/// Scratchpad pool statistics.
+typedef struct {
+    /// Total size in bytes of the pooled buffers used by scratchpads.
+    uint64_t in_use_bytes;
+    /// Total size in bytes of the buffers retained by the pools for reuse.
+    uint64_t retained_bytes;
+    /// Peak of the total size in bytes of the used and retained buffers.
+    uint64_t peak_bytes;
+    /// Number of scratchpad buffers taken from a pool.
+    uint64_t hits;
+    /// Number of scratchpad buffers allocated from the system.
+    uint64_t misses;
+} dnnl_scratchpad_pool_stats_t;
+
+/// @} dnnl_api_scratchpad_pool
+
 /// @addtogroup dnnl_api_service
 /// @{
 
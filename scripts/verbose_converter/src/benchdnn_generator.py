@@ -42,6 +42,7 @@ def convert_driver(prop_kind):
         'eltwise': 'eltwise',
         'inner_product': 'ip',
         'layer_normalization': 'lnorm',
+        'layer_normalization_v2': 'lnorm',
         'lrn': 'lrn',
         'matmul': 'matmul',
         'pooling': 'pool',
@@ -172,6 +173,13 @@ def convert_dts(mds, prim_kind):
         dt = dts[0]
         return f'--dt={dt}'
 
+    def convert_dts_lnorm(mds):
+        dt = convert_dts_common(mds)
+        for md in mds:
+            if md['arg'] == 'dst' and f"--dt={md['data_type']}" != dt:
+                dt += f" --ddt={md['data_type']}"
+        return dt
+
     def convert_dts_cfg(mds):
         cfg = "--cfg="
         mds_strip = mds
@@ -247,7 +255,7 @@ def convert_dts(mds, prim_kind):
         'deconvolution': convert_dts_cfg,
         'eltwise': convert_dts_common,
         'inner_product': convert_dts_cfg,
-        'layer_normalization': convert_dts_common,
+        'layer_normalization': convert_dts_lnorm,
         'lrn': convert_dts_common,
         'matmul': convert_dts_cfg_with_bias,
         'pooling': convert_dts_cfg_pool,
@@ -1265,6 +1265,9 @@ const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax_v2 = dnnl_softmax_v2;
+const primitive_kind_t layer_normalization_v2 = dnnl_layer_normalization_v2;
+const primitive_kind_t sdpa = dnnl_sdpa;
+const primitive_kind_t group_normalization = dnnl_group_normalization;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -1296,6 +1299,8 @@ const query_t prop_kind = dnnl_query_prop_kind;
 const query_t cache_blob_id_size_s64 = dnnl_query_cache_blob_id_size_s64;
 const query_t cache_blob_id = dnnl_query_cache_blob_id;
 
+const query_t src_inplace_s32 = dnnl_query_src_inplace_s32;
+
 const query_t some_d = dnnl_query_some_d;
 const query_t op_d = dnnl_query_op_d;
 const query_t convolution_d = dnnl_query_convolution_d;
@@ -1318,6 +1323,10 @@ const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
 const query_t reduction_d = dnnl_query_reduction_d;
 const query_t softmax_v2_d = dnnl_query_softmax_v2_d;
+const query_t layer_normalization_v2_d
+        = dnnl_query_layer_normalization_v2_d;
+const query_t sdpa_d = dnnl_query_sdpa_d;
+const query_t group_normalization_d = dnnl_query_group_normalization_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -1359,6 +1368,9 @@ using matmul_desc_t = dnnl_matmul_desc_t;
 using resampling_desc_t = dnnl_resampling_desc_t;
 using reduction_desc_t = dnnl_reduction_desc_t;
 using softmax_v2_desc_t = dnnl_softmax_v2_desc_t;
+using layer_normalization_v2_desc_t = dnnl_layer_normalization_v2_desc_t;
+using sdpa_desc_t = dnnl_sdpa_desc_t;
+using group_normalization_desc_t = dnnl_group_normalization_desc_t;
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -1388,7 +1400,7 @@ struct op_desc_t {
         softmax_v2_desc_t softmax_v2;
         lrn_desc_t lrn;
         batch_normalization_desc_t batch_normalization;
-        layer_normalization_desc_t layer_normalization;
+        layer_normalization_v2_desc_t layer_normalization_v2;
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
         gemm_desc_t gemm;
@@ -1400,6 +1412,8 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        sdpa_desc_t sdpa;
+        group_normalization_desc_t group_normalization;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -1419,7 +1433,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(softmax_v2_desc_t);
     DECL_CTOR_AND_CONVERTERS(lrn_desc_t);
     DECL_CTOR_AND_CONVERTERS(batch_normalization_desc_t);
-    DECL_CTOR_AND_CONVERTERS(layer_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(layer_normalization_v2_desc_t);
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t);
     DECL_CTOR_AND_CONVERTERS(gemm_desc_t);
@@ -1431,6 +1445,8 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
+    DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -1454,6 +1470,7 @@ const stream_flags_t out_of_order = dnnl_stream_out_of_order;
 const stream_flags_t default_flags = dnnl_stream_default_flags;
 } // namespace stream_flags
 using stream_t = dnnl_stream;
+using exec_graph_t = dnnl_exec_graph;
 
 struct memory_storage_t;
 
@@ -1475,6 +1492,9 @@ struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
 struct gemm_pd_t;
+struct group_normalization_bwd_pd_t;
+struct group_normalization_fwd_pd_t;
+struct group_normalization_pd_t;
 struct inner_product_bwd_data_pd_t;
 struct inner_product_bwd_weights_pd_t;
 struct inner_product_fwd_pd_t;
@@ -1496,6 +1516,7 @@ struct resampling_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
+struct sdpa_pd_t;
 struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/cache_blob.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+thread_local host_binaries_scope_t *current_scope = nullptr;
+} // namespace
+
+host_binaries_scope_t::host_binaries_scope_t(
+        const cache_blob_t &blob, host_binaries_t &binaries)
+    : blob_(blob), binaries_(binaries), prev_(current_scope) {
+    current_scope = this;
+}
+
+host_binaries_scope_t::~host_binaries_scope_t() {
+    current_scope = prev_;
+}
+
+host_binaries_scope_t *host_binaries_scope_t::current() {
+    return current_scope;
+}
+
+} // namespace impl
+} // namespace dnnl
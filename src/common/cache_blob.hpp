@@ -20,8 +20,10 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include "c_types_map.hpp"
+#include "utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -46,8 +48,13 @@ struct cache_blob_impl_t {
 
     status_t get_binary(const uint8_t **binary, size_t *binary_size) {
         if (!binary || !binary_size) { return status::invalid_arguments; }
-        if (pos_ >= size_) { return status::invalid_arguments; }
+        if (pos_ + sizeof(*binary_size) > size_) {
+            return status::invalid_arguments;
+        }
         (*binary_size) = *reinterpret_cast<size_t *>(data_ + pos_);
+        if (*binary_size > size_ - pos_ - sizeof(*binary_size)) {
+            return status::invalid_arguments;
+        }
         pos_ += sizeof(*binary_size);
         (*binary) = data_ + pos_;
         pos_ += *binary_size;
@@ -81,6 +88,76 @@ private:
     std::shared_ptr<cache_blob_impl_t> impl_;
 };
 
+// Binaries of the kernels generated on the host (CPU JIT) during primitive
+// creation. The binaries are kept in the order of kernel creation, which is
+// also the order in which the kernels consume them from a cache blob.
+//
+// A primitive can be serialized only if every kernel created during its
+// initialization provided a binary. A single kernel that cannot be relocated
+// invalidates the whole set.
+struct host_binaries_t {
+    host_binaries_t() = default;
+
+    void add(std::vector<uint8_t> &&binary) {
+        if (is_complete_) binaries_.emplace_back(std::move(binary));
+    }
+
+    void invalidate() {
+        is_complete_ = false;
+        binaries_.clear();
+    }
+
+    bool is_serializable() const { return is_complete_ && !binaries_.empty(); }
+
+    status_t get_cache_blob_size(size_t *size) const {
+        if (!is_serializable()) return status::unimplemented;
+        // Additional sizeof(size_t) bytes are needed to store the size of
+        // each binary when packing.
+        for (const auto &b : binaries_)
+            (*size) += b.size() + sizeof(size_t);
+        return status::success;
+    }
+
+    status_t get_cache_blob(cache_blob_t &blob) const {
+        if (!is_serializable()) return status::unimplemented;
+        for (const auto &b : binaries_)
+            CHECK(blob.add_binary(b.data(), b.size()));
+        return status::success;
+    }
+
+    // Total size of the code generated on the host, whether or not it can be
+    // serialized.
+    void add_code_size(size_t size) { code_size_ += size; }
+    size_t code_size() const { return code_size_; }
+
+private:
+    bool is_complete_ = true;
+    size_t code_size_ = 0;
+    std::vector<std::vector<uint8_t>> binaries_;
+};
+
+// Binds a cache blob and a binaries storage to the current thread for the
+// duration of a primitive initialization. Host kernel generators query the
+// innermost scope to either restore their code from the cache blob or to
+// record it. Scopes nest, so nested primitives do not interfere with the
+// parent one.
+struct host_binaries_scope_t {
+    host_binaries_scope_t(const cache_blob_t &blob, host_binaries_t &binaries);
+    ~host_binaries_scope_t();
+
+    static host_binaries_scope_t *current();
+
+    cache_blob_t &blob() { return blob_; }
+    host_binaries_t &binaries() { return binaries_; }
+
+private:
+    cache_blob_t blob_;
+    host_binaries_t &binaries_;
+    host_binaries_scope_t *prev_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(host_binaries_scope_t);
+};
+
 } // namespace impl
 } // namespace dnnl
 
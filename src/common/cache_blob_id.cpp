@@ -22,6 +22,10 @@
 #include "common/serialization.hpp"
 #include "common/serialization_stream.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/platform.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 
@@ -32,9 +36,8 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
     auto engine_kind = engine->kind();
     auto runtime_kind = engine->runtime_kind();
 
-    if (engine_kind != engine_kind::gpu
-            || (engine_kind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (engine_kind == engine_kind::gpu
+            && runtime_kind != runtime_kind::ocl) {
         return sstream_.get_data();
     }
 
@@ -42,9 +45,6 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
         return sstream_.get_data();
     }
 
-    assert(engine->kind() == engine_kind::gpu
-            && engine->runtime_kind() == runtime_kind::ocl);
-
     const auto init_id = [&]() {
         serialization::serialize_desc(sstream_, pd->op_desc());
         serialization::serialize_attr(sstream_, *pd->attr());
@@ -64,7 +64,27 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
         // this API to DPCPP runtime.
         sstream_.write(&runtime_kind);
 
-        engine->serialize_device(sstream_);
+        if (engine_kind == engine_kind::cpu) {
+            // JIT kernels depend on the instruction set they are generated
+            // for.
+            const auto isa = dnnl_get_effective_cpu_isa();
+            const auto isa_hints = dnnl_get_cpu_isa_hints();
+            sstream_.write(&isa);
+            sstream_.write(&isa_hints);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+            // Blocking of brgemm based implementations depends on the cache
+            // sizes and the number of cores.
+            for (int level = 1; level <= 3; level++) {
+                const unsigned cache_size
+                        = cpu::platform::get_per_core_cache_size(level);
+                sstream_.write(&cache_size);
+            }
+            const unsigned ncores = cpu::platform::get_num_cores();
+            sstream_.write(&ncores);
+#endif
+        } else {
+            engine->serialize_device(sstream_);
+        }
 
         auto pd_iterator_offset = pd->pd_iterator_offset();
         sstream_.write(&pd_iterator_offset);
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2021 Intel Corporation
+* Copyright 2018-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -46,7 +46,6 @@ status_t concat_primitive_desc_create(primitive_desc_iface_t **concat_pd_iface,
 
     const int ndims = src_mds[0].ndims;
     const dims_t &dims = src_mds[0].dims;
-    const data_type_t dt = src_mds[0].data_type;
     if (memory_desc_wrapper(src_mds[0]).has_runtime_dims_or_strides())
         return unimplemented;
 
@@ -63,7 +62,6 @@ status_t concat_primitive_desc_create(primitive_desc_iface_t **concat_pd_iface,
             if (d == concat_dim) continue;
             if (src_mds[i].dims[d] != dims[d]) return invalid_arguments;
         }
-        if (src_mds[i].data_type != dt) return invalid_arguments;
         concat_dim_sz += src_mds[i].dims[concat_dim];
     }
 
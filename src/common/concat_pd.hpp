@@ -41,6 +41,13 @@ struct concat_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        const int scales_arg = arg & ~DNNL_ARG_ATTR_INPUT_SCALES;
+        if ((arg & DNNL_ARG_ATTR_INPUT_SCALES)
+                && scales_arg >= DNNL_ARG_MULTIPLE_SRC
+                && scales_arg < DNNL_ARG_MULTIPLE_SRC + n_inputs()
+                && !attr()->scales_.get(scales_arg).defined())
+            return arg_usage_t::input;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -51,6 +58,18 @@ struct concat_pd_t : public primitive_desc_t {
         return primitive_desc_t::arg_md(arg);
     }
 
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::src_inplace_s32:
+                if (idx < 0 || idx >= n_inputs())
+                    return status::invalid_arguments;
+                *(int *)result = src_inplace(idx);
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
     const memory_desc_t *src_md(int index = 0) const override {
         return index < n_inputs() ? &src_mds_[index] : &glob_zero_md;
     }
@@ -67,6 +86,41 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    /* returns true if the sources are scaled, i.e. if the destination is
+     * not an exact copy of the sources */
+    bool with_scales() const { return !attr()->scales_.has_default_values(); }
+
+    /* returns true if the source `index` may be placed in the destination
+     * memory, i.e. if its memory descriptor is the one of its image in the
+     * destination and it is not scaled. Such a source is not copied if its
+     * memory is the destination one, which makes the concat a no-op if all
+     * the sources are placed in the destination. */
+    bool src_inplace(int index) const {
+        if (!attr()->scales_.get(DNNL_ARG_MULTIPLE_SRC + index)
+                        .has_default_values())
+            return false;
+
+        const int ndims = dst_md_.ndims;
+        dims_t dims, offsets = {};
+        utils::array_copy(dims, dst_md_.dims, ndims);
+        for (int i = 0; i < index; ++i)
+            offsets[concat_dim_] += src_mds_[i].dims[concat_dim_];
+        dims[concat_dim_] = src_mds_[index].dims[concat_dim_];
+
+        memory_desc_t image_md;
+        if (dnnl_memory_desc_init_submemory(&image_md, &dst_md_, dims, offsets)
+                != status::success)
+            return false;
+        return memory_desc_wrapper(image_md)
+                == memory_desc_wrapper(src_mds_[index]);
+    }
+
+    bool srcs_have_same_data_type() const {
+        for (int i = 1; i < n_; ++i)
+            if (src_mds_[i].data_type != src_mds_[0].data_type) return false;
+        return true;
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
@@ -114,7 +168,9 @@ protected:
      *
      * @warning The call may fail. */
     status_t init(const memory_desc_t *force_dst_md = nullptr) {
-        bool ok = attr()->has_default_values();
+        bool ok = attr()->has_default_values(
+                          primitive_attr_t::skip_mask_t::scales_runtime)
+                && attr_scales_ok();
         if (force_dst_md == nullptr)
             ok = ok && set_default_params() == status::success;
         if (!ok) return status::unimplemented;
@@ -215,6 +271,17 @@ protected:
         return status;
     }
 
+    /* the sources may only have a common scale each: a scale set for the
+     * argument DNNL_ARG_MULTIPLE_SRC + i multiplies the i-th source */
+    bool attr_scales_ok() const {
+        for (const auto &s : attr()->scales_.scales_) {
+            if (s.second.has_default_values()) continue;
+            const int i = s.first - DNNL_ARG_MULTIPLE_SRC;
+            if (i < 0 || i >= n_ || s.second.mask_ != 0) return false;
+        }
+        return true;
+    }
+
 private:
     void init_desc() {
         desc_ = concat_desc_t();
@@ -1102,6 +1102,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_reduction) return "reduction";
     if (v == dnnl_prelu) return "prelu";
     if (v == dnnl_softmax_v2) return "softmax_v2";
+    if (v == dnnl_layer_normalization_v2) return "layer_normalization_v2";
+    if (v == dnnl_sdpa) return "sdpa";
+    if (v == dnnl_group_normalization) return "group_normalization";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1189,6 +1192,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
+    if (v == dnnl_rnn_flags_seq_lengths) return "seq_lengths";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -126,6 +126,7 @@ PKIND_TRAITS_INST(prelu);
 PKIND_TRAITS_INST(lrn);
 PKIND_TRAITS_INST(batch_normalization);
 PKIND_TRAITS_INST(layer_normalization);
+PKIND_TRAITS_INST(layer_normalization_v2);
 PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
 PKIND_TRAITS_INST(gemm);
@@ -135,6 +136,8 @@ PKIND_TRAITS_INST(logsoftmax);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(sdpa);
+PKIND_TRAITS_INST(group_normalization);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
@@ -85,6 +85,40 @@ status_t dnnl_engine_create(
     return ef->engine_create(engine, index);
 }
 
+size_t dnnl_cpu_engine_get_numa_node_count() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (is_native_runtime(get_default_runtime(engine_kind::cpu)))
+        return (size_t)cpu::numa::get_node_count();
+#endif
+    return 0;
+}
+
+status_t dnnl_cpu_engine_create_on_numa_node(engine_t **engine, int numa_node) {
+    if (engine == nullptr) return invalid_arguments;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!is_native_runtime(get_default_runtime(engine_kind::cpu)))
+        return unimplemented;
+    if (numa_node < 0 || numa_node >= cpu::numa::get_node_count())
+        return invalid_arguments;
+    return cpu::cpu_engine_factory_t().engine_create_on_numa_node(
+            engine, numa_node);
+#else
+    UNUSED(numa_node);
+    return unimplemented;
+#endif
+}
+
+status_t dnnl_cpu_engine_get_numa_node(engine_t *engine, int *numa_node) {
+    if (any_null(engine, numa_node) || engine->kind() != engine_kind::cpu)
+        return invalid_arguments;
+    *numa_node = -1;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (is_native_runtime(engine->runtime_kind()))
+        *numa_node = utils::downcast<cpu::cpu_engine_t *>(engine)->numa_node();
+#endif
+    return success;
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     if (engine == nullptr) return invalid_arguments;
     *kind = engine->kind();
@@ -17,6 +17,8 @@
 #ifndef COMMON_ENGINE_HPP
 #define COMMON_ENGINE_HPP
 
+#include <memory>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -33,6 +35,12 @@
 #include "primitive_desc.hpp"
 #include "utils.hpp"
 
+namespace dnnl {
+namespace impl {
+struct scratchpad_pool_t;
+} // namespace impl
+} // namespace dnnl
+
 /** \brief An abstraction of an execution unit with shared resources
  *
  * Responsibilities:
@@ -95,6 +103,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         return dnnl::impl::status::success;
     }
 
+    /** return the pool of buffers for library managed scratchpads, or nullptr
+     * if scratchpads are allocated directly */
+    virtual std::shared_ptr<dnnl::impl::scratchpad_pool_t>
+    scratchpad_pool() const {
+        return nullptr;
+    }
+
     /* implementation section */
 
     /** return the list of reorder implementations. engine guarantees to return
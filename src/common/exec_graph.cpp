@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "exec_graph.hpp"
+#include "ittnotify.hpp"
+#include "primitive.hpp"
+#include "stream.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+dnnl_exec_graph::~dnnl_exec_graph() {
+    for (auto &e : entries_)
+        e.primitive_iface->release();
+}
+
+status_t dnnl_exec_graph::append(
+        primitive_iface_t *primitive_iface, exec_args_t &&args) {
+    entries_.emplace_back(
+            primitive_iface, exec_ctx_t(stream_, std::move(args)));
+    primitive_iface->retain();
+    return success;
+}
+
+status_t dnnl_exec_graph::replay() {
+    // The verbose mode, the profiling, the ITT tasks and the unpoisoning of
+    // the outputs are per primitive: the primitives are executed one by one
+    // as if they were not captured.
+    bool per_primitive = get_verbose() || stream_->profiler().is_enabled()
+            || msan_enabled;
+#if defined(DNNL_ENABLE_ITT_TASKS)
+    per_primitive = per_primitive || itt::get_itt(itt::__itt_task_level_low);
+#endif
+    if (per_primitive) {
+        for (auto &e : entries_)
+            CHECK(primitive_execute(e.primitive_iface, e.ctx));
+        return success;
+    }
+
+    status_t status = success;
+    stream_->before_exec_hook();
+    for (auto &e : entries_) {
+        status = stream_->enqueue_primitive(e.primitive_iface, e.ctx);
+        if (status != success) break;
+    }
+    stream_->after_exec_hook();
+    return status;
+}
+
+/* API */
+
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (stream == nullptr) return invalid_arguments;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(stream_t *stream, exec_graph_t **graph) {
+    if (utils::any_null(stream, graph)) return invalid_arguments;
+    return stream->end_capture(graph);
+}
+
+status_t dnnl_stream_replay(stream_t *stream, exec_graph_t *graph) {
+    if (utils::any_null(stream, graph) || graph->stream() != stream)
+        return invalid_arguments;
+    if (stream->is_capturing()) return invalid_arguments;
+    return graph->replay();
+}
+
+status_t dnnl_exec_graph_get_size(const exec_graph_t *graph, int *size) {
+    if (utils::any_null(graph, size)) return invalid_arguments;
+    *size = graph->size();
+    return success;
+}
+
+status_t dnnl_exec_graph_destroy(exec_graph_t *graph) {
+    delete graph;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
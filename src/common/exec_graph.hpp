@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EXEC_GRAPH_HPP
+#define COMMON_EXEC_GRAPH_HPP
+
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "primitive_exec_types.hpp"
+#include "utils.hpp"
+
+// Sequence of primitive executions captured in a stream.
+//
+// The arguments of every execution are converted and validated once, when
+// the execution is captured, and the execution contexts are kept for the
+// replays. A replay enqueues the primitives one after another with the
+// stream hooks run once for the whole sequence. The memory objects are
+// referenced, not copied, so changing their data handles between the replays
+// changes the data the primitives work on.
+struct dnnl_exec_graph : public dnnl::impl::c_compatible {
+    dnnl_exec_graph(dnnl::impl::stream_t *stream) : stream_(stream) {}
+    ~dnnl_exec_graph();
+
+    dnnl::impl::stream_t *stream() const { return stream_; }
+    int size() const { return (int)entries_.size(); }
+
+    // Records an execution of `primitive_iface` with `args`. The primitive
+    // is retained until the graph is destroyed.
+    dnnl::impl::status_t append(primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args);
+
+    // Executes the captured primitives in the order of their capture.
+    dnnl::impl::status_t replay();
+
+private:
+    struct entry_t {
+        entry_t(primitive_iface_t *primitive_iface,
+                dnnl::impl::exec_ctx_t &&ctx)
+            : primitive_iface(primitive_iface), ctx(std::move(ctx)) {}
+
+        primitive_iface_t *primitive_iface;
+        dnnl::impl::exec_ctx_t ctx;
+    };
+
+    dnnl::impl::stream_t *stream_;
+    std::vector<entry_t> entries_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_exec_graph);
+};
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -18,6 +18,7 @@
 #define COMMON_FLOAT16_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
@@ -129,6 +130,9 @@ inline float16_t::operator float() const {
 
 using f16_support::float16_t;
 
+void cvt_float_to_float16(float16_t *out, const float *inp, size_t nelems);
+void cvt_float16_to_float(float *out, const float16_t *inp, size_t nelems);
+
 } // namespace impl
 } // namespace dnnl
 
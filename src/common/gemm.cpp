@@ -55,6 +55,78 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     return s_;
 }
 
+// The row-major problems of the API are computed as column-major ones with
+// the matrices A and B swapped.
+template <typename a_dt>
+status_t gemm_x8s8s32_batch_strided(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const a_dt *A, dim_t lda,
+        dim_t stride_a, a_dt ao, const int8_t *B, dim_t ldb, dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dim_t ldc, dim_t stride_c,
+        const int32_t *co, dim_t batch_size) {
+    using problem_t = cpu::gemm_batch_problem_t<int8_t, a_dt, int32_t>;
+    if (batch_size > 0 && utils::any_null(A, B, C, co))
+        return status::invalid_arguments;
+    const char f_offsetc = *c2f_offsetC(&offsetc);
+    return cpu::gemm_batch<int8_t, a_dt, int32_t>(
+            batch_size, [&](dim_t i) {
+                problem_t p {};
+                p.transa = transb;
+                p.transb = transa;
+                p.offsetc = f_offsetc;
+                p.M = N;
+                p.N = M;
+                p.K = K;
+                p.alpha = alpha;
+                p.A = B + i * stride_b;
+                p.lda = ldb;
+                p.ao = bo;
+                p.B = A + i * stride_a;
+                p.ldb = lda;
+                p.bo = ao;
+                p.beta = beta;
+                p.C = C + i * stride_c;
+                p.ldc = ldc;
+                p.co = co;
+                return p;
+            });
+}
+
+template <typename a_dt>
+status_t gemm_x8s8s32_grouped(dim_t count, const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M,
+        const dim_t *N, const dim_t *K, const float *alpha,
+        const a_dt *const *A, const dim_t *lda, const a_dt *ao,
+        const int8_t *const *B, const dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dim_t *ldc,
+        const int32_t *const *co) {
+    using problem_t = cpu::gemm_batch_problem_t<int8_t, a_dt, int32_t>;
+    if (count > 0
+            && utils::any_null(transa, transb, offsetc, M, N, K, alpha, A, lda,
+                    ao, B, ldb, bo, beta, C, ldc, co))
+        return status::invalid_arguments;
+    return cpu::gemm_batch<int8_t, a_dt, int32_t>(count, [&](dim_t i) {
+        problem_t p {};
+        p.transa = transb[i];
+        p.transb = transa[i];
+        p.offsetc = *c2f_offsetC(&offsetc[i]);
+        p.M = N[i];
+        p.N = M[i];
+        p.K = K[i];
+        p.alpha = alpha[i];
+        p.A = B[i];
+        p.lda = ldb[i];
+        p.ao = bo[i];
+        p.B = A[i];
+        p.ldb = lda[i];
+        p.bo = ao[i];
+        p.beta = beta[i];
+        p.C = C[i];
+        p.ldc = ldc[i];
+        p.co = co[i];
+        return p;
+    });
+}
+
 } // namespace
 #endif
 
@@ -65,6 +137,23 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
 #define MAYBE_RUN_STACK_CHECKER(_, func, ...) func(__VA_ARGS__)
 #endif
 
+#define MAYBE_VERBOSE_BATCH(status, sdt_, wdt_, ddt_, batch_size, ...) \
+    if (get_verbose() >= 1) { \
+        double start_ms = get_msec(); \
+        status = __VA_ARGS__; \
+        double duration_ms = get_msec() - start_ms; \
+        std::stringstream ss; \
+        ss << "onednn_verbose,"; \
+        if (get_verbose_timestamp()) ss << start_ms << ","; \
+        ss << "exec,cpu,gemm_batch_api,,undef,"; \
+        ss << "src_" << sdt_ << " wei_" << wdt_ << " dst_" << ddt_ << ",,"; \
+        ss << "batch:" << batch_size; \
+        ss << "," << duration_ms << std::flush; \
+        printf("%s\n", ss.str().c_str()); \
+    } else { \
+        status = __VA_ARGS__; \
+    }
+
 #define MAYBE_VERBOSE(status, sdt_, wdt_, ddt_, ...) \
     if (get_verbose() >= 1) { \
         double start_ms = get_msec(); \
@@ -161,6 +250,147 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    using problem_t = cpu::gemm_batch_problem_t<float, float, float>;
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return dnnl_invalid_arguments;
+    auto get_problem = [&](dim_t i) {
+        problem_t p {};
+        p.transa = transb;
+        p.transb = transa;
+        p.M = N;
+        p.N = M;
+        p.K = K;
+        p.alpha = alpha;
+        p.A = B + i * stride_b;
+        p.lda = ldb;
+        p.B = A + i * stride_a;
+        p.ldb = lda;
+        p.beta = beta;
+        p.C = C + i * stride_c;
+        p.ldc = ldc;
+        return p;
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "f32", "f32", "f32", batch_size,
+            cpu::gemm_batch<float, float, float>(batch_size, get_problem));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_grouped(dim_t count, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    using problem_t = cpu::gemm_batch_problem_t<float, float, float>;
+    if (count > 0
+            && utils::any_null(transa, transb, M, N, K, alpha, A, lda, B, ldb,
+                    beta, C, ldc))
+        return dnnl_invalid_arguments;
+    auto get_problem = [&](dim_t i) {
+        problem_t p {};
+        p.transa = transb[i];
+        p.transb = transa[i];
+        p.M = N[i];
+        p.N = M[i];
+        p.K = K[i];
+        p.alpha = alpha[i];
+        p.A = B[i];
+        p.lda = ldb[i];
+        p.B = A[i];
+        p.ldb = lda[i];
+        p.beta = beta[i];
+        p.C = C[i];
+        p.ldc = ldc[i];
+        return p;
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "f32", "f32", "f32", count,
+            cpu::gemm_batch<float, float, float>(count, get_problem));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "u8", "s8", "s32", batch_size,
+            gemm_x8s8s32_batch_strided(transa, transb, offsetc, M, N, K, alpha,
+                    A, lda, stride_a, ao, B, ldb, stride_b, bo, beta, C, ldc,
+                    stride_c, co, batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_grouped(dim_t count, const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M,
+        const dim_t *N, const dim_t *K, const float *alpha,
+        const uint8_t *const *A, const dim_t *lda, const uint8_t *ao,
+        const int8_t *const *B, const dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dim_t *ldc,
+        const int32_t *const *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "u8", "s8", "s32", count,
+            gemm_x8s8s32_grouped(count, transa, transb, offsetc, M, N, K,
+                    alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "s8", "s8", "s32", batch_size,
+            gemm_x8s8s32_batch_strided(transa, transb, offsetc, M, N, K, alpha,
+                    A, lda, stride_a, ao, B, ldb, stride_b, bo, beta, C, ldc,
+                    stride_c, co, batch_size));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_grouped(dim_t count, const char *transa,
+        const char *transb, const char *offsetc, const dim_t *M,
+        const dim_t *N, const dim_t *K, const float *alpha,
+        const int8_t *const *A, const dim_t *lda, const int8_t *ao,
+        const int8_t *const *B, const dim_t *ldb, const int8_t *bo,
+        const float *beta, int32_t *const *C, const dim_t *ldc,
+        const int32_t *const *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, "s8", "s8", "s32", count,
+            gemm_x8s8s32_grouped(count, transa, transb, offsetc, M, N, K,
+                    alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -225,5 +455,6 @@ extern "C" dnnl_status_t DNNL_API dnnl_threadpool_interop_gemm_bf16bf16f32(
 }
 
 #undef MAYBE_VERBOSE
+#undef MAYBE_VERBOSE_BATCH
 
 #endif
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -81,6 +81,9 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(reduction),
             CASE(prelu),
             CASE(softmax_v2),
+            CASE(layer_normalization_v2),
+            CASE(sdpa),
+            CASE(group_normalization),
     };
 #undef CASE
     int kind_idx = (int)kind;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -29,9 +29,9 @@ namespace impl {
 struct layer_normalization_fwd_pd_t;
 
 struct layer_normalization_pd_t : public primitive_desc_t {
-    static constexpr auto base_pkind = primitive_kind::layer_normalization;
+    static constexpr auto base_pkind = primitive_kind::layer_normalization_v2;
 
-    const layer_normalization_desc_t *desc() const { return &desc_; }
+    const layer_normalization_v2_desc_t *desc() const { return &desc_; }
     const op_desc_t *op_desc() const override {
         return reinterpret_cast<const op_desc_t *>(this->desc());
     }
@@ -42,7 +42,15 @@ struct layer_normalization_pd_t : public primitive_desc_t {
                 *(prop_kind_t *)result = desc()->prop_kind;
                 break;
             case query::layer_normalization_d:
-                *(const layer_normalization_desc_t **)result = desc();
+                *(const layer_normalization_desc_t **)result
+                        = reinterpret_cast<const layer_normalization_desc_t *>(
+                                desc());
+                break;
+            case query::layer_normalization_v2_d:
+                *(const layer_normalization_v2_desc_t **)result = desc();
+                break;
+            case query::primitive_kind:
+                *(primitive_kind_t *)result = desc()->primitive_kind;
                 break;
             default: return primitive_desc_t::query(what, idx, result);
         }
@@ -50,11 +58,11 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     }
 
     /* common layer_normalization aux functions */
-    int ndims() const { return desc_.data_desc.ndims; }
+    int ndims() const { return desc_.src_desc.ndims; }
     dim_t across_axis() const {
-        return utils::array_product(desc_.data_desc.dims, ndims() - 1);
+        return utils::array_product(desc_.src_desc.dims, ndims() - 1);
     }
-    dim_t norm_axis() const { return desc_.data_desc.dims[ndims() - 1]; }
+    dim_t norm_axis() const { return desc_.src_desc.dims[ndims() - 1]; }
 
     bool stats_are_src() const { return desc_.flags & dnnl_use_global_stats; }
     bool stats_are_tmp() const { return !(stats_are_src() || is_training()); }
@@ -76,26 +84,26 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     }
 
     bool has_zero_dim_memory() const {
-        return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim();
     }
 
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
 protected:
-    layer_normalization_desc_t desc_;
+    layer_normalization_v2_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
 
-    memory_desc_t data_md_;
+    memory_desc_t src_md_;
     memory_desc_t stat_md_;
     memory_desc_t scaleshift_md_;
 
-    layer_normalization_pd_t(const layer_normalization_desc_t *adesc,
+    layer_normalization_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
         : primitive_desc_t(attr, base_pkind)
-        , desc_(*adesc)
+        , desc_(cast_lnorm_v1_to_v2(*adesc))
         , hint_fwd_pd_(hint_fwd_pd)
-        , data_md_(desc_.data_desc)
+        , src_md_(desc_.src_desc)
         , stat_md_(desc_.stat_desc)
         , scaleshift_md_(desc_.data_scaleshift_desc) {}
 
@@ -123,7 +131,27 @@ protected:
     }
 
 private:
-    const memory_desc_t &data_desc() const { return desc_.data_desc; }
+    layer_normalization_v2_desc_t cast_lnorm_v1_to_v2(
+            const layer_normalization_v2_desc_t &lnorm_desc) const {
+        if (lnorm_desc.primitive_kind == primitive_kind::layer_normalization_v2)
+            return lnorm_desc;
+
+        layer_normalization_v2_desc_t lnorm_v2_desc;
+        lnorm_v2_desc.primitive_kind = lnorm_desc.primitive_kind;
+        lnorm_v2_desc.prop_kind = lnorm_desc.prop_kind;
+        lnorm_v2_desc.src_desc = lnorm_desc.src_desc;
+        lnorm_v2_desc.diff_src_desc = lnorm_desc.diff_src_desc;
+        lnorm_v2_desc.data_scaleshift_desc = lnorm_desc.data_scaleshift_desc;
+        lnorm_v2_desc.diff_data_scaleshift_desc
+                = lnorm_desc.diff_data_scaleshift_desc;
+        lnorm_v2_desc.stat_desc = lnorm_desc.stat_desc;
+        lnorm_v2_desc.layer_norm_epsilon = lnorm_desc.layer_norm_epsilon;
+        lnorm_v2_desc.flags = lnorm_desc.flags;
+        lnorm_v2_desc.dst_desc = lnorm_desc.src_desc;
+        lnorm_v2_desc.diff_dst_desc = lnorm_desc.diff_src_desc;
+
+        return lnorm_v2_desc;
+    }
 };
 
 struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
@@ -164,13 +192,13 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
+        if (index == 0) return &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
         return &glob_zero_md;
     }
 
     const memory_desc_t *dst_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
+        if (index == 0) return &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
         return &glob_zero_md;
@@ -189,13 +217,29 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
 protected:
-    layer_normalization_fwd_pd_t(const layer_normalization_desc_t *adesc,
+    memory_desc_t dst_md_;
+
+    layer_normalization_fwd_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
-        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd) {}
+        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
+        , dst_md_(desc_.dst_desc) {}
 
     bool set_default_formats_common() {
-        return set_default_stat_md_format(data_md_);
+        return IMPLICATION(dst_md_.format_kind == format_kind::any,
+                       memory_desc_init_by_md_and_dt(
+                               dst_md_, src_md_, dst_md_.data_type)
+                               == status::success)
+                && set_default_stat_md_format(src_md_);
+    }
+
+    // Output scales and post-ops are only supported by the version 2
+    // descriptor; the scales are common to the whole destination.
+    bool attr_oscale_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        const bool ok = IMPLICATION(desc()->primitive_kind != base_pkind,
+                oscale.has_default_values());
+        return ok && oscale.mask_ == 0;
     }
 
     bool check_scale_shift_data_type() const {
@@ -248,16 +292,16 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
+        return index == 0 ? &src_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
     }
     const memory_desc_t *dst_md(int index = 0) const override {
-        return (index == 0) ? &data_md_ : &glob_zero_md;
+        return (index == 0) ? &src_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_dst_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        return index == 0 ? &diff_dst_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_src_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        return index == 0 ? &diff_src_md_ : &glob_zero_md;
     }
 
     const memory_desc_t *weights_md(int index = 0) const override {
@@ -277,22 +321,28 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
 protected:
-    memory_desc_t diff_data_md_;
+    memory_desc_t diff_src_md_;
+    memory_desc_t diff_dst_md_;
     memory_desc_t diff_scaleshift_md_;
 
-    layer_normalization_bwd_pd_t(const layer_normalization_desc_t *adesc,
+    layer_normalization_bwd_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
         : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
-        , diff_data_md_(desc_.diff_data_desc)
+        , diff_src_md_(desc_.diff_src_desc)
+        , diff_dst_md_(desc_.diff_dst_desc)
         , diff_scaleshift_md_(desc_.diff_data_scaleshift_desc) {}
 
     bool set_default_formats_common() {
-        return IMPLICATION(diff_data_md_.format_kind == format_kind::any,
+        return IMPLICATION(diff_dst_md_.format_kind == format_kind::any,
                        memory_desc_init_by_md_and_dt(
-                               diff_data_md_, data_md_, diff_data_md_.data_type)
+                               diff_dst_md_, src_md_, diff_dst_md_.data_type)
                                == status::success)
-                && set_default_stat_md_format(diff_data_md_);
+                && IMPLICATION(diff_src_md_.format_kind == format_kind::any,
+                        memory_desc_init_by_md_and_dt(
+                                diff_src_md_, src_md_, diff_src_md_.data_type)
+                                == status::success)
+                && set_default_stat_md_format(diff_src_md_);
     }
 
     bool check_scale_shift_data_type() const {
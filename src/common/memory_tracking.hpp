@@ -170,6 +170,7 @@ enum {
     key_concat_istrides,
     key_concat_nelems,
     key_concat_optrs,
+    key_concat_scales,
     key_concat_tent_dst,
     key_conv_adjusted_scales,
     key_conv_amx_inp_buffer,
@@ -220,6 +221,10 @@ enum {
     key_gemm_int_c_in_acc_dt,
     key_gemm_tmp_buffer,
     key_gemm_flag,
+    key_gnorm_coef,
+    key_gnorm_reduction,
+    key_gnorm_tmp_mean,
+    key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -262,6 +267,11 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_keys_packed,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_values_packed,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "common/engine.hpp"
+#include "common/persistent_cache.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+// Bump the version when the file layout changes.
+constexpr uint32_t file_magic = 0x4b434e44; // "DNCK"
+constexpr uint32_t file_version = 2;
+
+std::string get_file_name(
+        const std::string &dir, const std::vector<uint8_t> &id) {
+    size_t seed = 0;
+    for (auto b : id)
+        seed = hash_combine(seed, b);
+
+    char name[32];
+    snprintf(name, sizeof(name), "onednn_%016llx.blob",
+            (unsigned long long)seed);
+#ifdef _WIN32
+    const char sep = '\\';
+#else
+    const char sep = '/';
+#endif
+    return dir + sep + name;
+}
+
+// FNV-1a hash of the blob to detect damaged entries before any of their code
+// is used.
+uint64_t get_checksum(const std::vector<uint8_t> &blob) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (auto b : blob) {
+        h ^= b;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+bool read_data(FILE *f, void *data, size_t size) {
+    return fread(data, 1, size, f) == size;
+}
+
+bool write_data(FILE *f, const void *data, size_t size) {
+    return fwrite(data, 1, size, f) == size;
+}
+
+} // namespace
+
+bool is_enabled(const engine_t *engine) {
+    return engine->kind() == engine_kind::cpu && !get_jit_cache_dir().empty();
+}
+
+status_t load(const primitive_desc_t *pd, engine_t *engine,
+        std::vector<uint8_t> &blob) {
+    const auto dir = get_jit_cache_dir();
+    const auto &id = pd->get_cache_blob_id(engine);
+    if (dir.empty() || id.empty()) return status::unimplemented;
+
+    FILE *f = fopen(get_file_name(dir, id).c_str(), "rb");
+    if (!f) return status::runtime_error;
+
+    uint32_t magic = 0, version = 0;
+    size_t id_size = 0, blob_size = 0;
+    std::vector<uint8_t> file_id;
+    bool ok = read_data(f, &magic, sizeof(magic))
+            && read_data(f, &version, sizeof(version)) && magic == file_magic
+            && version == file_version
+            && read_data(f, &id_size, sizeof(id_size)) && id_size == id.size();
+    if (ok) {
+        file_id.resize(id_size);
+        ok = read_data(f, file_id.data(), id_size) && file_id == id
+                && read_data(f, &blob_size, sizeof(blob_size))
+                && blob_size > 0;
+    }
+    if (ok) {
+        uint64_t checksum = 0;
+        blob.resize(blob_size);
+        ok = read_data(f, blob.data(), blob_size)
+                && read_data(f, &checksum, sizeof(checksum))
+                && checksum == get_checksum(blob);
+    }
+    fclose(f);
+
+    if (!ok) {
+        blob.clear();
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+status_t store(const primitive_desc_t *pd, engine_t *engine,
+        const primitive_t &primitive) {
+    const auto dir = get_jit_cache_dir();
+    const auto &id = pd->get_cache_blob_id(engine);
+    if (dir.empty() || id.empty()) return status::unimplemented;
+
+    size_t blob_size = 0;
+    CHECK(primitive.get_cache_blob_size(&blob_size));
+    if (blob_size == 0) return status::unimplemented;
+
+    std::vector<uint8_t> blob(blob_size);
+    cache_blob_t cb(blob.data(), blob_size);
+    CHECK(primitive.get_cache_blob(engine, cb));
+
+    // Each writer uses its own temporary file, the last rename wins.
+    static std::atomic<size_t> counter(0);
+    size_t tmp_id = hash_combine(
+            std::hash<std::thread::id>()(std::this_thread::get_id()),
+            (size_t)std::chrono::steady_clock::now()
+                    .time_since_epoch()
+                    .count());
+    tmp_id = hash_combine(tmp_id, counter++);
+
+    const auto file_name = get_file_name(dir, id);
+    const auto tmp_name = file_name + "." + std::to_string(tmp_id) + ".tmp";
+
+    FILE *f = fopen(tmp_name.c_str(), "wb");
+    if (!f) return status::runtime_error;
+
+    const size_t id_size = id.size();
+    const uint64_t checksum = get_checksum(blob);
+    bool ok = write_data(f, &file_magic, sizeof(file_magic))
+            && write_data(f, &file_version, sizeof(file_version))
+            && write_data(f, &id_size, sizeof(id_size))
+            && write_data(f, id.data(), id_size)
+            && write_data(f, &blob_size, sizeof(blob_size))
+            && write_data(f, blob.data(), blob_size)
+            && write_data(f, &checksum, sizeof(checksum));
+    ok = (fclose(f) == 0) && ok;
+
+    if (!ok || std::rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+        std::remove(tmp_name.c_str());
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
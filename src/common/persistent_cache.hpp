@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_t;
+struct primitive_desc_t;
+
+// Directory-backed storage of cache blobs of CPU primitives, enabled with
+// dnnl_set_jit_cache_dir() or ONEDNN_JIT_CACHE_DIR.
+//
+// The cache blob ID of a primitive descriptor is the key. A file name is
+// derived from the hash of the ID, and the full ID is stored in the file to
+// detect collisions. A checksum of the blob rejects damaged entries. Files are
+// written to a temporary location first and then renamed, so concurrent
+// processes never observe partially written entries.
+namespace persistent_cache {
+
+bool is_enabled(const engine_t *engine);
+
+status_t load(const primitive_desc_t *pd, engine_t *engine,
+        std::vector<uint8_t> &blob);
+
+status_t store(const primitive_desc_t *pd, engine_t *engine,
+        const primitive_t &primitive);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
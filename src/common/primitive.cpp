@@ -124,18 +124,27 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
-    if (get_verbose()) {
+    const bool profile = stream->profiler().is_enabled();
+    if (get_verbose() || profile) {
         stream->wait();
         double start_ms = get_msec();
+        if (profile)
+            stream->profiler().start(primitive_iface->pd()->impl().get(),
+                    primitive_iface->pd()->info());
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
+        if (profile) stream->profiler().stop();
         double duration_ms = get_msec() - start_ms;
-        std::string stamp;
-        if (get_verbose_timestamp()) stamp = "," + std::to_string(start_ms);
 
-        printf("onednn_verbose%s,exec,%s,%g\n", stamp.c_str(),
-                primitive_iface->pd()->info(), duration_ms);
-        fflush(stdout);
+        if (get_verbose()) {
+            std::string stamp;
+            if (get_verbose_timestamp())
+                stamp = "," + std::to_string(start_ms);
+
+            printf("onednn_verbose%s,exec,%s,%g\n", stamp.c_str(),
+                    primitive_iface->pd()->info(), duration_ms);
+            fflush(stdout);
+        }
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -190,9 +199,7 @@ status_t dnnl_primitive_create_from_cache_blob(
     }
     const auto ekind = primitive_desc_iface->engine()->kind();
     const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (ekind == engine_kind::gpu && runtime_kind != runtime_kind::ocl) {
         return status::unimplemented;
     }
 
@@ -213,6 +220,12 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
             primitive_iface->pd()->impl().get(), nargs, c_args, args);
     if (status != status::success) return status;
 
+    // The captured primitive is retained by the graph.
+    if (stream->is_capturing())
+        return stream->capture(
+                const_cast<primitive_iface_t *>(primitive_iface),
+                std::move(args));
+
     exec_ctx_t ctx(stream, std::move(args));
 #ifdef DNNL_ENABLE_STACK_CHECKER
     stack_checker::stack_checker_t sc("dnnl_primitive_execute");
@@ -243,9 +256,7 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
 
     const auto ekind = primitive_iface->engine()->kind();
     const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (ekind == engine_kind::gpu && runtime_kind != runtime_kind::ocl) {
         return status::unimplemented;
     }
 
@@ -26,11 +26,13 @@
 #include "cache_blob.hpp"
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
+#include "persistent_cache.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_exec_types.hpp"
 #include "rw_mutex.hpp"
 #include "scratchpad.hpp"
 
+#include <chrono>
 #include <future>
 #include <type_traits>
 
@@ -50,7 +52,10 @@ struct primitive_t : public c_compatible {
     status_t init(engine_t *engine, bool use_global_scratchpad,
             const cache_blob_t &cache_blob) {
         cache_blob_ = cache_blob;
-        CHECK(init(engine));
+        {
+            host_binaries_scope_t scope(cache_blob_, host_binaries_);
+            CHECK(init(engine));
+        }
         CHECK(init_cached_resource(engine));
         use_global_scratchpad_ = use_global_scratchpad;
         // The `cache_blob_` is no longer needed after primitive creation.
@@ -62,15 +67,16 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // By default a cache blob consists of binaries of the kernels generated
+    // on the host during primitive initialization.
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return host_binaries_.get_cache_blob(cache_blob);
     }
 
     virtual status_t get_cache_blob_size(size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        if (!size) return status::invalid_arguments;
+        return host_binaries_.get_cache_blob_size(size);
     }
 
     virtual status_t create_resource(
@@ -98,6 +104,14 @@ struct primitive_t : public c_compatible {
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
     cache_blob_t cache_blob() const { return cache_blob_; }
 
+    // Returns the number of bytes the primitive keeps alive while it is held
+    // by the primitive cache. The base estimate covers only the code generated
+    // on the host during the initialization, implementations that own
+    // sizable descriptors, tables or binaries must override it.
+    virtual size_t get_resident_size() const {
+        return sizeof(*this) + host_binaries_.code_size();
+    }
+
 protected:
     template <typename impl_type, typename pd_t>
     static status_t create_primitive_common(
@@ -130,8 +144,30 @@ protected:
             // The requested primitive is NOT present in the cache therefore
             // we have to create it and notify the waiting threads
             // once the creation is done.
-            p = std::make_shared<impl_type>(pd);
-            status = p->init(engine, use_global_scratchpad, cache_blob);
+            // The persistent cache is used only when the user didn't provide
+            // a cache blob. A broken or stale entry is not an error, the
+            // primitive is then created from scratch and the entry updated.
+            const auto creation_start = std::chrono::steady_clock::now();
+            const bool use_persistent_cache
+                    = !cache_blob && persistent_cache::is_enabled(engine);
+            std::vector<uint8_t> blob;
+            if (use_persistent_cache
+                    && persistent_cache::load(pd, engine, blob)
+                            == status::success) {
+                p = std::make_shared<impl_type>(pd);
+                status = p->init(engine, use_global_scratchpad,
+                        cache_blob_t(blob.data(), blob.size()));
+            }
+            if (!p || status != status::success) {
+                p = std::make_shared<impl_type>(pd);
+                status = p->init(engine, use_global_scratchpad, cache_blob);
+                if (status == status::success && use_persistent_cache)
+                    persistent_cache::store(pd, engine, *p);
+            }
+            global_primitive_cache.add_creation_time(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - creation_start)
+                            .count());
             if (status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, status});
@@ -153,8 +189,9 @@ protected:
                 // op_desc and attr that reside in the coppied pd
                 // in the primitive_t.
                 // Therefore the pointers in the key, which has already been put
-                // into the cache, must be updated.
-                global_primitive_cache.update_entry(key, p->pd().get());
+                // into the cache, must be updated. The resident size of the
+                // entry is known at this point as well.
+                global_primitive_cache.update_entry(key, p.get());
             }
         }
         primitive = std::make_pair(p, is_from_cache);
@@ -164,6 +201,7 @@ protected:
     std::shared_ptr<primitive_desc_t> pd_;
     bool use_global_scratchpad_;
     cache_blob_t cache_blob_;
+    host_binaries_t host_binaries_;
 
 private:
     primitive_t() = delete;
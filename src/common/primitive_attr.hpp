@@ -253,6 +253,9 @@ private:
         for (const auto &sa : {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1}) {
             if (arg == sa) return true;
         }
+        // Sources of the concat primitive
+        if (arg >= DNNL_ARG_MULTIPLE_SRC && arg < DNNL_ARG_MULTIPLE_DST)
+            return true;
         return false;
     }
 };
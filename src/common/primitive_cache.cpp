@@ -18,7 +18,6 @@
 #include "c_types_map.hpp"
 #include "primitive.hpp"
 #include "primitive_desc.hpp"
-#include "rw_mutex.hpp"
 #include "z_magic.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -28,7 +27,10 @@
 #endif
 
 #include <algorithm>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -56,7 +58,12 @@ primitive_cache_t &primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static lru_primitive_cache_t cache(capacity);
+    // The byte budget is set in megabytes to fit an int.
+    static const size_t capacity_bytes
+            = (size_t)nstl::max(0,
+                      getenv_int_user("PRIMITIVE_CACHE_CAPACITY_MB", 0))
+            << 20;
+    static lru_primitive_cache_t cache(capacity, capacity_bytes);
     return cache;
 }
 
@@ -88,206 +95,310 @@ size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     return old_capacity;
 }
 
+constexpr int lru_primitive_cache_t::n_shards;
+constexpr int lru_primitive_cache_t::min_shard_capacity;
+
 status_t lru_primitive_cache_t::set_capacity(int capacity) {
-    utils::lock_write_t lock_w(rw_mutex());
+    lock_all();
     capacity_ = (size_t)capacity;
-    // Check if number of entries exceeds the new capacity
-    if (cache_mapper().size() > capacity_) {
-        // Evict excess entries
-        size_t n_excess_entries = cache_mapper().size() - capacity_;
-        evict(n_excess_entries);
-    }
+    // Evict excess entries if the number of entries exceeds the new capacity
+    distribute();
+    unlock_all();
     return status::success;
 }
 
 int lru_primitive_cache_t::get_capacity() const {
-    utils::lock_read_t lock_r(rw_mutex());
     return (int)capacity_;
 }
 
+status_t lru_primitive_cache_t::set_capacity_bytes(size_t capacity_bytes) {
+    lock_all();
+    capacity_bytes_ = capacity_bytes;
+    distribute();
+    unlock_all();
+    return status::success;
+}
+
+size_t lru_primitive_cache_t::get_capacity_bytes() const {
+    return capacity_bytes_;
+}
+
 // For undocumented API
 int lru_primitive_cache_t::get_size() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)cache_mapper().size();
+    return (int)size_;
+}
+
+void lru_primitive_cache_t::add_creation_time(uint64_t time_ns) {
+    creation_time_ns_ += time_ns;
+}
+
+lru_primitive_cache_t::stats_t lru_primitive_cache_t::get_stats() const {
+    stats_t stats;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    stats.entries = size_;
+    stats.resident_bytes = resident_bytes_;
+    stats.creation_time_ns = creation_time_ns_;
+    return stats;
+}
+
+void lru_primitive_cache_t::reset_stats() {
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+    creation_time_ns_ = 0;
+}
+
+lru_primitive_cache_t::shard_t &lru_primitive_cache_t::get_shard(
+        const key_t &key) const {
+    // Use the high bits of the hash to pick a shard, the low ones are used
+    // for bucket selection inside the shard hash table.
+    const size_t hash = std::hash<key_t>()(key);
+    const size_t idx = (hash >> (sizeof(size_t) * 8 - 8))
+            % n_active_shards_.load(std::memory_order_acquire);
+    return shards_[idx];
+}
+
+std::unique_lock<std::mutex> lru_primitive_cache_t::lock_shard(
+        const key_t &key, shard_t *&shard) {
+    while (true) {
+        shard = &get_shard(key);
+        std::unique_lock<std::mutex> lock(shard->mutex_);
+        // The number of shards changes with all shards locked only, so the
+        // shard stays the one of the key while its lock is held.
+        if (shard == &get_shard(key)) return lock;
+    }
+}
+
+void lru_primitive_cache_t::lock_all() const {
+    for (int i = 0; i < n_shards; i++)
+        shards_[i].mutex_.lock();
+}
+
+void lru_primitive_cache_t::unlock_all() const {
+    for (int i = n_shards - 1; i >= 0; i--)
+        shards_[i].mutex_.unlock();
 }
 
 lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
         const key_t &key, const value_t &value) {
-    // 1. Section with shared access (read lock)
-    lock_read();
     // Check if the cache is enabled.
     if (capacity_ == 0) {
-        unlock_read();
+        misses_++;
         return value_t();
     }
-    // Check if the requested entry is present in the cache (likely cache_hit)
-    auto e = get(key);
-    if (e.valid()) {
-        unlock_read();
-        return e;
-    }
 
-    unlock_read();
+    shard_t *shard = nullptr;
+    auto lock = lock_shard(key, shard);
 
-    // 2. Section with exclusive access (write lock).
-    // In a multithreaded scenario, in the context of one thread the cache
-    // may have changed by another thread between releasing the read lock and
-    // acquiring the write lock (a.k.a. ABA problem), therefore additional
-    // checks have to be performed for correctness.
-    // Double check the capacity due to possible race condition
-    lock_write();
-    if (capacity_ == 0) {
-        unlock_write();
-        return value_t();
+    // Check if the requested entry is present in the cache (cache_hit)
+    auto *e = shard->get(key);
+    if (e) {
+        hits_++;
+        return e->value_;
     }
 
-    // Double check if the requested entry is present in the cache (unlikely
-    // cache_hit).
-    e = get(key);
-    if (!e.valid()) {
-        // If the entry is missing in the cache then add it (cache_miss)
-        add(key, value);
-    }
-    unlock_write();
-    return e;
+    // If the entry is missing in the cache then add it (cache_miss)
+    misses_++;
+    add(*shard, key, value, get_timestamp());
+    evict(*shard);
+    return value_t();
 }
 
-void lru_primitive_cache_t::add(const key_t &key, const value_t &value) {
-    // std::list::size() method has linear complexity. Check the primitive cache
-    // size using std::unordered_map::size();
-    if (cache_mapper().size() == capacity_) {
-        // Evict the least recently used entry
-        evict(1);
-    }
+void lru_primitive_cache_t::erase(
+        shard_t &shard, shard_t::mapper_t::iterator it) {
+    const size_t resident_size = it->second.resident_size_;
+    shard.resident_bytes_ -= resident_size;
+    resident_bytes_ -= resident_size;
+    shard.size_--;
+    size_--;
+    shard.erase(it);
+}
 
-    size_t timestamp = get_timestamp();
+void lru_primitive_cache_t::add(shard_t &shard, const key_t &key,
+        const value_t &value, size_t timestamp) {
+    shard.add(key, value, timestamp);
+    shard.size_++;
+    size_++;
+}
 
-    auto res = cache_mapper().emplace(std::piecewise_construct,
+lru_primitive_cache_t::entry_t *lru_primitive_cache_t::shard_t::get(
+        const key_t &key) {
+    auto it = mapper_.find(key);
+    if (it == mapper_.end()) return nullptr;
+
+    auto *e = &it->second;
+    e->timestamp_ = get_timestamp();
+    if (e != head_) {
+        unlink(e);
+        push_front(e);
+    }
+    return e;
+}
+
+void lru_primitive_cache_t::shard_t::add(
+        const key_t &key, const value_t &value, size_t timestamp) {
+    auto res = mapper_.emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
             std::forward_as_tuple(value, timestamp));
-    MAYBE_UNUSED(res);
     assert(res.second);
+
+    auto *e = &res.first->second;
+    e->key_ = &res.first->first;
+    push_front(e);
+}
+
+void lru_primitive_cache_t::shard_t::erase(mapper_t::iterator it) {
+    unlink(&it->second);
+    mapper_.erase(it);
 }
 
-lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) return value_t();
+void lru_primitive_cache_t::shard_t::unlink(entry_t *e) {
+    if (e->prev_)
+        e->prev_->next_ = e->next_;
+    else
+        head_ = e->next_;
+    if (e->next_)
+        e->next_->prev_ = e->prev_;
+    else
+        tail_ = e->prev_;
+    e->prev_ = e->next_ = nullptr;
+}
 
-    size_t timestamp = get_timestamp();
-    it->second.timestamp_.store(timestamp);
-    // Return the entry
-    return it->second.value_;
+void lru_primitive_cache_t::shard_t::push_front(entry_t *e) {
+    e->prev_ = nullptr;
+    e->next_ = head_;
+    if (head_) head_->prev_ = e;
+    head_ = e;
+    if (!tail_) tail_ = e;
 }
 
 std::shared_ptr<primitive_desc_t> lru_primitive_cache_t::get_pd(
         const key_t &key) {
-    lock_read();
-    if (capacity_ == 0) {
-        unlock_read();
-        return nullptr;
+    if (capacity_ == 0) return nullptr;
+
+    value_t e;
+    {
+        shard_t *shard = nullptr;
+        auto lock = lock_shard(key, shard);
+        auto *entry = shard->get(key);
+        if (entry) e = entry->value_;
     }
-    auto e = get(key);
-    unlock_read();
 
     if (e.valid()) return e.get().primitive->pd();
     return nullptr;
 }
 
 void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
-    lock_write();
+    if (capacity_ == 0) return;
 
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
+    shard_t *shard = nullptr;
+    auto lock = lock_shard(key, shard);
 
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) {
-        // The entry has been already evicted at this point
-        unlock_write();
-        return;
-    }
+    auto it = shard->mapper_.find(key);
+    // The entry has been already evicted at this point
+    if (it == shard->mapper_.end()) return;
 
     const auto &value = it->second.value_;
-    if (value.get().primitive) {
-        // If the entry is not invalidated
-        unlock_write();
-        return;
-    }
+    // If the entry is not invalidated
+    if (value.get().primitive) return;
 
     // Remove the invalidated entry
-    cache_mapper().erase(it);
-    unlock_write();
+    erase(*shard, it);
 }
 
 void lru_primitive_cache_t::update_entry(
-        const key_t &key, const primitive_desc_t *pd) {
-    lock_write();
+        const key_t &key, const primitive_t *p) {
+    if (capacity_ == 0) return;
 
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
+    shard_t *shard = nullptr;
+    auto lock = lock_shard(key, shard);
 
-    auto it = cache_mapper().find(key);
+    auto it = shard->mapper_.find(key);
 
     // There is nothing to do in two cases:
     // 1. The requested entry is not in the cache because it has been evicted
     //    by another thread
     // 2. After the requested entry had been evicted it was inserted again
     //    by another thread
-    if (it == cache_mapper().end()
-            || it->first.thread_id() != key.thread_id()) {
-        unlock_write();
+    if (it == shard->mapper_.end()
+            || it->first.thread_id() != key.thread_id())
         return;
-    }
 
+    const auto *pd = p->pd().get();
     const auto *op_desc = pd->op_desc();
     const auto *attr = pd->attr();
 
-    // Update key in cache_mapper()
+    // Update key in the shard mapper
     it->first.op_desc_ = op_desc;
     it->first.attr_ = attr;
-    unlock_write();
-}
 
-// Evicts n the least recently used entries
-void lru_primitive_cache_t::evict(size_t n) {
-    using v_t = std::unordered_map<key_t, timed_entry_t>::value_type;
+    // Account the size of the created primitive
+    const size_t resident_size = p->get_resident_size();
+    it->second.resident_size_ = resident_size;
+    shard->resident_bytes_ += resident_size;
+    resident_bytes_ += resident_size;
+    evict(*shard);
+}
 
-    if (n == capacity_) {
-        cache_mapper().clear();
-        return;
+void lru_primitive_cache_t::evict(shard_t &shard) {
+    while (shard.tail_ && shard.is_over_budget()) {
+        auto it = shard.mapper_.find(*shard.tail_->key_);
+        assert(it != shard.mapper_.end());
+        erase(shard, it);
+        evictions_++;
     }
+}
 
-    for (size_t e = 0; e < n; e++) {
-        // Find the smallest timestamp
-        // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-        // maybe evict multiple entries at once.
-        auto it = std::min_element(cache_mapper().begin(), cache_mapper().end(),
-                [&](const v_t &left, const v_t &right) {
-                    // By default, load() and operator T use sequentially
-                    // consistent memory ordering, which enforces writing the
-                    // timestamps into registers in the same exact order they
-                    // are read from the CPU cache line. Since eviction is
-                    // performed under a write lock, this order is not
-                    // important, therefore we can safely use the weakest memory
-                    // ordering (relaxed). This brings about a few microseconds
-                    // performance improvement for default primitive cache
-                    // capacity.
-                    return left.second.timestamp_.load(
-                                   std::memory_order_relaxed)
-                            < right.second.timestamp_.load(
-                                    std::memory_order_relaxed);
+void lru_primitive_cache_t::distribute() {
+    const int n = (int)nstl::max((size_t)1,
+            nstl::min((size_t)n_shards, capacity_ / min_shard_capacity));
+
+    if (n != n_active_shards_) {
+        // Move the entries to the new shards from the least recently used to
+        // the most recently used one to keep their order.
+        std::vector<std::pair<key_t, entry_t>> entries;
+        for (int i = 0; i < n_active_shards_; i++) {
+            auto &shard = shards_[i];
+            for (auto *e = shard.tail_; e; e = e->prev_)
+                entries.emplace_back(*e->key_, *e);
+            shard.mapper_.clear();
+            shard.head_ = shard.tail_ = nullptr;
+            shard.size_ = 0;
+            shard.resident_bytes_ = 0;
+        }
+        std::stable_sort(entries.begin(), entries.end(),
+                [](const std::pair<key_t, entry_t> &a,
+                        const std::pair<key_t, entry_t> &b) {
+                    return a.second.timestamp_ < b.second.timestamp_;
                 });
-        auto res = cache_mapper().erase(it->first);
-        MAYBE_UNUSED(res);
-        assert(res);
+
+        n_active_shards_.store(n, std::memory_order_release);
+        for (const auto &kv : entries) {
+            auto &shard = get_shard(kv.first);
+            shard.add(kv.first, kv.second.value_, kv.second.timestamp_);
+            shard.mapper_.find(kv.first)->second.resident_size_
+                    = kv.second.resident_size_;
+            shard.size_++;
+            shard.resident_bytes_ += kv.second.resident_size_;
+        }
+    }
+
+    for (int i = 0; i < n_shards; i++) {
+        auto &shard = shards_[i];
+        shard.capacity_ = i < n ? capacity_ / n + (i < (int)(capacity_ % n))
+                                : 0;
+        shard.capacity_bytes_ = i < n ? capacity_bytes_ / n : 0;
+        // A non-zero budget stays non-zero for every shard.
+        if (capacity_bytes_ != 0 && shard.capacity_bytes_ == 0)
+            shard.capacity_bytes_ = 1;
+        evict(shard);
     }
 }
 
 lru_primitive_cache_t::~lru_primitive_cache_t() {
-    if (cache_mapper().empty()) return;
+    if (size_ == 0) return;
 
 // The library unloading issue affects only Windows and
 // DPCPP and OpenCL runtimes when DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE is ON.
@@ -302,7 +413,7 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
     HMODULE handle = LoadLibraryExA(
             "ntdll.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
     if (!handle) {
-        cache_mapper_.release();
+        shards_.release();
         return;
     }
 
@@ -315,7 +426,7 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         auto ret = FreeLibrary(handle);
         assert(ret);
         MAYBE_UNUSED(ret);
-        cache_mapper_.release();
+        shards_.release();
         return;
     }
 
@@ -329,16 +440,19 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         // The whole process is being terminated hence destroying content of
         // the primitive cache cannot be done safely. However we can check
         // all entries and remove those that are not affected e.g. native CPU.
-        for (auto it = cache_mapper().begin(); it != cache_mapper().end();) {
-            const auto &engine_id = it->first.engine_id_;
-            if (engine_id.kind() == engine_kind::cpu
-                    && is_native_runtime(engine_id.runtime_kind())) {
-                it = cache_mapper().erase(it);
-            } else {
-                ++it;
+        for (int i = 0; i < n_shards; i++) {
+            auto &mapper = shards_[i].mapper_;
+            for (auto it = mapper.begin(); it != mapper.end();) {
+                const auto &engine_id = it->first.engine_id_;
+                if (engine_id.kind() == engine_kind::cpu
+                        && is_native_runtime(engine_id.runtime_kind())) {
+                    it = mapper.erase(it);
+                } else {
+                    ++it;
+                }
             }
         }
-        cache_mapper_.release();
+        shards_.release();
     } else {
         // Three scenarios possible:
         // 1. oneDNN is being dynamically unloaded
@@ -348,13 +462,13 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         //    the process terminates
         // In all these scenarios content of the primitive cache can be safely
         // destroyed.
-        cache_mapper_.reset();
+        shards_.reset();
     }
 #else
     // Always destroy the content of the primitive cache for non-Windows OSes,
     // and non-sycl and non-ocl runtimes because there is no a problem with
     // library unloading order in such cases.
-    cache_mapper_.reset();
+    shards_.reset();
 #endif
 
 #endif /* DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE */
@@ -380,3 +494,33 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_capacity_bytes(
+        size_t *capacity_bytes) {
+    if (capacity_bytes == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity_bytes = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *capacity_bytes = dnnl::impl::primitive_cache().get_capacity_bytes();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_capacity_bytes(
+        size_t capacity_bytes) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::primitive_cache().set_capacity_bytes(capacity_bytes);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::primitive_cache().get_stats();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_primitive_cache_stats() {
+    dnnl::impl::primitive_cache().reset_stats();
+    return dnnl::impl::status::success;
+}
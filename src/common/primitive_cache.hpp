@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,15 +17,16 @@
 #ifndef COMMON_PRIMITIVE_CACHE_HPP
 #define COMMON_PRIMITIVE_CACHE_HPP
 
+#include <atomic>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
 #include "c_types_map.hpp"
 #include "oneapi/dnnl/dnnl.h"
 #include "primitive_hashing.hpp"
-#include "rw_mutex.hpp"
 #include "type_helpers.hpp"
 
 namespace dnnl {
@@ -39,37 +40,55 @@ struct primitive_cache_t : public c_compatible {
     };
     using key_t = primitive_hashing::key_t;
     using value_t = std::shared_future<cache_value_t>;
+    using stats_t = dnnl_primitive_cache_stats_t;
 
     virtual ~primitive_cache_t() = default;
 
     virtual status_t set_capacity(int capacity) = 0;
     virtual int get_capacity() const = 0;
 
+    // A byte budget of 0 means the cache is limited by entries only.
+    virtual status_t set_capacity_bytes(size_t capacity_bytes) = 0;
+    virtual size_t get_capacity_bytes() const = 0;
+
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
-    virtual void update_entry(const key_t &key, const primitive_desc_t *pd) = 0;
+    virtual void update_entry(const key_t &key, const primitive_t *p) = 0;
 
     virtual int get_size() const = 0;
 
-    virtual std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) = 0;
-
-protected:
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
+    virtual void add_creation_time(uint64_t time_ns) = 0;
+    virtual stats_t get_stats() const = 0;
+    virtual void reset_stats() = 0;
 
-    void lock_read() { rw_mutex().lock_read(); }
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_read() { rw_mutex().unlock_read(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
+    virtual std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) = 0;
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// Entries are distributed over shards by key hash. Each shard has its own
+// lock, hash table, intrusive LRU list and an equal part of the capacity and
+// of the byte budget, so lookups, insertions and evictions are O(1) and lock
+// a single shard. The replacement policy is thus LRU within a shard. Small
+// caches use fewer shards, down to a single one, which makes the policy exact
+// for them.
+//
+// Besides the number of entries the cache can be limited by the total resident
+// size of the primitives it holds. The size of an entry becomes known once the
+// primitive is created, until then the entry takes no space.
 struct lru_primitive_cache_t : public primitive_cache_t {
-    lru_primitive_cache_t(int capacity) : capacity_(capacity) {
-        cache_mapper_ = utils::make_unique<
-                std::unordered_map<key_t, timed_entry_t>>();
+    lru_primitive_cache_t(int capacity, size_t capacity_bytes = 0)
+        : capacity_(capacity)
+        , capacity_bytes_(capacity_bytes)
+        , size_(0)
+        , resident_bytes_(0)
+        , hits_(0)
+        , misses_(0)
+        , evictions_(0)
+        , creation_time_ns_(0)
+        , n_active_shards_(1)
+        , shards_(new shard_t[n_shards]) {
+        distribute();
     }
 
     ~lru_primitive_cache_t() override;
@@ -77,40 +96,103 @@ struct lru_primitive_cache_t : public primitive_cache_t {
     status_t set_capacity(int capacity) override;
     int get_capacity() const override;
 
+    status_t set_capacity_bytes(size_t capacity_bytes) override;
+    size_t get_capacity_bytes() const override;
+
     value_t get_or_add(const key_t &key, const value_t &value) override;
     void remove_if_invalidated(const key_t &key) override;
-    void update_entry(const key_t &key, const primitive_desc_t *pd) override;
+    void update_entry(const key_t &key, const primitive_t *p) override;
 
     int get_size() const override;
 
+    void add_creation_time(uint64_t time_ns) override;
+    stats_t get_stats() const override;
+    void reset_stats() override;
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) override;
 
 private:
-    void evict(size_t n);
-    void add(const key_t &key, const value_t &value);
-    value_t get(const key_t &key);
+    static constexpr int n_shards = 16;
+    // The minimal capacity of a shard, the cache uses
+    // min(n_shards, capacity / min_shard_capacity) shards.
+    static constexpr int min_shard_capacity = 64;
 
-    size_t capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
+    struct entry_t {
+        entry_t(const value_t &value, size_t timestamp)
             : value_(value), timestamp_(timestamp) {}
+        value_t value_;
+        // Time of the last access, used to keep the order of entries when
+        // they are redistributed over the shards.
+        size_t timestamp_;
+        size_t resident_size_ = 0;
+        // The key stored in the hash table node along with the entry.
+        const key_t *key_ = nullptr;
+        // Links of the LRU list: `prev_` is more recently used.
+        entry_t *prev_ = nullptr;
+        entry_t *next_ = nullptr;
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return *cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return *cache_mapper_;
-    }
+    struct shard_t {
+        using mapper_t = std::unordered_map<key_t, entry_t>;
+
+        // Returns the entry and marks it as the most recently used.
+        entry_t *get(const key_t &key);
+        void add(const key_t &key, const value_t &value, size_t timestamp);
+        void erase(mapper_t::iterator it);
+
+        void unlink(entry_t *e);
+        void push_front(entry_t *e);
+
+        bool is_over_budget() const {
+            return size_ > capacity_
+                    || (capacity_bytes_ != 0
+                            && resident_bytes_ > capacity_bytes_);
+        }
+
+        std::mutex mutex_;
+        mapper_t mapper_;
+        entry_t *head_ = nullptr;
+        entry_t *tail_ = nullptr;
+        // The part of the capacity and of the byte budget of the shard.
+        size_t capacity_ = 0;
+        size_t capacity_bytes_ = 0;
+        size_t size_ = 0;
+        size_t resident_bytes_ = 0;
+    };
 
-    // Each entry in the cache has a corresponding key and timestamp.
-    // NOTE: pairs that contain atomics cannot be stored in an unordered_map *as
-    // an element*, since it invokes the copy constructor of std::atomic, which
-    // is deleted.
-    std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> cache_mapper_;
+    shard_t &get_shard(const key_t &key) const;
+    // Locks the shard of `key` and sets `shard` to it.
+    std::unique_lock<std::mutex> lock_shard(const key_t &key, shard_t *&shard);
+
+    // Evicts the least recently used entries of the shard until it fits both
+    // its capacity and its byte budget. Must be called with the shard locked.
+    void evict(shard_t &shard);
+    void erase(shard_t &shard, shard_t::mapper_t::iterator it);
+    void add(shard_t &shard, const key_t &key, const value_t &value,
+            size_t timestamp);
+    // Splits the capacity and the byte budget between the shards,
+    // redistributing the entries if the number of shards changes, and evicts
+    // the entries that do not fit. Must be called with all shards locked.
+    void distribute();
+    void lock_all() const;
+    void unlock_all() const;
+
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> capacity_bytes_;
+    std::atomic<size_t> size_;
+    std::atomic<size_t> resident_bytes_;
+
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<uint64_t> evictions_;
+    std::atomic<uint64_t> creation_time_ns_;
+
+    // The number of shards in use, changes with all shards locked only.
+    std::atomic<int> n_active_shards_;
+
+    // NOTE: The shards are stored by pointer to be able to leave them
+    // undestroyed at the process termination, see the destructor.
+    std::unique_ptr<shard_t[]> shards_;
 
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
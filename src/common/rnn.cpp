@@ -289,6 +289,10 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     dst_layer_desc);
     if (!args_ok) return invalid_arguments;
 
+    // check that only known flags have been passed
+    args_ok = args_ok && (flags & ~dnnl_rnn_flags_seq_lengths) == 0;
+    if (!args_ok) return invalid_arguments;
+
     if (cell_kind == dnnl_vanilla_rnn) {
         using namespace alg_kind;
         args_ok = args_ok
@@ -394,6 +398,10 @@ status_t rnn_common_bwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     diff_dst_layer_desc);
     if (!args_ok) return invalid_arguments;
 
+    // check that only known flags have been passed
+    args_ok = args_ok && (flags & ~dnnl_rnn_flags_seq_lengths) == 0;
+    if (!args_ok) return invalid_arguments;
+
     if (cell_kind == dnnl_vanilla_rnn) {
         using namespace alg_kind;
         args_ok = args_ok
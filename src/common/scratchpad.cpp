@@ -24,6 +24,8 @@
 #endif
 
 #include "scratchpad.hpp"
+#include "scratchpad_debug.hpp"
+#include "scratchpad_pool.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -46,8 +48,7 @@ engine_t *get_cpu_engine() {
 }
 #endif
 
-memory_storage_t *create_scratchpad_memory_storage(
-        engine_t *engine, size_t size) {
+engine_t *get_scratchpad_memory_engine(engine_t *engine) {
     // XXX: if engine is a non-native CPU engine (read: SYCL) then create
     // scratchpad through other, native CPU engine.
     //
@@ -58,45 +59,86 @@ memory_storage_t *create_scratchpad_memory_storage(
     // scratchpad has to be destroyed from inside a kernel. This doesn't
     // play well with SYCL runtime, so switching to native CPU engine for such
     // cases.
-    engine_t *mem_engine = nullptr;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-    mem_engine = (engine->kind() == engine_kind::cpu
-                         && !is_native_runtime(engine->runtime_kind()))
+    return (engine->kind() == engine_kind::cpu
+                   && !is_native_runtime(engine->runtime_kind()))
             ? get_cpu_engine()
             : engine;
 #else
-    mem_engine = engine;
+    return engine;
 #endif
-
-    memory_storage_t *mem_storage = nullptr;
-    auto status = mem_engine->create_memory_storage(&mem_storage, size);
-    MAYBE_UNUSED(status);
-    return mem_storage;
 }
 
 } // namespace
 
+/*
+  A memory buffer of a scratchpad. The buffer is taken from the scratchpad
+  pool of the engine when the engine has one, and is returned to the pool on
+  destruction. Otherwise the buffer is allocated by the engine directly.
+*/
+struct scratchpad_buffer_t {
+    scratchpad_buffer_t(engine_t *engine, size_t size) {
+        engine_t *mem_engine = get_scratchpad_memory_engine(engine);
+
+        // Protected scratchpads need their own allocation to guard the pages.
+        if (!scratchpad_debug::is_protect_scratchpad())
+            pool_ = mem_engine->scratchpad_pool();
+
+        memory_storage_t *mem_storage = nullptr;
+        if (pool_) {
+            ptr_ = pool_->acquire(size, capacity_);
+            if (ptr_ == nullptr) return;
+            auto status = mem_engine->create_memory_storage(&mem_storage,
+                    memory_flags_t::use_runtime_ptr, size, ptr_);
+            if (status != status::success) {
+                pool_->release(ptr_, capacity_);
+                ptr_ = nullptr;
+                return;
+            }
+        } else {
+            auto status = mem_engine->create_memory_storage(&mem_storage, size);
+            MAYBE_UNUSED(status);
+        }
+        mem_storage_.reset(mem_storage);
+    }
+
+    ~scratchpad_buffer_t() {
+        // The memory storage does not own a pooled buffer, so it is destroyed
+        // before the buffer goes back to the pool.
+        mem_storage_.reset();
+        if (pool_) pool_->release(ptr_, capacity_);
+    }
+
+    memory_storage_t *get_memory_storage() const { return mem_storage_.get(); }
+
+private:
+    std::unique_ptr<memory_storage_t> mem_storage_;
+    std::shared_ptr<scratchpad_pool_t> pool_;
+    void *ptr_ = nullptr;
+    size_t capacity_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_buffer_t);
+};
+
 /*
   Implementation of the scratchpad_t interface that is compatible with
   a concurrent execution
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
-    concurrent_scratchpad_t(engine_t *engine, size_t size) {
-        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
+    concurrent_scratchpad_t(engine_t *engine, size_t size)
+        : buffer_(engine, size) {
         size_ = size;
-        if (mem_storage == nullptr) size_ = 0;
-
-        mem_storage_.reset(mem_storage);
+        if (buffer_.get_memory_storage() == nullptr) size_ = 0;
     }
 
     const memory_storage_t *get_memory_storage() const override {
-        return mem_storage_.get();
+        return buffer_.get_memory_storage();
     }
 
     size_t size() const override { return size_; }
 
 private:
-    std::unique_ptr<memory_storage_t> mem_storage_;
+    scratchpad_buffer_t buffer_;
     size_t size_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
@@ -111,13 +153,14 @@ struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
         if (size > size_) {
-            delete mem_storage_;
+            delete buffer_;
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
-            if (mem_storage_ == nullptr) {
+            buffer_ = new scratchpad_buffer_t(engine, size);
+            if (buffer_->get_memory_storage() == nullptr) {
                 // Recreate scratchpad with original capacity
-                mem_storage_ = create_scratchpad_memory_storage(engine, size_);
-                if (mem_storage_ == nullptr) size_ = 0;
+                delete buffer_;
+                buffer_ = new scratchpad_buffer_t(engine, size_);
+                if (buffer_->get_memory_storage() == nullptr) size_ = 0;
             } else
                 size_ = size;
         }
@@ -127,20 +170,20 @@ struct global_scratchpad_t : public scratchpad_t {
     ~global_scratchpad_t() override {
         reference_count_--;
         if (reference_count_ == 0) {
-            delete mem_storage_;
-            mem_storage_ = nullptr;
+            delete buffer_;
+            buffer_ = nullptr;
             size_ = 0;
         }
     }
 
     const memory_storage_t *get_memory_storage() const override {
-        return mem_storage_;
+        return buffer_ ? buffer_->get_memory_storage() : nullptr;
     }
 
     size_t size() const override { return size_; }
 
 private:
-    thread_local static memory_storage_t *mem_storage_;
+    thread_local static scratchpad_buffer_t *buffer_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
 };
@@ -150,7 +193,7 @@ private:
 // destruction order may be such that a thread-local object is destroyed
 // before all its users are destroyed thus causing a crash at exit.
 // Tested by tests/gtests/test_global_scratchad.cpp
-thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
+thread_local scratchpad_buffer_t *global_scratchpad_t::buffer_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
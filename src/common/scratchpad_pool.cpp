@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "math_utils.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "scratchpad_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Buffers are page aligned so that a reused buffer does not share pages with
+// other allocations.
+constexpr size_t buffer_alignment = 4096;
+
+std::atomic<size_t> in_use_bytes {0};
+std::atomic<size_t> retained_bytes {0};
+std::atomic<size_t> peak_bytes {0};
+std::atomic<size_t> hits {0};
+std::atomic<size_t> misses {0};
+
+// The retained buffers add to the resident memory of the process even when
+// no primitive is alive, so the default only covers the scratchpads of a few
+// typical primitives.
+constexpr int default_capacity_mb = 64;
+
+std::atomic<size_t> &capacity_bytes() {
+    // The capacity is set in megabytes to fit an int.
+    static std::atomic<size_t> capacity(
+            (size_t)nstl::max(0,
+                    getenv_int_user("SCRATCHPAD_POOL_CAPACITY_MB",
+                            default_capacity_mb))
+            << 20);
+    return capacity;
+}
+
+// The list of live pools for trimming all of them when the capacity is
+// reduced. It is never destroyed as the pools may outlive static objects.
+struct pool_registry_t {
+    std::mutex mutex;
+    std::vector<scratchpad_pool_t *> pools;
+};
+
+pool_registry_t &pool_registry() {
+    static pool_registry_t *registry = new pool_registry_t();
+    return *registry;
+}
+
+void update_peak_bytes() {
+    const size_t total = in_use_bytes.load(std::memory_order_relaxed)
+            + retained_bytes.load(std::memory_order_relaxed);
+    size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (total > peak && !peak_bytes.compare_exchange_weak(peak, total))
+        ;
+}
+
+} // namespace
+
+scratchpad_pool_t::scratchpad_pool_t(place_fn_t place)
+    : place_(std::move(place)) {
+    for_(int c = 0; c < nclasses; c++)
+    for (int s = 0; s < slots_per_class; s++)
+        slots_[c][s].store(nullptr, std::memory_order_relaxed);
+
+    auto &registry = pool_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.pools.push_back(this);
+}
+
+scratchpad_pool_t::~scratchpad_pool_t() {
+    {
+        auto &registry = pool_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto &pools = registry.pools;
+        pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+    }
+
+    for (int c = 0; c < nclasses; c++) {
+        size_t class_size = 0;
+        for (auto &slot : slots_[c]) {
+            void *ptr = slot.exchange(nullptr, std::memory_order_acquire);
+            if (ptr == nullptr) continue;
+            if (class_size == 0) size_class_size(c, class_size);
+            retained_bytes -= class_size;
+            impl::free(ptr);
+        }
+    }
+}
+
+int scratchpad_pool_t::size_class(size_t size, size_t &class_size) {
+    const size_t min_size = (size_t)1 << min_class_log2;
+    if (size <= min_size) {
+        class_size = min_size;
+        return 0;
+    }
+
+    // `size` belongs to (2^e, 2^(e+1)], which is split in classes_per_pow2
+    // classes.
+    const int e = math::ilog2q(size - 1);
+    if (e >= max_class_log2) return -1;
+
+    const size_t step = ((size_t)1 << e) / classes_per_pow2;
+    class_size = utils::rnd_up(size, step);
+    const int sub_class = (int)(class_size / step) - classes_per_pow2 - 1;
+    return 1 + (e - min_class_log2) * classes_per_pow2 + sub_class;
+}
+
+void scratchpad_pool_t::size_class_size(int idx, size_t &class_size) {
+    assert(idx >= 0 && idx < nclasses);
+    if (idx == 0) {
+        class_size = (size_t)1 << min_class_log2;
+        return;
+    }
+    const int e = (idx - 1) / classes_per_pow2 + min_class_log2;
+    const int sub_class = (idx - 1) % classes_per_pow2;
+    const size_t step = ((size_t)1 << e) / classes_per_pow2;
+    class_size = (classes_per_pow2 + sub_class + 1) * step;
+}
+
+void *scratchpad_pool_t::acquire(size_t size, size_t &capacity) {
+    const int idx = size_class(size, capacity);
+    if (idx >= 0) {
+        for (auto &slot : slots_[idx]) {
+            // Check the slot first to not write to the cache line of every
+            // empty slot.
+            if (slot.load(std::memory_order_relaxed) == nullptr) continue;
+            void *ptr = slot.exchange(nullptr, std::memory_order_acquire);
+            if (ptr == nullptr) continue;
+
+            retained_bytes -= capacity;
+            in_use_bytes += capacity;
+            hits++;
+            return ptr;
+        }
+    } else {
+        capacity = size;
+    }
+
+    void *ptr = impl::malloc(capacity, buffer_alignment);
+    if (ptr == nullptr) return nullptr;
+    if (place_) place_(ptr, capacity);
+
+    in_use_bytes += capacity;
+    misses++;
+    update_peak_bytes();
+    return ptr;
+}
+
+void scratchpad_pool_t::release(void *ptr, size_t capacity) {
+    if (ptr == nullptr) return;
+    in_use_bytes -= capacity;
+
+    size_t class_size = 0;
+    const int idx = size_class(capacity, class_size);
+    if (idx >= 0 && class_size == capacity) {
+        const size_t retained = retained_bytes.fetch_add(capacity) + capacity;
+        if (retained <= capacity_bytes().load(std::memory_order_relaxed)) {
+            for (auto &slot : slots_[idx]) {
+                void *expected = nullptr;
+                if (slot.load(std::memory_order_relaxed) == nullptr
+                        && slot.compare_exchange_strong(expected, ptr,
+                                std::memory_order_release,
+                                std::memory_order_relaxed))
+                    return;
+            }
+        }
+        retained_bytes -= capacity;
+    }
+
+    impl::free(ptr);
+}
+
+void scratchpad_pool_t::trim(size_t max_retained_bytes) {
+    // Start from the biggest buffers to release the memory with the least
+    // number of frees.
+    for (int c = nclasses - 1; c >= 0; c--) {
+        size_t class_size = 0;
+        for (auto &slot : slots_[c]) {
+            if (retained_bytes.load(std::memory_order_relaxed)
+                    <= max_retained_bytes)
+                return;
+            if (slot.load(std::memory_order_relaxed) == nullptr) continue;
+            void *ptr = slot.exchange(nullptr, std::memory_order_acquire);
+            if (ptr == nullptr) continue;
+            if (class_size == 0) size_class_size(c, class_size);
+            retained_bytes -= class_size;
+            impl::free(ptr);
+        }
+    }
+}
+
+size_t scratchpad_pool_t::get_capacity_bytes() {
+    return capacity_bytes().load(std::memory_order_relaxed);
+}
+
+void scratchpad_pool_t::set_capacity_bytes(size_t capacity) {
+    capacity_bytes().store(capacity, std::memory_order_relaxed);
+
+    auto &registry = pool_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto *pool : registry.pools)
+        pool->trim(capacity);
+}
+
+dnnl_scratchpad_pool_stats_t scratchpad_pool_t::get_stats() {
+    dnnl_scratchpad_pool_stats_t stats;
+    stats.in_use_bytes = in_use_bytes.load(std::memory_order_relaxed);
+    stats.retained_bytes = retained_bytes.load(std::memory_order_relaxed);
+    stats.peak_bytes = peak_bytes.load(std::memory_order_relaxed);
+    stats.hits = hits.load(std::memory_order_relaxed);
+    stats.misses = misses.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void scratchpad_pool_t::reset_stats() {
+    hits = 0;
+    misses = 0;
+    peak_bytes = 0;
+    update_peak_bytes();
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::status_t dnnl_get_scratchpad_pool_capacity_bytes(
+        size_t *capacity_bytes) {
+    if (capacity_bytes == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity_bytes = dnnl::impl::scratchpad_pool_t::get_capacity_bytes();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_scratchpad_pool_capacity_bytes(
+        size_t capacity_bytes) {
+    dnnl::impl::scratchpad_pool_t::set_capacity_bytes(capacity_bytes);
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_scratchpad_pool_stats(
+        dnnl_scratchpad_pool_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::scratchpad_pool_t::get_stats();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_scratchpad_pool_stats() {
+    dnnl::impl::scratchpad_pool_t::reset_stats();
+    return dnnl::impl::status::success;
+}
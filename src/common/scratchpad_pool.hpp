@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SCRATCHPAD_POOL_HPP
+#define COMMON_SCRATCHPAD_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A pool of host buffers that back library managed scratchpads.
+//
+// Buffers are rounded up to a size class (four classes per power of two
+// starting from 4 KiB) and are kept in per-class lists of slots after the
+// scratchpad that used them is destroyed. The slots are taken and filled with
+// atomic exchanges, so acquiring and releasing a buffer does not lock.
+//
+// A pool belongs to an engine, hence the buffers it retains stay within the
+// memory the engine threads have touched. The total amount of retained bytes
+// over all pools is limited by the capacity that can be set with
+// dnnl_set_scratchpad_pool_capacity_bytes() or with the
+// ONEDNN_SCRATCHPAD_POOL_CAPACITY_MB environment variable.
+struct scratchpad_pool_t {
+    // `place` is called on every newly allocated buffer before it is handed
+    // out, e.g. to place its pages on the memory of the engine.
+    using place_fn_t = std::function<void(void *ptr, size_t size)>;
+
+    scratchpad_pool_t(place_fn_t place = nullptr);
+    ~scratchpad_pool_t();
+
+    // Returns a buffer of at least `size` bytes and sets `capacity` to its
+    // actual size, or returns nullptr if the allocation failed.
+    void *acquire(size_t size, size_t &capacity);
+    // Gives the buffer back to the pool. The buffer is freed if the pool
+    // cannot retain it.
+    void release(void *ptr, size_t capacity);
+    // Frees the retained buffers until no more than `max_retained_bytes`
+    // are retained by all the pools.
+    void trim(size_t max_retained_bytes);
+
+    static size_t get_capacity_bytes();
+    static void set_capacity_bytes(size_t capacity_bytes);
+
+    static dnnl_scratchpad_pool_stats_t get_stats();
+    static void reset_stats();
+
+private:
+    enum {
+        min_class_log2 = 12,
+        max_class_log2 = 47,
+        classes_per_pow2 = 4,
+        nclasses = (max_class_log2 - min_class_log2) * classes_per_pow2 + 1,
+        slots_per_class = 16,
+    };
+
+    // Returns the size class of `size` and sets `class_size` to the size of
+    // the buffers in the class, or returns -1 if the size is too big to be
+    // pooled.
+    static int size_class(size_t size, size_t &class_size);
+    // Sets `class_size` to the size of the buffers in the size class `idx`.
+    static void size_class_size(int idx, size_t &class_size);
+
+    std::atomic<void *> slots_[nclasses][slots_per_class];
+    place_fn_t place_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+dnnl_status_t dnnl_sdpa_desc_init(sdpa_desc_t *desc, prop_kind_t prop_kind,
+        const memory_desc_t *q_desc, const memory_desc_t *k_desc,
+        const memory_desc_t *v_desc, const memory_desc_t *mask_desc,
+        const memory_desc_t *dst_desc, float scale, unsigned flags) {
+    bool args_ok = !any_null(desc, q_desc, k_desc, v_desc, dst_desc)
+            && prop_kind == prop_kind::forward_inference
+            && (flags & ~dnnl_sdpa_causal) == 0;
+    if (!args_ok) return invalid_arguments;
+
+    const bool with_mask = mask_desc != nullptr && mask_desc->ndims != 0;
+
+    for (auto md : {q_desc, k_desc, v_desc, dst_desc})
+        if (memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return unimplemented;
+    if (with_mask
+            && memory_desc_wrapper(mask_desc).has_runtime_dims_or_strides())
+        return unimplemented;
+
+    for (auto md : {q_desc, k_desc, v_desc})
+        if (md->format_kind == format_kind::any) return invalid_arguments;
+    if (with_mask && mask_desc->format_kind == format_kind::any)
+        return invalid_arguments;
+
+    // Q: [batch, Sq, D], K: [batch, Skv, D], V: [batch, Skv, Dv],
+    // dst: [batch, Sq, Dv]
+    const int ndims = q_desc->ndims;
+    if (ndims < 2 || !everyone_is(ndims, k_desc->ndims, v_desc->ndims,
+                dst_desc->ndims))
+        return invalid_arguments;
+
+    for (int d = 0; d < ndims - 2; ++d)
+        if (!everyone_is(q_desc->dims[d], k_desc->dims[d], v_desc->dims[d],
+                    dst_desc->dims[d]))
+            return invalid_arguments;
+
+    const dim_t sq = q_desc->dims[ndims - 2];
+    const dim_t skv = k_desc->dims[ndims - 2];
+    const dim_t d_qk = q_desc->dims[ndims - 1];
+    const dim_t d_v = v_desc->dims[ndims - 1];
+    args_ok = k_desc->dims[ndims - 1] == d_qk && v_desc->dims[ndims - 2] == skv
+            && dst_desc->dims[ndims - 2] == sq
+            && dst_desc->dims[ndims - 1] == d_v;
+    if (!args_ok) return invalid_arguments;
+
+    // The mask is broadcast along the dimensions set to one.
+    if (with_mask) {
+        if (mask_desc->ndims != ndims) return invalid_arguments;
+        for (int d = 0; d < ndims; ++d) {
+            const dim_t full_dim = d == ndims - 1
+                    ? skv
+                    : (d == ndims - 2 ? sq : q_desc->dims[d]);
+            if (!one_of(mask_desc->dims[d], 1, full_dim))
+                return invalid_arguments;
+        }
+    }
+
+    auto sd = sdpa_desc_t();
+    sd.primitive_kind = primitive_kind::sdpa;
+    sd.prop_kind = prop_kind;
+    sd.q_desc = *q_desc;
+    sd.k_desc = *k_desc;
+    sd.v_desc = *v_desc;
+    sd.mask_desc = with_mask ? *mask_desc : types::zero_md();
+    sd.dst_desc = *dst_desc;
+    sd.scale = scale;
+    sd.flags = flags;
+
+    *desc = sd;
+    return success;
+}
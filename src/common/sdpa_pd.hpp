@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_PD_HPP
+#define COMMON_SDPA_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct sdpa_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::sdpa;
+
+    typedef sdpa_pd_t base_class;
+    typedef sdpa_pd_t hint_class;
+
+    const sdpa_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            case query::sdpa_d: *(const sdpa_desc_t **)result = desc(); break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK && with_mask())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_QUERIES: return src_md(0);
+            case DNNL_ARG_KEYS: return src_md(1);
+            case DNNL_ARG_VALUES: return src_md(2);
+            case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // The sources are the queries, the keys, the values and the mask.
+    const memory_desc_t *src_md(int index = 0) const override {
+        switch (index) {
+            case 0: return &q_md_;
+            case 1: return &k_md_;
+            case 2: return &v_md_;
+            case 3: return with_mask() ? &mask_md_ : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_mask(); }
+    int n_outputs() const override { return 1; }
+
+    int ndims() const { return q_md_.ndims; }
+    int batch_ndims() const { return ndims() - 2; }
+
+    // The product of the batch dimensions, e.g. batch size times the number
+    // of heads.
+    dim_t MB() const {
+        return utils::array_product(q_md_.dims, batch_ndims());
+    }
+    dim_t SQ() const { return q_md_.dims[ndims() - 2]; }
+    dim_t SKV() const { return k_md_.dims[ndims() - 2]; }
+    dim_t D() const { return q_md_.dims[ndims() - 1]; }
+    dim_t DV() const { return v_md_.dims[ndims() - 1]; }
+
+    float scale() const { return desc_.scale; }
+    bool with_mask() const { return desc_.mask_desc.ndims != 0; }
+    bool with_causal_mask() const { return desc_.flags & dnnl_sdpa_causal; }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(q_md_).has_zero_dim()
+                || memory_desc_wrapper(k_md_).has_zero_dim();
+    }
+
+protected:
+    sdpa_desc_t desc_;
+
+    memory_desc_t q_md_;
+    memory_desc_t k_md_;
+    memory_desc_t v_md_;
+    memory_desc_t mask_md_;
+    memory_desc_t dst_md_;
+
+    sdpa_pd_t(const sdpa_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , q_md_(desc_.q_desc)
+        , k_md_(desc_.k_desc)
+        , v_md_(desc_.v_desc)
+        , mask_md_(desc_.mask_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_strides(dst_md_, nullptr);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -38,7 +38,9 @@ status_t serialize_desc(
         CASE(eltwise)
         CASE(inner_product)
         CASE(gemm)
+        CASE(group_normalization)
         CASE(layer_normalization)
+        CASE(layer_normalization_v2)
         CASE(logsoftmax)
         CASE(lrn)
         CASE(matmul)
@@ -49,6 +51,7 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(softmax_v2)
@@ -345,6 +348,37 @@ void serialize_desc(serialization_stream_t &sstream,
     sstream.write(&desc.flags);
 }
 
+void serialize_desc(serialization_stream_t &sstream,
+        const layer_normalization_v2_desc_t &desc) {
+    const auto &v1_desc
+            = *reinterpret_cast<const layer_normalization_desc_t *>(&desc);
+    serialize_desc(sstream, v1_desc);
+    // Memory descriptors
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.diff_dst_desc);
+}
+
+void serialize_desc(serialization_stream_t &sstream,
+        const group_normalization_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.prop_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.diff_src_desc);
+    serialize_md(sstream, desc.scaleshift_desc);
+    serialize_md(sstream, desc.diff_scaleshift_desc);
+    serialize_md(sstream, desc.stat_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.diff_dst_desc);
+    // Groups
+    sstream.write(&desc.groups);
+    // Epsilon
+    sstream.write(&desc.group_norm_epsilon);
+    // Flags
+    sstream.write(&desc.flags);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc) {
     // Kinds
     sstream.write(&desc.primitive_kind);
@@ -426,6 +460,22 @@ void serialize_desc(
     sstream.write(&desc.eps);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.prop_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.q_desc);
+    serialize_md(sstream, desc.k_desc);
+    serialize_md(sstream, desc.v_desc);
+    serialize_md(sstream, desc.mask_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Scale
+    sstream.write(&desc.scale);
+    // Flags
+    sstream.write(&desc.flags);
+}
+
 void serialize_desc(
         serialization_stream_t &sstream, const reorder_desc_t &desc) {
     // Kinds
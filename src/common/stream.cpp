@@ -33,6 +33,18 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+status_t stream_t::begin_capture() {
+    if (is_capturing()) return invalid_arguments;
+    capture_.reset(new exec_graph_t(this));
+    return capture_ ? success : out_of_memory;
+}
+
+status_t stream_t::end_capture(exec_graph_t **graph) {
+    if (!is_capturing()) return invalid_arguments;
+    *graph = capture_.release();
+    return success;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
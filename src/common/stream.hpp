@@ -23,6 +23,8 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "exec_graph.hpp"
+#include "stream_profiler.hpp"
 #include "utils.hpp"
 
 struct dnnl_stream : public dnnl::impl::c_compatible {
@@ -53,6 +55,22 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
+    /** returns stream's execution profiler */
+    dnnl::impl::stream_profiler_t &profiler() { return profiler_; }
+    const dnnl::impl::stream_profiler_t &profiler() const { return profiler_; }
+
+    /** starts capturing the executions of primitives instead of running
+     * them */
+    dnnl::impl::status_t begin_capture();
+    /** stops capturing and returns the captured executions */
+    dnnl::impl::status_t end_capture(dnnl::impl::exec_graph_t **graph);
+    bool is_capturing() const { return bool(capture_); }
+    /** records an execution of a primitive while capturing */
+    dnnl::impl::status_t capture(primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args) {
+        return capture_->append(primitive_iface, std::move(args));
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl_stream(dnnl::impl::engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -74,6 +92,8 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     unsigned flags_;
+    dnnl::impl::stream_profiler_t profiler_;
+    std::unique_ptr<dnnl::impl::exec_graph_t> capture_;
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::threadpool_interop::threadpool_iface *threadpool_ = nullptr;
 #endif
@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_exec_types.hpp"
+#include "stream.hpp"
+#include "stream_profiler.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+void write_json_string(std::ostream &os, const char *s) {
+    os << '"';
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') os << '\\';
+        if ((unsigned char)*s >= 0x20) os << *s;
+    }
+    os << '"';
+}
+
+// Writes nanoseconds as microseconds, the time unit of the trace events.
+void write_usec(std::ostream &os, uint64_t ns) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%llu.%03u", (unsigned long long)(ns / 1000),
+            (unsigned)(ns % 1000));
+    os << buf;
+}
+} // namespace
+
+uint64_t stream_profiler_t::get_nsec() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+status_t stream_profiler_t::set_capacity(int capacity) {
+    if (capacity < 0) return invalid_arguments;
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.clear();
+    records_.resize(capacity);
+    records_.shrink_to_fit();
+    head_ = 0;
+    count_ = 0;
+    enabled_ = capacity > 0;
+    return success;
+}
+
+stream_profiler_t::record_t &stream_profiler_t::push() {
+    record_t &r = records_[head_];
+    head_ = (head_ + 1) % records_.size();
+    count_ = nstl::min(count_ + 1, records_.size());
+    return r;
+}
+
+void stream_profiler_t::start(const primitive_desc_t *pd, const char *info) {
+    pd_ = pd;
+    info_ = info;
+    depth_ = 0;
+    start_ns_ = get_nsec();
+}
+
+void stream_profiler_t::stop() {
+    const uint64_t end_ns = get_nsec();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_ || pd_ == nullptr) return;
+
+    record_t &r = push();
+    r.kind = pd_->kind();
+    r.impl_name = pd_->name();
+    r.info = info_;
+    r.phase = nullptr;
+    r.depth = 0;
+    r.start_ns = start_ns_;
+    r.end_ns = end_ns;
+    pd_ = nullptr;
+}
+
+void stream_profiler_t::start_phase() {
+    depth_++;
+}
+
+void stream_profiler_t::stop_phase(const char *name, uint64_t start_ns) {
+    const uint64_t end_ns = get_nsec();
+    const int depth = depth_--;
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Phases of implementations executed out of primitive_execute() are not
+    // attributed to a primitive.
+    if (!enabled_ || pd_ == nullptr) return;
+
+    record_t &r = push();
+    r.kind = pd_->kind();
+    r.impl_name = pd_->name();
+    r.info = info_;
+    r.phase = name;
+    r.depth = depth;
+    r.start_ns = start_ns;
+    r.end_ns = end_ns;
+}
+
+int stream_profiler_t::get_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)count_;
+}
+
+status_t stream_profiler_t::get_record(
+        int index, dnnl_profiling_record_t *record) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index < 0 || (size_t)index >= count_) return invalid_arguments;
+
+    const size_t first = (head_ + records_.size() - count_) % records_.size();
+    const record_t &r = records_[(first + index) % records_.size()];
+    record->kind = r.kind;
+    record->impl_name = r.impl_name;
+    record->info = r.info.c_str();
+    record->phase = r.phase;
+    record->depth = r.depth;
+    record->start_ns = r.start_ns;
+    record->end_ns = r.end_ns;
+    return success;
+}
+
+void stream_profiler_t::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    head_ = 0;
+    count_ = 0;
+}
+
+std::string stream_profiler_t::get_trace() const {
+    const int count = get_count();
+    std::ostringstream os;
+    os << "{\"traceEvents\":[";
+    for (int i = 0; i < count; i++) {
+        dnnl_profiling_record_t r;
+        if (get_record(i, &r) != success) break;
+        // Complete events of the same thread, nested by their timestamps.
+        os << (i ? ",\n" : "\n") << "{\"name\":";
+        write_json_string(
+                os, r.phase ? r.phase : dnnl_prim_kind2str(r.kind));
+        os << ",\"cat\":\"" << (r.phase ? "phase" : "primitive") << "\""
+           << ",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":";
+        write_usec(os, r.start_ns);
+        os << ",\"dur\":";
+        write_usec(os, r.end_ns - r.start_ns);
+        os << ",\"args\":{\"impl\":";
+        write_json_string(os, r.impl_name);
+        os << ",\"info\":";
+        write_json_string(os, r.info);
+        os << "}}";
+    }
+    os << "\n]}\n";
+    return os.str();
+}
+
+profiling_phase_t::profiling_phase_t(const exec_ctx_t &ctx, const char *name)
+    : name_(name) {
+    stream_t *stream = ctx.stream();
+    if (stream == nullptr || !stream->profiler().is_enabled()) return;
+    stream_ = stream;
+    stream_->wait();
+    stream_->profiler().start_phase();
+    start_ns_ = stream_profiler_t::get_nsec();
+}
+
+profiling_phase_t::~profiling_phase_t() {
+    if (stream_ == nullptr) return;
+    stream_->wait();
+    stream_->profiler().stop_phase(name_, start_ns_);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// API
+status_t dnnl_stream_set_profiling_capacity(stream_t *stream, int capacity) {
+    if (stream == nullptr) return invalid_arguments;
+    return stream->profiler().set_capacity(capacity);
+}
+
+status_t dnnl_stream_get_profiling_records_count(
+        const stream_t *stream, int *count) {
+    if (utils::any_null(stream, count)) return invalid_arguments;
+    *count = stream->profiler().get_count();
+    return success;
+}
+
+status_t dnnl_stream_get_profiling_record(const stream_t *stream, int index,
+        dnnl_profiling_record_t *record) {
+    if (utils::any_null(stream, record)) return invalid_arguments;
+    return stream->profiler().get_record(index, record);
+}
+
+status_t dnnl_stream_reset_profiling(stream_t *stream) {
+    if (stream == nullptr) return invalid_arguments;
+    stream->profiler().reset();
+    return success;
+}
+
+status_t dnnl_stream_get_profiling_trace(
+        const stream_t *stream, size_t *size, char *trace) {
+    if (utils::any_null(stream, size)) return invalid_arguments;
+    const std::string s = stream->profiler().get_trace();
+    if (trace == nullptr) {
+        *size = s.size() + 1;
+        return success;
+    }
+    if (*size < s.size() + 1) return invalid_arguments;
+    std::memcpy(trace, s.c_str(), s.size() + 1);
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
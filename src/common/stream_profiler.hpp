@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_STREAM_PROFILER_HPP
+#define COMMON_STREAM_PROFILER_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct exec_ctx_t;
+struct primitive_desc_t;
+
+// Execution profiler of a stream.
+//
+// When enabled, the executions of primitives in the stream and the phases of
+// their implementations are recorded in a ring buffer of a fixed number of
+// records: the oldest records are overwritten first. The timestamps are taken
+// on the host after the stream is synchronized, hence the profiling costs a
+// wait on the stream per primitive (and per phase) but no output formatting.
+struct stream_profiler_t {
+    stream_profiler_t() = default;
+
+    bool is_enabled() const { return enabled_; }
+
+    // Enables the profiler with a buffer of `capacity` records, or disables
+    // it if `capacity` is 0. The previous records are dropped.
+    status_t set_capacity(int capacity);
+
+    // Starts and stops recording the execution of the primitive `pd`
+    // described by `info`.
+    void start(const primitive_desc_t *pd, const char *info);
+    void stop();
+
+    // Starts and stops recording the phase `name` of the implementation
+    // being executed.
+    void start_phase();
+    void stop_phase(const char *name, uint64_t start_ns);
+
+    // The records are returned from the oldest to the most recent one. The
+    // strings are valid until the record is overwritten or the profiler is
+    // reset.
+    int get_count() const;
+    status_t get_record(int index, dnnl_profiling_record_t *record) const;
+    void reset();
+
+    // Writes the records in the Chrome trace event format.
+    std::string get_trace() const;
+
+    static uint64_t get_nsec();
+
+private:
+    struct record_t {
+        primitive_kind_t kind = primitive_kind::undefined;
+        const char *impl_name = "";
+        std::string info;
+        const char *phase = nullptr;
+        int depth = 0;
+        uint64_t start_ns = 0;
+        uint64_t end_ns = 0;
+    };
+
+    record_t &push();
+
+    bool enabled_ = false;
+    std::vector<record_t> records_;
+    // The index of the next record to write and the number of valid records.
+    size_t head_ = 0;
+    size_t count_ = 0;
+
+    // The primitive being executed and its start time.
+    const primitive_desc_t *pd_ = nullptr;
+    const char *info_ = "";
+    uint64_t start_ns_ = 0;
+    int depth_ = 0;
+
+    mutable std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(stream_profiler_t);
+};
+
+// Records a phase of the implementation executed in `ctx` from its
+// construction to its destruction if the stream of `ctx` is being profiled.
+// `name` must be a string literal. Phases are expected to be created by the
+// master thread of the execution, outside of parallel regions, and can nest.
+struct profiling_phase_t {
+    profiling_phase_t(const exec_ctx_t &ctx, const char *name);
+    ~profiling_phase_t();
+
+private:
+    stream_t *stream_ = nullptr;
+    const char *name_;
+    uint64_t start_ns_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(profiling_phase_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
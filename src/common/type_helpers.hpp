@@ -424,6 +424,35 @@ inline bool operator==(const layer_normalization_desc_t &lhs,
     return ret;
 }
 
+inline bool operator==(const layer_normalization_v2_desc_t &lhs,
+        const layer_normalization_v2_desc_t &rhs) {
+    const auto &v1_desc_lhs
+            = *reinterpret_cast<const layer_normalization_desc_t *>(&lhs);
+    const auto &v1_desc_rhs
+            = *reinterpret_cast<const layer_normalization_desc_t *>(&rhs);
+
+    bool ret = v1_desc_lhs == v1_desc_rhs && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(diff_dst_desc);
+    return ret;
+}
+
+inline bool operator==(const group_normalization_desc_t &lhs,
+        const group_normalization_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(diff_src_desc)
+            && COMPARE_DESC_MEMBERS(scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(diff_scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(stat_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(diff_dst_desc)
+            && COMPARE_DESC_MEMBERS(groups)
+            && COMPARE_FLOAT_DESC_MEMBERS(group_norm_epsilon)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(const lrn_desc_t &lhs, const lrn_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -494,6 +523,19 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(mask_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(scale)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(const reorder_desc_t &lhs, const reorder_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(src_md)
@@ -875,10 +917,17 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(deconvolution);
         CASE_OP_DESC(eltwise);
         CASE_OP_DESC(gemm);
+        CASE_OP_DESC(group_normalization);
         CASE_OP_DESC(inner_product);
-        CASE_OP_DESC(layer_normalization);
-        CASE_OP_DESC(lrn);
-        CASE_OP_DESC(matmul);
+        case primitive_kind::layer_normalization: {
+            auto casted_dst_handle = (layer_normalization_desc_t *)(dst);
+            auto casted_src_handle = (const layer_normalization_desc_t *)(src);
+            *casted_dst_handle = *casted_src_handle;
+            break;
+        }
+            CASE_OP_DESC(layer_normalization_v2);
+            CASE_OP_DESC(lrn);
+            CASE_OP_DESC(matmul);
         case primitive_kind::pooling: {
             auto casted_dst_handle = (dnnl_pooling_desc_t *)(dst);
             auto casted_src_handle = (const dnnl_pooling_desc_t *)(src);
@@ -890,6 +939,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
             CASE_OP_DESC(reduction);
             CASE_OP_DESC(resampling);
             CASE_OP_DESC(rnn);
+            CASE_OP_DESC(sdpa);
             CASE_OP_DESC(shuffle);
         case primitive_kind::logsoftmax:
         case primitive_kind::softmax: {
@@ -244,9 +244,40 @@ std::string get_jit_profiling_jitdumpdir() {
     return jitdumpdir;
 }
 
+static std::mutex jit_cache_dir_mutex;
+static setting_t<std::string> jit_cache_dir;
+std::string get_jit_cache_dir() {
+    std::lock_guard<std::mutex> g(jit_cache_dir_mutex);
+    if (!jit_cache_dir.initialized()) {
+        std::string dir;
+        char buf[4096];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "JIT_CACHE_DIR";
+            if (getenv(name.c_str(), buf, sizeof(buf)) > 0) {
+                dir = buf;
+                break;
+            }
+        }
+        jit_cache_dir.set(dir);
+    }
+    return jit_cache_dir.get();
+}
+
 } // namespace impl
 } // namespace dnnl
 
+dnnl_status_t dnnl_set_jit_cache_dir(const char *dir) {
+    using namespace dnnl::impl;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    std::lock_guard<std::mutex> g(jit_cache_dir_mutex);
+    jit_cache_dir.set(dir ? dir : "");
+    return status::success;
+#else
+    UNUSED(dir);
+    return status::unimplemented;
+#endif
+}
+
 dnnl_status_t dnnl_set_jit_dump(int enabled) {
     using namespace dnnl::impl;
     jit_dump.set(enabled);
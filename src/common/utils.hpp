@@ -598,6 +598,7 @@ std::string getenv_string_user(const char *name);
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+std::string get_jit_cache_dir();
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
 
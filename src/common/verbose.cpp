@@ -38,6 +38,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -48,6 +49,7 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
@@ -388,8 +390,12 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             const auto &val = map_entry.second;
             if (val.has_default_values()) continue;
 
-            int idx = as.get_index_val(map_entry.first);
-            ss << delim << "src" << idx << ":" << val;
+            const int arg = map_entry.first;
+            if (arg >= DNNL_ARG_MULTIPLE_SRC)
+                ss << delim << "msrc" << arg - DNNL_ARG_MULTIPLE_SRC << ":"
+                   << val;
+            else
+                ss << delim << "src" << as.get_index_val(arg) << ":" << val;
             delim = attr_delim;
         }
         ss << " ";
@@ -655,6 +661,7 @@ static std::string init_info_layer_normalization(
                                                          : pd->src_md(1);
     auto diff_src_md = pd->diff_src_md();
     ss << "data_" << src_md;
+    if (pd->is_fwd()) ss << " dst_" << pd->dst_md(0);
     if (stats_md) ss << " stats_" << stats_md;
     if (diff_src_md) ss << " diff_" << diff_src_md;
     ss << ",";
@@ -666,6 +673,30 @@ static std::string init_info_layer_normalization(
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_group_normalization(
+        const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto src_md = pd->src_md(0);
+    auto stats_md = pd->is_fwd() && !pd->stats_are_src() ? pd->dst_md(1)
+                                                         : pd->src_md(1);
+    auto diff_src_md = pd->diff_src_md();
+    ss << "data_" << src_md;
+    if (pd->is_fwd()) ss << " dst_" << pd->dst_md(0);
+    if (stats_md) ss << " stats_" << stats_md;
+    if (diff_src_md) ss << " diff_" << diff_src_md;
+    ss << ",";
+
+    ss << pd->attr() << ",";
+    ss << "flags:" << flags2str(pd->desc()->flags) << ",";
+    ss << md2dim_str(src_md) << ":g" << pd->G();
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_lrn(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -789,6 +820,30 @@ static std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto q_md = pd->src_md(0);
+    auto k_md = pd->src_md(1);
+    auto v_md = pd->src_md(2);
+    auto dst_md = pd->dst_md();
+    ss << "q_" << q_md << " k_" << k_md << " v_" << v_md;
+    if (pd->with_mask()) ss << " msk_" << pd->src_md(3);
+    ss << " dst_" << dst_md << ",";
+
+    ss << pd->attr() << ",";
+    ss << "scale:" << pd->desc()->scale;
+    if (pd->with_causal_mask()) ss << " causal";
+    ss << ",";
+    ss << md2dim_str(q_md) << ":" << md2dim_str(k_md) << ":"
+       << md2dim_str(v_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_reorder(const engine_t *e, pd_t *pd) {
     std::stringstream ss;
@@ -977,7 +1032,9 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(group_normalization);
             CASE(inner_product);
+            case primitive_kind::layer_normalization_v2:
             CASE(layer_normalization);
             CASE(lrn);
             CASE(logsoftmax);
@@ -989,6 +1046,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             case primitive_kind::softmax_v2:
             CASE(softmax);
@@ -58,6 +58,11 @@ struct jit_uni_shuffle_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    size_t get_resident_size() const override {
+        return primitive_t::get_resident_size()
+                + pd()->get_conf().c * sizeof(unsigned);
+    }
+
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t precompute_offsets();
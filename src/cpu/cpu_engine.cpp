@@ -41,7 +41,8 @@ status_t cpu_engine_t::create_memory_storage(
 }
 
 status_t cpu_engine_t::create_stream(stream_t **stream, unsigned flags) {
-    return safe_ptr_assign(*stream, new cpu_stream_t(this, flags));
+    return safe_ptr_assign(
+            *stream, new cpu_stream_t(this, flags, numa_node_));
 }
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -26,7 +26,9 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/scratchpad_pool.hpp"
 
+#include "cpu/numa.hpp"
 #include "cpu/platform.hpp"
 
 #if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
@@ -57,8 +59,9 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
-DECLARE_IMPL_LIST(layer_normalization);
+DECLARE_IMPL_LIST(layer_normalization_v2);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(logsoftmax);
 DECLARE_IMPL_LIST(matmul);
@@ -67,6 +70,7 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax_v2);
 
@@ -93,8 +97,10 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(group_normalization);
             CASE(inner_product);
-            CASE(layer_normalization);
+            case primitive_kind::layer_normalization:
+            CASE(layer_normalization_v2);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
@@ -104,6 +110,7 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             case primitive_kind::softmax:
             CASE(softmax_v2);
@@ -116,7 +123,15 @@ public:
 
 class cpu_engine_t : public engine_t {
 public:
-    cpu_engine_t() : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0) {}
+    // An engine with a non-negative `numa_node` runs its primitives on the
+    // CPUs of the node and allocates its memory and scratchpads there.
+    cpu_engine_t(int numa_node = -1)
+        : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0)
+        , numa_node_(numa_node)
+        , scratchpad_pool_(std::make_shared<scratchpad_pool_t>(
+                  [numa_node](void *ptr, size_t size) {
+                      numa::place(ptr, size, numa_node);
+                  })) {}
 
     /* implementation part */
 
@@ -148,7 +163,17 @@ public:
         return cpu_engine_impl_list_t::get_implementation_list(desc);
     }
 
-    device_id_t device_id() const override { return std::make_tuple(0, 0, 0); }
+    // Engines bound to different nodes do not share cached primitives, so
+    // that the read-only data of a primitive is replicated on every node.
+    device_id_t device_id() const override {
+        return std::make_tuple(0, (uint64_t)(numa_node_ + 1), 0);
+    }
+
+    int numa_node() const { return numa_node_; }
+
+    std::shared_ptr<scratchpad_pool_t> scratchpad_pool() const override {
+        return scratchpad_pool_;
+    }
 
 #ifdef DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE
     engine_id_t engine_id() const override {
@@ -159,6 +184,10 @@ public:
 protected:
     ~cpu_engine_t() override = default;
 #endif
+
+private:
+    int numa_node_;
+    std::shared_ptr<scratchpad_pool_t> scratchpad_pool_;
 };
 
 class cpu_engine_factory_t : public engine_factory_t {
@@ -166,7 +195,13 @@ public:
     size_t count() const override { return 1; }
     status_t engine_create(engine_t **engine, size_t index) const override {
         assert(index == 0);
-        *engine = new cpu_engine_t();
+        return engine_create_on_numa_node(engine, -1);
+    }
+
+    status_t engine_create_on_numa_node(
+            engine_t **engine, int numa_node) const {
+        assert(numa_node < numa::get_node_count());
+        *engine = new cpu_engine_t(numa_node);
 
 #if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
@@ -25,6 +25,8 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_engine.hpp"
+#include "cpu/numa.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -86,8 +88,14 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        // Placed buffers are page aligned to not share pages with others.
+        const int numa_node
+                = utils::downcast<cpu_engine_t *>(engine())->numa_node();
+        const bool place = numa::is_placement_enabled(numa_node);
+        void *ptr
+                = malloc(size, place ? 4096 : platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
+        if (place) numa::place(ptr, size, numa_node);
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
     }
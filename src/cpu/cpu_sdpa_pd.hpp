@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_sdpa_pd_t : public sdpa_pd_t {
+    using sdpa_pd_t::sdpa_pd_t;
+
+    // Returns the offset of the element (r, c) of the matrix `mb` of the
+    // queries, keys, values, mask or destination. The batch dimensions of the
+    // matrices are flattened as in MB(); the mask is broadcast along its
+    // dimensions set to one.
+    dim_t off(const memory_desc_wrapper &mdw, dim_t mb, dim_t r,
+            dim_t c) const {
+        const int nd = ndims();
+        dims_t pos;
+        for (int d = nd - 3; d >= 0; d--) {
+            pos[d] = mb % q_md_.dims[d];
+            mb /= q_md_.dims[d];
+        }
+        pos[nd - 2] = r;
+        pos[nd - 1] = c;
+        for (int d = 0; d < nd; d++)
+            if (mdw.dims()[d] == 1) pos[d] = 0;
+        return mdw.off_v(pos);
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
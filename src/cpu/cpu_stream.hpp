@@ -27,12 +27,15 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/numa.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
+    cpu_stream_t(engine_t *engine, unsigned flags, int numa_node = -1)
+        : stream_t(engine, flags), numa_node_(numa_node) {}
     virtual ~cpu_stream_t() = default;
 
     dnnl::impl::status_t wait() override {
@@ -54,7 +57,14 @@ struct cpu_stream_t : public stream_t {
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+#else
+    // The thread team follows the NUMA node of the engine. The threads of a
+    // user threadpool are left as they are.
+    void before_exec_hook() override { numa::bind_threads(numa_node_); }
 #endif
+
+private:
+    int numa_node_ = -1;
 };
 
 } // namespace cpu
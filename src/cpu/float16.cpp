@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/jit_avx2_f16cvt.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+
+void cvt_float_to_float16(float16_t *out, const float *inp, size_t nelems) {
+#if DNNL_X64
+    using namespace cpu::x64;
+    if (jit_avx2_cvt_f16_t::is_supported()) {
+        static const jit_avx2_cvt_f16_t kernel(false);
+        constexpr size_t simd_w = jit_avx2_cvt_f16_t::simd_w;
+        const size_t nelems_simd = utils::rnd_dn(nelems, simd_w);
+        if (nelems_simd) kernel(out, inp, nelems_simd);
+        const size_t tail = nelems - nelems_simd;
+        if (tail == 0) return;
+        // The tail goes through a full vector to not read or write out of
+        // the bounds of the arrays.
+        float inp_tail[simd_w] = {0};
+        float16_t out_tail[simd_w];
+        for (size_t i = 0; i < tail; ++i)
+            inp_tail[i] = inp[nelems_simd + i];
+        kernel(out_tail, inp_tail, simd_w);
+        for (size_t i = 0; i < tail; ++i)
+            out[nelems_simd + i] = out_tail[i];
+        return;
+    }
+#endif
+
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = inp[i];
+}
+
+void cvt_float16_to_float(float *out, const float16_t *inp, size_t nelems) {
+#if DNNL_X64
+    using namespace cpu::x64;
+    if (jit_avx2_cvt_f16_t::is_supported()) {
+        static const jit_avx2_cvt_f16_t kernel(true);
+        constexpr size_t simd_w = jit_avx2_cvt_f16_t::simd_w;
+        const size_t nelems_simd = utils::rnd_dn(nelems, simd_w);
+        if (nelems_simd) kernel(out, inp, nelems_simd);
+        const size_t tail = nelems - nelems_simd;
+        if (tail == 0) return;
+        float16_t inp_tail[simd_w] = {};
+        float out_tail[simd_w];
+        for (size_t i = 0; i < tail; ++i)
+            inp_tail[i] = inp[nelems_simd + i];
+        kernel(out_tail, inp_tail, simd_w);
+        for (size_t i = 0; i < tail; ++i)
+            out[nelems_simd + i] = out_tail[i];
+        return;
+    }
+#endif
+
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = inp[i];
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/nstl.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+
+#include "cpu/gemm/f16/gemm_f16f16f32.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Splits M x N between nthr threads in a grid of nthr_m x nthr_n blocks that
+// minimizes the number of elements of A and B converted by all threads.
+void partition_mn(dim_t M, dim_t N, int nthr, int &nthr_m, int &nthr_n) {
+    nthr_m = nthr;
+    nthr_n = 1;
+    dim_t best_cost = -1;
+    for (int m = 1; m <= nthr; m++) {
+        if (nthr % m != 0) continue;
+        const int n = nthr / m;
+        if (m > M || n > N) continue;
+        // Every thread converts M / m rows of op(A) and N / n columns of
+        // op(B).
+        const dim_t cost = utils::div_up(M, m) + utils::div_up(N, n);
+        if (best_cost < 0 || cost < best_cost) {
+            best_cost = cost;
+            nthr_m = m;
+            nthr_n = n;
+        }
+    }
+    if (best_cost < 0) nthr_m = nthr_n = 1;
+}
+
+// Converts the block of rows [m0, m0 + mb) of op(A) to f32. The block keeps
+// the layout of A: it is stored with a leading dimension of mb if A is not
+// transposed, and of kb otherwise.
+void cvt_a_block(bool transa, dim_t m0, dim_t mb, dim_t k0, dim_t kb,
+        const float16_t *A, dim_t lda, float *a) {
+    if (!transa) {
+        for (dim_t k = 0; k < kb; k++)
+            cvt_float16_to_float(a + k * mb, A + m0 + (k0 + k) * lda, mb);
+    } else {
+        for (dim_t i = 0; i < mb; i++)
+            cvt_float16_to_float(a + i * kb, A + k0 + (m0 + i) * lda, kb);
+    }
+}
+
+// Converts the block of columns [n0, n0 + nb) of op(B) to f32, see
+// cvt_a_block().
+void cvt_b_block(bool transb, dim_t n0, dim_t nb, dim_t k0, dim_t kb,
+        const float16_t *B, dim_t ldb, float *b) {
+    if (!transb) {
+        for (dim_t j = 0; j < nb; j++)
+            cvt_float16_to_float(b + j * kb, B + k0 + (n0 + j) * ldb, kb);
+    } else {
+        for (dim_t k = 0; k < kb; k++)
+            cvt_float16_to_float(b + k * nb, B + n0 + (k0 + k) * ldb, nb);
+    }
+}
+
+} // namespace
+
+dnnl_status_t simple_gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *m, const dim_t *n, const dim_t *k, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    const dim_t M = *m, N = *n, K = *k;
+    if (M == 0 || N == 0) return dnnl_success;
+
+    const bool ta = utils::one_of(*transa, 'T', 't');
+    const bool tb = utils::one_of(*transb, 'T', 't');
+
+    if (K == 0) {
+        // A and B are not accessed, C is only scaled.
+        parallel_nd(N, M, [&](dim_t j, dim_t i) {
+            float &c = C[i + j * *ldc];
+            c = *beta == 0.f ? 0.f : *beta * c;
+        });
+        return dnnl_success;
+    }
+
+    // Small problems do not pay for the threads.
+    const double work = (double)M * N * K;
+    const int nthr
+            = work < 64. * 64. * 64. ? 1 : dnnl_get_current_num_threads();
+    int nthr_m = 1, nthr_n = 1;
+    partition_mn(M, N, nthr, nthr_m, nthr_n);
+
+    const dim_t mb_max = utils::div_up(M, nthr_m);
+    const dim_t nb_max = utils::div_up(N, nthr_n);
+    // K is split into blocks for the converted blocks of a thread to fit in
+    // half of the L3 cache share of a core, with 64 columns at least.
+    const dim_t max_elems
+            = platform::get_per_core_cache_size(3) / 2 / sizeof(float);
+    const dim_t kb_max = nstl::min(
+            K, nstl::max<dim_t>(64, max_elems / (mb_max + nb_max)));
+
+    const size_t buf_size = (mb_max + nb_max) * kb_max;
+    float *buf = (float *)malloc(sizeof(float) * buf_size * nthr_m * nthr_n,
+            platform::get_cache_line_size());
+    if (buf == nullptr) return dnnl_out_of_memory;
+
+    dnnl_status_t st = dnnl_success;
+    parallel(nthr_m * nthr_n, [&](int ithr, int) {
+        const int ithr_m = ithr % nthr_m;
+        const int ithr_n = ithr / nthr_m;
+        const dim_t m0 = ithr_m * mb_max;
+        const dim_t n0 = ithr_n * nb_max;
+        const dim_t mb = nstl::min(mb_max, M - m0);
+        const dim_t nb = nstl::min(nb_max, N - n0);
+        if (mb <= 0 || nb <= 0) return;
+
+        float *a = buf + ithr * buf_size;
+        float *b = a + mb_max * kb_max;
+        float *c = C + m0 + n0 * *ldc;
+
+        for (dim_t k0 = 0; k0 < K; k0 += kb_max) {
+            const dim_t kb = nstl::min(kb_max, K - k0);
+            cvt_a_block(ta, m0, mb, k0, kb, A, *lda, a);
+            cvt_b_block(tb, n0, nb, k0, kb, B, *ldb, b);
+
+            const dim_t lda_f32 = ta ? kb : mb;
+            const dim_t ldb_f32 = tb ? nb : kb;
+            const float one = 1.f;
+            // The calls are sequential since they run in a parallel region.
+            dnnl_status_t st_thr = extended_sgemm(transa, transb, &mb, &nb,
+                    &kb, alpha, a, &lda_f32, b, &ldb_f32,
+                    k0 == 0 ? beta : &one, c, ldc);
+            if (st_thr != dnnl_success) {
+                st = st_thr;
+                return;
+            }
+        }
+    });
+
+    free(buf);
+    return st;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
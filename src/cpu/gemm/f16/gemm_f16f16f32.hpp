@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_F16_GEMM_F16F16F32_HPP
+#define CPU_GEMM_F16_GEMM_F16F16F32_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/float16.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Computes C = alpha * op(A) * op(B) + beta * C in f32 with the f16 matrices
+// A and B converted to f32 block by block, so that the f16 data is read from
+// memory once per thread and the full f32 copies of A and B are never
+// materialized.
+dnnl_status_t simple_gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif // CPU_GEMM_F16_GEMM_F16F16F32_HPP
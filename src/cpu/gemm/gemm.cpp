@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/bfloat16.hpp"
@@ -27,6 +30,7 @@
 #include "cpu/gemm/gemm_msan_unpoison.hpp"
 #include "cpu/gemm/os_blas.hpp"
 
+#include "cpu/gemm/f16/gemm_f16f16f32.hpp"
 #include "cpu/gemm/f32/ref_gemm_f32.hpp"
 #include "cpu/gemm/s8x8s32/ref_gemm_s8x8s32.hpp"
 #include "cpu/gemm/s8x8s32/simple_gemm_s8s8s32.hpp"
@@ -249,6 +253,128 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
     return dnnl_unimplemented;
 }
 
+dnnl_status_t gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A, lda, B,
+            ldb, C, ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+
+    if (utils::one_of(*transa, 'P', 'p') || utils::one_of(*transb, 'P', 'p')
+            || !platform::has_f16_compute_support())
+        return dnnl_unimplemented;
+
+    return simple_gemm_f16f16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+namespace {
+// Problems smaller than this per thread do not keep all the threads busy,
+// hence a batch of them is computed by distributing the problems.
+constexpr dim_t gemm_batch_min_thread_cost = 64 * 64 * 64;
+
+dnnl_status_t check_gemm_batch_problem(
+        const gemm_batch_problem_t<float, float, float> &p) {
+    return check_gemm_input(&p.transa, &p.transb, &p.M, &p.N, &p.K, p.A,
+            &p.lda, p.B, &p.ldb, p.C, &p.ldc, &p.alpha, &p.beta, false);
+}
+
+template <typename b_dt>
+dnnl_status_t check_gemm_batch_problem(
+        const gemm_batch_problem_t<int8_t, b_dt, int32_t> &p) {
+    return check_gemm_x8x8x32_input(&p.offsetc, &p.transa, &p.transb, &p.M,
+            &p.N, &p.K, p.A, &p.lda, p.B, &p.ldb, p.C, &p.ldc, &p.alpha,
+            &p.beta, false);
+}
+
+dnnl_status_t compute_gemm_batch_problem(
+        const gemm_batch_problem_t<float, float, float> &p) {
+    return extended_sgemm(&p.transa, &p.transb, &p.M, &p.N, &p.K, &p.alpha,
+            p.A, &p.lda, p.B, &p.ldb, &p.beta, p.C, &p.ldc);
+}
+
+template <typename b_dt>
+dnnl_status_t compute_gemm_batch_problem(
+        const gemm_batch_problem_t<int8_t, b_dt, int32_t> &p) {
+    return gemm_s8x8s32<b_dt>(&p.transa, &p.transb, &p.offsetc, &p.M, &p.N,
+            &p.K, &p.alpha, p.A, &p.lda, &p.ao, p.B, &p.ldb, &p.bo, &p.beta,
+            p.C, &p.ldc, p.co);
+}
+} // namespace
+
+template <typename a_dt, typename b_dt, typename c_dt>
+dnnl_status_t gemm_batch(dim_t batch_size,
+        const std::function<gemm_batch_problem_t<a_dt, b_dt, c_dt>(dim_t)>
+                &get_problem) {
+    if (batch_size < 0) return dnnl_invalid_arguments;
+
+    // The prefix sums of the costs of the problems, to split the batch
+    // between the threads.
+    std::vector<dim_t> cost(batch_size);
+    dim_t total_cost = 0;
+    for (dim_t i = 0; i < batch_size; i++) {
+        const auto p = get_problem(i);
+        // Packed matrices are not supported in batches.
+        if (!utils::one_of(p.transa, 'N', 'n', 'T', 't')
+                || !utils::one_of(p.transb, 'N', 'n', 'T', 't'))
+            return dnnl_invalid_arguments;
+        dnnl_status_t status = check_gemm_batch_problem(p);
+        if (status != dnnl_success) return status;
+        total_cost += p.M * p.N * p.K + 1;
+        cost[i] = total_cost;
+    }
+    if (batch_size == 0) return dnnl_success;
+
+    // A few problems big enough for all the threads are computed one after
+    // another, each by all the threads.
+    const int nthr = dnnl_get_current_num_threads();
+    const dim_t avg_cost = total_cost / batch_size;
+    if (nthr == 1
+            || (batch_size < nthr
+                    && avg_cost >= nthr * gemm_batch_min_thread_cost)) {
+        for (dim_t i = 0; i < batch_size; i++) {
+            dnnl_status_t status = compute_gemm_batch_problem(get_problem(i));
+            if (status != dnnl_success) return status;
+        }
+        return dnnl_success;
+    }
+
+    std::vector<dnnl_status_t> thr_status(nthr, dnnl_success);
+    parallel(nthr, [&](int ithr, int nthr) {
+        // Every thread takes a contiguous range of problems of about the same
+        // cost.
+        auto first_problem = [&](int ithr) {
+            const dim_t start_cost = (dim_t)((double)total_cost * ithr / nthr);
+            return (dim_t)(std::upper_bound(cost.begin(), cost.end(),
+                                   start_cost)
+                    - cost.begin());
+        };
+        const dim_t start = first_problem(ithr);
+        const dim_t end = first_problem(ithr + 1);
+
+#if DNNL_X64
+        gemm_batch_thread_scope_t batch_scope;
+#endif
+        for (dim_t i = start; i < end && thr_status[ithr] == dnnl_success; i++)
+            thr_status[ithr] = compute_gemm_batch_problem(get_problem(i));
+    });
+
+    for (auto status : thr_status)
+        if (status != dnnl_success) return status;
+    return dnnl_success;
+}
+
+template dnnl_status_t gemm_batch<float, float, float>(dim_t batch_size,
+        const std::function<gemm_batch_problem_t<float, float, float>(dim_t)>
+                &get_problem);
+template dnnl_status_t gemm_batch<int8_t, uint8_t, int32_t>(dim_t batch_size,
+        const std::function<gemm_batch_problem_t<int8_t, uint8_t, int32_t>(
+                dim_t)> &get_problem);
+template dnnl_status_t gemm_batch<int8_t, int8_t, int32_t>(dim_t batch_size,
+        const std::function<gemm_batch_problem_t<int8_t, int8_t, int32_t>(
+                dim_t)> &get_problem);
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2021 Intel Corporation
+* Copyright 2018-2022 Intel Corporation
 * Copyright 2022 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,9 +18,12 @@
 #ifndef CPU_GEMM_GEMM_HPP
 #define CPU_GEMM_GEMM_HPP
 
+#include <functional>
+
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/bfloat16.hpp"
+#include "common/float16.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -56,6 +59,42 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+dnnl_status_t gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
+
+// A problem of a batch of GEMMs, with the parameters of the functions above.
+// The offsets are only used by the integer GEMMs.
+template <typename a_dt, typename b_dt, typename c_dt>
+struct gemm_batch_problem_t {
+    char transa;
+    char transb;
+    char offsetc;
+    dim_t M;
+    dim_t N;
+    dim_t K;
+    float alpha;
+    const a_dt *A;
+    dim_t lda;
+    a_dt ao;
+    const b_dt *B;
+    dim_t ldb;
+    b_dt bo;
+    float beta;
+    c_dt *C;
+    dim_t ldc;
+    const c_dt *co;
+};
+
+// Computes the `batch_size` problems returned by `get_problem` in a single
+// parallel region. The problems are validated before any of them is
+// computed. Supported types: f32:f32:f32, s8:u8:s32 and s8:s8:s32.
+template <typename a_dt, typename b_dt, typename c_dt>
+dnnl_status_t gemm_batch(dim_t batch_size,
+        const std::function<gemm_batch_problem_t<a_dt, b_dt, c_dt>(dim_t)>
+                &get_problem);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
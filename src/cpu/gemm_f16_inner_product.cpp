@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/binary_injector_utils.hpp"
+#include "cpu/gemm_f16_inner_product.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::data_type;
+using namespace memory_tracking::names;
+
+template <data_type_t dst_data_type>
+status_t gemm_f16_inner_product_fwd_t<dst_data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector_utils::prepare_binary_args(
+                    this->pd()->attr()->post_ops_, ctx);
+
+    const dim_t M = pd()->OC();
+    const dim_t N = pd()->MB();
+    const dim_t K = pd()->IC_total_padded();
+
+    const auto &wmd = *pd()->weights_md();
+    const auto &smd = *pd()->src_md();
+    bool wei_tr = wmd.format_desc.blocking.strides[0] != 1;
+    // check if MB is the leading dimension
+    bool src_tr = smd.format_desc.blocking.strides[0] == 1 && K > 1;
+
+    acc_data_t *acc = pd()->dst_is_acc_
+            ? (acc_data_t *)dst
+            : ctx.get_scratchpad_grantor().template get<acc_data_t>(
+                    key_iprod_int_dat_in_acc_dt);
+
+    float alpha = 1.0;
+    status_t st = gemm_f16f16f32(wei_tr ? "T" : "N", src_tr ? "T" : "N", &M,
+            &N, &K, &alpha, weights, wei_tr ? &K : &M, src, src_tr ? &N : &K,
+            &beta_, acc, &M);
+    if (st != status::success) return st;
+
+    const float *scales = pd()->attr()->output_scales_.scales_;
+    if (postops_in_ip_) {
+        const bool force_sequential = pp_kernel_->sequential_kernel();
+        parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            size_t work_size = M * N;
+            balance211(work_size, nthr, ithr, start, end);
+            const size_t dst_logical_off = start;
+            const size_t dim1_off = start % M;
+            (*pp_kernel_)(dst, acc, bias, scales, start, dst_logical_off,
+                    dim1_off, end, 0, 0, nullptr,
+                    post_ops_binary_rhs_arg_vec.data(), dst, 0, ctx,
+                    *pd()->dst_md());
+        });
+    }
+
+    return st;
+}
+
+template struct gemm_f16_inner_product_fwd_t<data_type::f32>;
+template struct gemm_f16_inner_product_fwd_t<data_type::f16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_F16_INNER_PRODUCT_HPP
+#define CPU_GEMM_F16_INNER_PRODUCT_HPP
+
+#include <assert.h>
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm_inner_product_utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_inner_product_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Forward inner product with f16 source and weights, computed in f32.
+template <data_type_t dst_data_type>
+struct gemm_f16_inner_product_fwd_t : public primitive_t {
+    struct pd_t : public cpu_inner_product_fwd_pd_t {
+        using cpu_inner_product_fwd_pd_t::cpu_inner_product_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_f16_inner_product_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace utils;
+            using namespace data_type;
+
+            bool ok = true && platform::has_f16_compute_support() && is_fwd()
+                    && !has_zero_dim_memory()
+                    && everyone_is(
+                            f16, src_md()->data_type, weights_md()->data_type)
+                    && dst_data_type == dst_md()->data_type
+                    && IMPLICATION(with_bias(),
+                            one_of(weights_md(1)->data_type, f32, f16))
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && inner_product_utils::post_ops_ok(
+                            attr()->post_ops_, &dst_md_)
+                    && set_default_params() == status::success
+                    && dense_gemm_consitency_check(
+                            src_md(), weights_md(), dst_md())
+                    && attr_.set_default_formats(dst_md(0)) == status::success;
+            if (!ok) return status::unimplemented;
+
+            dst_is_acc_ = dst_data_type == f32;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        bool dst_is_acc_;
+
+    protected:
+        void init_scratchpad() {
+            if (!dst_is_acc_) {
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<acc_data_t>(
+                        memory_tracking::names::key_iprod_int_dat_in_acc_dt,
+                        MB() * OC());
+            }
+        }
+    };
+
+    gemm_f16_inner_product_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    typedef typename prec_traits<dst_data_type>::type dst_data_t;
+    typedef typename prec_traits<data_type::f32>::type acc_data_t;
+    typedef typename prec_traits<data_type::f16>::type src_data_t;
+    typedef typename prec_traits<data_type::f16>::type wei_data_t;
+
+    status_t init(engine_t *engine) override {
+        const bool has_bias = pd()->with_bias();
+        const bool has_eltwise
+                = pd()->attr()->post_ops_.find(primitive_kind::eltwise) >= 0;
+        const bool has_binary
+                = pd()->attr()->post_ops_.find(primitive_kind::binary) >= 0;
+        const bool has_sum_as_postops = !pd()->dst_is_acc_;
+        postops_in_ip_ = false
+                || !pd()->dst_is_acc_ /* includes has_sum_as_postops */
+                || has_bias || has_eltwise || has_binary;
+        // The accumulation is done in f32 regardless of the f16 accumulation
+        // data type of the descriptor.
+        if (postops_in_ip_)
+            CHECK(safe_ptr_assign(pp_kernel_,
+                    inner_product_utils::pp_kernel_t::create(pd()->OC(),
+                            pd()->MB(), pd()->OC(), pd()->attr(),
+                            pd()->desc()->bias_desc.data_type, data_type::f32,
+                            pd()->dst_md(), !has_sum_as_postops)));
+
+        auto sum_idx = pd()->attr()->post_ops_.find(primitive_kind::sum);
+        beta_ = sum_idx >= 0 && !has_sum_as_postops
+                ? pd()->attr()->post_ops_.entry_[sum_idx].sum.scale
+                : 0.0;
+
+        return (pp_kernel_) ? pp_kernel_->create_kernel() : status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    std::unique_ptr<inner_product_utils::pp_kernel_t> pp_kernel_;
+    bool postops_in_ip_;
+    float beta_;
+
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -16,6 +16,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/stream_profiler.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/binary_injector_utils.hpp"
@@ -135,17 +136,22 @@ status_t gemm_inner_product_bwd_weights_t<data_type>::execute_backward_weights(
 
     float alpha = 1.0, beta = 0.0;
     status_t st = status::success;
-    if (wei_tr)
-        st = extended_sgemm("N", src_tr ? "N" : "T", &OC, &IC, &MB, &alpha,
-                diff_dst, &OC, src, src_tr ? &MB : &IC, &beta, diff_weights,
-                &OC);
-    else
-        st = extended_sgemm("N", src_tr ? "N" : "T", &IC, &OC, &MB, &alpha, src,
-                src_tr ? &MB : &IC, diff_dst, &OC, &beta, diff_weights, &IC);
+    {
+        profiling_phase_t phase(ctx, "gemm");
+        if (wei_tr)
+            st = extended_sgemm("N", src_tr ? "N" : "T", &OC, &IC, &MB, &alpha,
+                    diff_dst, &OC, src, src_tr ? &MB : &IC, &beta,
+                    diff_weights, &OC);
+        else
+            st = extended_sgemm("N", src_tr ? "N" : "T", &IC, &OC, &MB, &alpha,
+                    src, src_tr ? &MB : &IC, diff_dst, &OC, &beta,
+                    diff_weights, &IC);
+    }
 
     if (st != status::success) return st;
 
     if (diff_bias) {
+        profiling_phase_t phase(ctx, "bias_reduction");
         diff_bias += diff_bias_d.offset0();
         constexpr dim_t blksize = 8;
         const dim_t OC_blocks = utils::div_up(OC, blksize);
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/numa.hpp"
+
+// mbind() is called directly to not depend on libnuma.
+#if defined(__linux__) && defined(SYS_mbind)
+#define DNNL_CPU_NUMA_LINUX 1
+#define DNNL_MPOL_PREFERRED 1
+#else
+#define DNNL_CPU_NUMA_LINUX 0
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+namespace {
+
+// Buffers smaller than this are not worth a parallel region to touch them.
+constexpr size_t first_touch_min_size = (size_t)1 << 20;
+
+#if DNNL_CPU_NUMA_LINUX
+// Parses a sysfs list like "0-3,8,10-11".
+std::vector<int> parse_list(const std::string &s) {
+    std::vector<int> list;
+    size_t pos = 0;
+    while (pos < s.size()) {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos) end = s.size();
+        const std::string range = s.substr(pos, end - pos);
+        int first = 0, last = 0;
+        const int n = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (n >= 1) {
+            if (n == 1) last = first;
+            for (int i = first; i <= last; i++)
+                list.push_back(i);
+        }
+        pos = end + 1;
+    }
+    return list;
+}
+
+std::vector<int> read_list(const std::string &path) {
+    FILE *f = std::fopen(path.c_str(), "r");
+    if (f == nullptr) return {};
+    char buf[4096] = {0};
+    const bool ok = std::fgets(buf, sizeof(buf), f) != nullptr;
+    std::fclose(f);
+    return ok ? parse_list(buf) : std::vector<int>();
+}
+
+struct topology_t {
+    // The system ids of the online nodes.
+    std::vector<int> node_ids;
+    // The CPUs of every node that belong to the process affinity mask.
+    std::vector<cpu_set_t> node_cpus;
+
+    topology_t() {
+        const std::string root = "/sys/devices/system/node/";
+        node_ids = read_list(root + "online");
+
+        cpu_set_t process_cpus;
+        CPU_ZERO(&process_cpus);
+        if (sched_getaffinity(0, sizeof(process_cpus), &process_cpus) != 0)
+            node_ids.clear();
+
+        for (int id : node_ids) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            for (int cpu : read_list(
+                         root + "node" + std::to_string(id) + "/cpulist"))
+                if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &process_cpus))
+                    CPU_SET(cpu, &cpus);
+            node_cpus.push_back(cpus);
+        }
+    }
+};
+
+const topology_t &topology() {
+    static const topology_t t;
+    return t;
+}
+
+void bind_thread(int node) {
+    // The affinity of the thread before the first binding.
+    thread_local cpu_set_t saved_cpus;
+    thread_local int bound_node = -1;
+    if (bound_node == node) return;
+
+    if (node < 0) {
+        sched_setaffinity(0, sizeof(saved_cpus), &saved_cpus);
+        bound_node = -1;
+        return;
+    }
+
+    const cpu_set_t &cpus = topology().node_cpus[node];
+    // Leave the thread as is if the process cannot run on the node.
+    if (CPU_COUNT(&cpus) == 0) return;
+    if (bound_node < 0
+            && sched_getaffinity(0, sizeof(saved_cpus), &saved_cpus) != 0)
+        return;
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) == 0) bound_node = node;
+}
+
+size_t get_page_size() {
+    static const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    return page_size;
+}
+
+void bind_memory(void *ptr, size_t size, int node) {
+    const int id = topology().node_ids[node];
+    const int bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(id / bits + 1, 0);
+    mask[id / bits] = 1UL << (id % bits);
+
+    const size_t page_size = get_page_size();
+    const size_t len = utils::rnd_up(size, page_size);
+    // A failure only means that the pages are placed by the default policy.
+    syscall(SYS_mbind, ptr, len, DNNL_MPOL_PREFERRED, mask.data(),
+            mask.size() * bits + 1, 0);
+}
+#endif
+
+bool first_touch_enabled() {
+    static const bool enabled = getenv_int_user("CPU_FIRST_TOUCH", 1) != 0;
+    return enabled;
+}
+
+} // namespace
+
+int get_node_count() {
+#if DNNL_CPU_NUMA_LINUX
+    return nstl::max(1, (int)topology().node_ids.size());
+#else
+    return 1;
+#endif
+}
+
+void bind_threads(int node) {
+#if DNNL_CPU_NUMA_LINUX && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Every master thread has its own team. The node and the size of the team
+    // of the calling thread at the last binding: unbound engines do not pay
+    // for the binding until an engine bound to a node is used, and the new
+    // threads of a grown team are bound as well.
+    thread_local int team_node = -1;
+    thread_local int team_nthr = 0;
+    if (node >= (int)topology().node_ids.size()) return;
+    const int nthr = dnnl_get_max_threads();
+    if (team_node == node && (node < 0 || team_nthr == nthr)) return;
+
+    parallel(0, [&](int, int) { bind_thread(node); });
+    team_node = node;
+    team_nthr = nthr;
+#else
+    UNUSED(node);
+#endif
+}
+
+bool is_placement_enabled(int node) {
+#if DNNL_CPU_NUMA_LINUX
+    return node >= 0 && node < (int)topology().node_ids.size();
+#else
+    UNUSED(node);
+    return false;
+#endif
+}
+
+void place(void *ptr, size_t size, int node) {
+#if DNNL_CPU_NUMA_LINUX
+    if (ptr == nullptr || size == 0 || !is_placement_enabled(node)) return;
+    bind_memory(ptr, size, node);
+
+    if (!first_touch_enabled() || size < first_touch_min_size) return;
+
+    // The pages are touched by the team that will use them.
+    bind_threads(node);
+    const size_t page_size = get_page_size();
+    const size_t npages = utils::div_up(size, page_size);
+    parallel(0, [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        balance211(npages, nthr, ithr, start, end);
+        auto *p = reinterpret_cast<volatile char *>(ptr);
+        for (size_t i = start; i < end; i++)
+            p[i * page_size] = 0;
+    });
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(node);
+#endif
+}
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
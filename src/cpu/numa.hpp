@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NUMA_HPP
+#define CPU_NUMA_HPP
+
+#include <cstddef>
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+// NUMA placement of CPU engines.
+//
+// The nodes are numbered from 0 to get_node_count() - 1 in the order of the
+// online nodes of the system. The topology is read from sysfs on Linux; on
+// other systems, or when the topology is not available, there is a single
+// node and binding to it does nothing.
+
+// Returns the number of NUMA nodes (at least 1).
+int get_node_count();
+
+// Binds the threads of the team of the calling thread to the CPUs of `node`
+// that belong to the process affinity mask. If `node` is negative, the
+// threads get back the affinity they had before the first binding. The
+// binding is skipped when the team is already bound to `node`. Only OpenMP
+// teams are bound: TBB and user threadpools do not guarantee that every
+// worker takes part in a parallel region.
+void bind_threads(int node);
+
+// Places the pages of a newly allocated buffer of an engine bound to `node`
+// before its first use:
+// - the buffer is bound to the memory of `node`;
+// - big buffers are touched by the thread team bound as by bind_threads(node),
+//   each thread touching the part of the buffer it would process with the
+//   default static work partitioning.
+// Buffers of unbound engines (negative `node`) are left to the default policy
+// of the system. `ptr` is expected to be page aligned.
+void place(void *ptr, size_t size, int node);
+
+// Returns true if buffers of an engine bound to `node` are to be placed,
+// i.e. allocated page aligned and passed to place().
+bool is_placement_enabled(int node);
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -115,6 +115,14 @@ bool has_data_type_support(data_type_t data_type) {
     }
 }
 
+bool has_f16_compute_support() {
+#if DNNL_X64
+    return x64::mayiuse(x64::avx2) && x64::cpu().has(Xbyak::util::Cpu::tF16C);
+#else
+    return false;
+#endif
+}
+
 float s8s8_weights_scale_factor() {
 #if DNNL_X64
     return x64::mayiuse(x64::avx512_core_vnni) ? 1.0f : 0.5f;
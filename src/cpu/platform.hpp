@@ -153,6 +153,9 @@ dnnl_cpu_isa_hints_t get_cpu_isa_hints();
 
 bool DNNL_API prefer_ymm_requested();
 bool DNNL_API has_data_type_support(data_type_t data_type);
+// Returns true if the f16 matmul, inner product and convolution can compute
+// in f32 with the f16 data converted on the fly.
+bool DNNL_API has_f16_compute_support();
 float DNNL_API s8s8_weights_scale_factor();
 
 unsigned get_per_core_cache_size(int level);
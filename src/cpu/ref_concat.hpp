@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2021 Intel Corporation
+* Copyright 2017-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -55,8 +55,14 @@ struct ref_concat_t : public primitive_t {
 
             reorder_pds_.resize(n_ + use_tent_dst());
             for (int i = 0; i < n_; ++i) {
-                CHECK(reorder_primitive_desc_create(
-                        reorder_pds_[i], engine, src_md(i), src_image_md(i)));
+                // the scale of the source is applied by its reorder
+                primitive_attr_t r_attr;
+                const auto &scales
+                        = attr()->scales_.get(DNNL_ARG_MULTIPLE_SRC + i);
+                if (!scales.has_default_values())
+                    CHECK(r_attr.output_scales_.copy_from(scales));
+                CHECK(reorder_primitive_desc_create(reorder_pds_[i], engine,
+                        src_md(i), src_image_md(i), &r_attr));
             }
 
             if (use_tent_dst()) {
@@ -115,6 +121,11 @@ struct ref_concat_t : public primitive_t {
             exec_args_t r_args;
             r_args[DNNL_ARG_SRC] = src;
             r_args[DNNL_ARG_DST] = dst;
+            // runtime scales of the sources are passed to their reorders
+            const int scales_arg = DNNL_ARG_ATTR_INPUT_SCALES
+                    | (DNNL_ARG_MULTIPLE_SRC + r_num);
+            if (r_num < n && ctx.args().count(scales_arg))
+                r_args[DNNL_ARG_ATTR_OUTPUT_SCALES] = ctx.args().at(scales_arg);
             exec_ctx_t r_ctx(ctx, std::move(r_args));
 
             nested_scratchpad_t ns(ctx, key_nested_multiple + r_num, reorder);
@@ -143,6 +154,14 @@ struct ref_concat_t : public primitive_t {
         } else {
             auto &dst_mem_storage = CTX_OUT_STORAGE(DNNL_ARG_DST);
             for (int i = 0; i < n; ++i) {
+                // a source placed in the destination memory is already in
+                // its image
+                const auto &src_mem_storage
+                        = CTX_IN_STORAGE(DNNL_ARG_MULTIPLE_SRC + i);
+                if (src_mem_storage.data_handle()
+                                == dst_mem_storage.data_handle()
+                        && pd()->src_inplace(i))
+                    continue;
                 memory_t tent_dst_i(
                         engine, pd()->src_image_md(i), dst_mem_storage.clone());
                 execute_reorder(reorders_[i],
@@ -47,19 +47,15 @@ struct ref_convolution_fwd_t : public primitive_t {
 
             bool ok = is_fwd()
                     && set_default_alg_kind(alg_kind::convolution_direct)
-                    && platform::has_data_type_support(src_type)
-                    && platform::has_data_type_support(wei_type)
-                    && platform::has_data_type_support(bia_type)
-                    && platform::has_data_type_support(dst_type)
-                    && utils::one_of(src_type, f32, bf16)
-                    && utils::one_of(wei_type, f32, bf16)
-                    && utils::one_of(dst_type, f32, bf16)
+                    && (src_type == f16
+                                    ? platform::has_f16_compute_support()
+                                    : platform::has_data_type_support(
+                                            src_type))
+                    && utils::one_of(src_type, f32, bf16, f16)
                     && src_type == wei_type
-                    && IMPLICATION(src_type == f32, dst_type == f32)
+                    && utils::one_of(dst_type, f32, src_type)
                     && IMPLICATION(with_bias(),
-                            utils::one_of(bia_type, f32, bf16)
-                                    && IMPLICATION(
-                                            src_type == f32, bia_type == f32))
+                            utils::one_of(bia_type, f32, src_type))
                     && set_default_formats()
                     && attr()->has_default_values(
                             smask_t::post_ops | smask_t::sum_dt, dst_type)
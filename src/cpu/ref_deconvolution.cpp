@@ -19,6 +19,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/dnnl_traits.hpp"
 #include "common/math_utils.hpp"
+#include "common/stream_profiler.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_primitive.hpp"
@@ -448,6 +449,7 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     // When sum post-op happens, we need to copy original destination memory
     // prior call to external convolution happens.
     if (pd()->attr()->post_ops_.find(primitive_kind::sum) != -1) {
+        profiling_phase_t phase(ctx, "copy_dst");
         void *original_dst = scratchpad.get(key_deconv_sum);
         const memory_desc_wrapper dst_d(pd()->dst_md());
         void *dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
@@ -468,12 +470,16 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
 
     nested_scratchpad_t ns(ctx, key_nested, conv_p_);
     conv_ctx.set_scratchpad_grantor(ns.grantor());
-    auto status = conv_p_->execute(conv_ctx);
-    if (status != status::success) return status;
+    {
+        profiling_phase_t phase(ctx, "convolution");
+        auto status = conv_p_->execute(conv_ctx);
+        if (status != status::success) return status;
+    }
 
     using namespace data_type;
 
     if (!pd()->attr()->zero_points_.has_default_values(DNNL_ARG_SRC)) {
+        profiling_phase_t phase(ctx, "src_zero_point");
         float *conv_output = scratchpad.get<float>(key_deconv_bias);
         const auto wei_dt = pd()->weights_md()->data_type;
         switch (wei_dt) {
@@ -486,12 +492,14 @@ status_t ref_deconvolution_fwd_t::execute(const exec_ctx_t &ctx) const {
     float *conv_output = scratchpad.get<float>(key_deconv_bias);
 
     if (ref_bias) {
+        profiling_phase_t phase(ctx, "bias");
         void *dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
         void *tmp_output = non_default_attr ? conv_output : dst;
         compute_fwd_bias(ctx, tmp_output, conv_output, non_default_attr);
     }
 
     if (non_default_attr) {
+        profiling_phase_t phase(ctx, "post_ops");
         void *original_dst = scratchpad.get<void>(key_deconv_sum);
         compute_ref_attrs(ctx, conv_output, original_dst);
     }
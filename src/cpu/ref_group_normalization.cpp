@@ -0,0 +1,267 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_group_normalization.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// Returns the offset of the element (n, c, sp) of a data tensor, where sp is
+// the index of the point in the flattened spatial dimensions.
+dim_t data_off(const memory_desc_wrapper &mdw, dim_t n, dim_t c, dim_t sp) {
+    dims_t pos = {n, c};
+    for (int d = mdw.ndims() - 1; d >= 2; d--) {
+        pos[d] = sp % mdw.dims()[d];
+        sp /= mdw.dims()[d];
+    }
+    return mdw.off_v(pos);
+}
+
+} // namespace
+
+status_t ref_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const auto use_scale = pd()->use_scale();
+    const auto use_shift = pd()->use_shift();
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto scale = use_scale ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                           : nullptr;
+    auto shift = use_shift ? CTX_IN_MEM(const float *, DNNL_ARG_SHIFT)
+                           : nullptr;
+
+    auto mean = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+    auto variance = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t CG = pd()->C_per_group();
+    const dim_t SP = pd()->SP();
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool save_stats = pd()->is_training();
+    const bool calculate_stats = !pd()->stats_are_src();
+
+    /* fast return */
+    if (pd()->has_zero_dim_memory()) {
+        if (calculate_stats && save_stats) {
+            parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+                mean[stat_d.off(n, g)] = 0;
+                variance[stat_d.off(n, g)] = 0;
+            });
+        }
+        return status::success;
+    }
+
+    parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+        const dim_t s_off = stat_d.off(n, g);
+        const dim_t c_start = g * CG, c_end = c_start + CG;
+        float v_mean = calculate_stats ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
+
+        if (calculate_stats) {
+            for_(dim_t c = c_start; c < c_end; ++c)
+            for (dim_t sp = 0; sp < SP; ++sp)
+                v_mean += io::load_float_value(
+                        src_d.data_type(), src, data_off(src_d, n, c, sp));
+            v_mean /= CG * SP;
+
+            for_(dim_t c = c_start; c < c_end; ++c)
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                const float m = io::load_float_value(src_d.data_type(), src,
+                                        data_off(src_d, n, c, sp))
+                        - v_mean;
+                v_variance += m * m;
+            }
+            v_variance /= CG * SP;
+        }
+
+        const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+        for (dim_t c = c_start; c < c_end; ++c) {
+            const float sm = (scale ? scale[ss_d.off(c)] : 1.f) * inv_sqrtvar;
+            const float sv = shift ? shift[ss_d.off(c)] : 0.f;
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                const float s = io::load_float_value(
+                        src_d.data_type(), src, data_off(src_d, n, c, sp));
+                float d = sm * (s - v_mean) + sv;
+
+                ref_post_ops_t::args_t args;
+                args.ctx = &ctx;
+                args.l_offset = (n * C + c) * SP + sp;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops_->execute(d, args);
+
+                io::store_float_value(
+                        dst_d.data_type(), d, dst, data_off(dst_d, n, c, sp));
+            }
+        }
+
+        if (calculate_stats && save_stats) {
+            mean[s_off] = v_mean;
+            variance[s_off] = v_variance;
+        }
+    });
+    return status::success;
+}
+
+status_t ref_group_normalization_bwd_t::execute_backward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+    const memory_desc_wrapper diff_ss_d(pd()->diff_weights_md());
+
+    const auto use_scale = pd()->use_scale();
+    const auto use_shift = pd()->use_shift();
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    auto scale = use_scale ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                           : nullptr;
+    auto diff_src = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+
+    auto diff_scale = use_scale
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status)
+            : nullptr;
+    CHECK(status);
+    auto diff_shift = use_shift
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status)
+            : nullptr;
+    CHECK(status);
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t CG = pd()->C_per_group();
+    const dim_t SP = pd()->SP();
+
+    /* fast return */
+    if (pd()->has_zero_dim_memory()) {
+        if (diff_scale || diff_shift) {
+            parallel_nd(C, [&](dim_t c) {
+                if (diff_scale) diff_scale[diff_ss_d.off(c)] = 0;
+                if (diff_shift) diff_shift[diff_ss_d.off(c)] = 0;
+            });
+        }
+        return status::success;
+    }
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_diff_stats = !pd()->use_global_stats();
+
+    const auto load_src = [&](dim_t n, dim_t c, dim_t sp) {
+        return io::load_float_value(
+                src_d.data_type(), src, data_off(src_d, n, c, sp));
+    };
+    const auto load_diff_dst = [&](dim_t n, dim_t c, dim_t sp) {
+        return io::load_float_value(diff_dst_d.data_type(), diff_dst,
+                data_off(diff_dst_d, n, c, sp));
+    };
+
+    if (diff_scale || diff_shift) {
+        parallel_nd(C, [&](dim_t c) {
+            const dim_t g = c / CG;
+            float diff_gamma = 0;
+            float diff_beta = 0;
+
+            for (dim_t n = 0; n < MB; ++n) {
+                const dim_t s_off = stat_d.off(n, g);
+                const float inv_sqrtvar = 1.f / sqrtf(variance[s_off] + eps);
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    const float dd = load_diff_dst(n, c, sp);
+                    diff_gamma += (load_src(n, c, sp) - mean[s_off]) * dd
+                            * inv_sqrtvar;
+                    diff_beta += dd;
+                }
+            }
+
+            if (diff_scale) diff_scale[diff_ss_d.off(c)] = diff_gamma;
+            if (diff_shift) diff_shift[diff_ss_d.off(c)] = diff_beta;
+        });
+    }
+
+    parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+        const dim_t s_off = stat_d.off(n, g);
+        const dim_t c_start = g * CG, c_end = c_start + CG;
+        const float M = CG * SP;
+        const float inv_sqrtvar = 1.f / sqrtf(variance[s_off] + eps);
+
+        float dd_gamma = 0, dd_gamma_x = 0;
+        if (calculate_diff_stats) {
+            for (dim_t c = c_start; c < c_end; ++c) {
+                const float gamma = scale ? scale[ss_d.off(c)] : 1.f;
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    const float dd = load_diff_dst(n, c, sp);
+                    dd_gamma += dd * gamma;
+                    dd_gamma_x
+                            += dd * gamma * (load_src(n, c, sp) - mean[s_off]);
+                }
+            }
+            dd_gamma_x *= inv_sqrtvar;
+        }
+
+        for (dim_t c = c_start; c < c_end; ++c) {
+            const float gamma = scale ? scale[ss_d.off(c)] : 1.f;
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                float v_diff_src = load_diff_dst(n, c, sp) * gamma;
+                if (calculate_diff_stats)
+                    v_diff_src -= dd_gamma / M
+                            + (load_src(n, c, sp) - mean[s_off]) * dd_gamma_x
+                                    * inv_sqrtvar / M;
+                v_diff_src *= inv_sqrtvar;
+                io::store_float_value(diff_src_d.data_type(), v_diff_src,
+                        diff_src, data_off(diff_src_d, n, c, sp));
+            }
+        }
+    });
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
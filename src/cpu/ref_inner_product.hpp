@@ -48,19 +48,16 @@ struct ref_inner_product_fwd_t : public primitive_t {
 
             const bool allow_all_tags = true; // ref should support all tags
 
-            bool ok = is_fwd() && platform::has_data_type_support(src_type)
-                    && platform::has_data_type_support(wei_type)
-                    && platform::has_data_type_support(bia_type)
-                    && platform::has_data_type_support(dst_type)
-                    && utils::one_of(src_type, f32, bf16)
-                    && utils::one_of(wei_type, f32, bf16)
-                    && utils::one_of(dst_type, f32, bf16)
+            bool ok = is_fwd()
+                    && (src_type == f16
+                                    ? platform::has_f16_compute_support()
+                                    : platform::has_data_type_support(
+                                            src_type))
+                    && utils::one_of(src_type, f32, bf16, f16)
                     && src_type == wei_type
-                    && IMPLICATION(src_type == f32, dst_type == f32)
+                    && utils::one_of(dst_type, f32, src_type)
                     && IMPLICATION(with_bias(),
-                            utils::one_of(bia_type, f32, bf16)
-                                    && IMPLICATION(
-                                            src_type == f32, bia_type == f32))
+                            utils::one_of(bia_type, f32, src_type))
                     && set_default_params(allow_all_tags) == status::success
                     && attr()->has_default_values(smask_t::post_ops)
                     && attr_.set_default_formats(dst_md(0)) == status::success;
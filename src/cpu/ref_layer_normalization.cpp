@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,8 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/ref_layer_normalization.hpp"
 
 namespace dnnl {
@@ -70,7 +72,8 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
 
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const float *oscale = pd()->attr()->output_scales_.scales_;
 
     const dim_t N = pd()->across_axis();
     const dim_t C = pd()->norm_axis();
@@ -123,7 +126,16 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            float d = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            d *= oscale[0];
+
+            ref_post_ops_t::args_t args;
+            args.ctx = &ctx;
+            args.l_offset = n * C + c;
+            args.dst_md = pd()->dst_md();
+            ref_post_ops_->execute(d, args);
+
+            io::store_float_value(dst_d.data_type(), d, dst, dst_off);
         }
 
         if (calculate_stats) {
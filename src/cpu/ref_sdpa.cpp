@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto q = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto mask = pd()->with_mask()
+            ? CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK)
+            : nullptr;
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t MB = pd()->MB();
+    const dim_t SQ = pd()->SQ();
+    const dim_t SKV = pd()->SKV();
+    const dim_t D = pd()->D();
+    const dim_t DV = pd()->DV();
+    const float scale = pd()->scale();
+    const bool causal = pd()->with_causal_mask();
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+
+    parallel_nd_ext(pd()->nthr_, MB, SQ, [&](int ithr, int, dim_t mb, dim_t i) {
+        float *scores = scores_base + ithr * SKV;
+        float *acc = acc_base + ithr * DV;
+
+        // The causal mask aligns the last query with the last key.
+        const dim_t n_keys
+                = causal ? nstl::max<dim_t>(0, nstl::min(SKV, i + SKV - SQ + 1))
+                         : SKV;
+
+        float max_score = -INFINITY;
+        for (dim_t j = 0; j < n_keys; j++) {
+            float s = 0;
+            for (dim_t c = 0; c < D; c++) {
+                const float q_val = io::load_float_value(
+                        q_d.data_type(), q, pd()->off(q_d, mb, i, c));
+                const float k_val = io::load_float_value(
+                        k_d.data_type(), k, pd()->off(k_d, mb, j, c));
+                s += q_val * k_val;
+            }
+            s *= scale;
+            if (mask)
+                s += io::load_float_value(
+                        mask_d.data_type(), mask, pd()->off(mask_d, mb, i, j));
+            scores[j] = s;
+            max_score = nstl::max(max_score, s);
+        }
+
+        // A query with all the keys masked out has a zero output.
+        float denom = 0;
+        for (dim_t j = 0; j < n_keys; j++) {
+            scores[j] = max_score == -INFINITY
+                    ? 0.f
+                    : expf(scores[j] - max_score);
+            denom += scores[j];
+        }
+
+        for (dim_t c = 0; c < DV; c++)
+            acc[c] = 0;
+        for (dim_t j = 0; j < n_keys; j++)
+            for (dim_t c = 0; c < DV; c++)
+                acc[c] += scores[j]
+                        * io::load_float_value(v_d.data_type(), v,
+                                pd()->off(v_d, mb, j, c));
+
+        for (dim_t c = 0; c < DV; c++) {
+            const float res = denom > 0 ? acc[c] / denom * scales[0] : 0.f;
+            io::store_float_value(
+                    dst_d.data_type(), res, dst, pd()->off(dst_d, mb, i, c));
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
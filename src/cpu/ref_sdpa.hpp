@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            bool ok = true;
+            for (int i = 0; i < 3; i++) {
+                const auto dt = src_md(i)->data_type;
+                ok = ok && utils::one_of(dt, f32, bf16, s8, u8)
+                        && platform::has_data_type_support(dt);
+            }
+            const auto mask_dt = src_md(3)->data_type;
+            const auto dst_dt = dst_md()->data_type;
+            ok = ok
+                    && IMPLICATION(with_mask(),
+                            utils::one_of(mask_dt, f32, bf16)
+                                    && platform::has_data_type_support(
+                                            mask_dt))
+                    && utils::one_of(dst_dt, f32, bf16, s8, u8)
+                    && platform::has_data_type_support(dst_dt)
+                    && attr()->has_default_values(skip_mask_t::oscale
+                            | skip_mask_t::oscale_runtime)
+                    && attr()->output_scales_.mask_ == 0
+                    && set_default_params() == status::success;
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            nthr_ = dnnl_get_max_threads();
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(key_sdpa_scores, SKV() * nthr_);
+            scratchpad.template book<float>(key_sdpa_acc, DV() * nthr_);
+        }
+    };
+
+    ref_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
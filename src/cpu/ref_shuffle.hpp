@@ -96,6 +96,11 @@ struct ref_shuffle_t : public primitive_t {
         return status::success;
     }
 
+    size_t get_resident_size() const override {
+        return primitive_t::get_resident_size()
+                + pd()->axis_size() * sizeof(int);
+    }
+
 private:
     template <int data_type_size>
     status_t execute_(const exec_ctx_t &ctx) const;
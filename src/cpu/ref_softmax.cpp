@@ -272,6 +272,13 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                     d -= sd;
                 }
                 d *= scales[0];
+
+                ref_post_ops_t::args_t args;
+                args.ctx = &ctx;
+                args.l_offset = ou_in_offset + c * inner_size_;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops_->execute(d, args);
+
                 io::store_float_value(dst_d.data_type(), d, dst, dst_off);
             }
         }
@@ -18,6 +18,7 @@
 #define CPU_REF_SOFTMAX_HPP
 
 #include <assert.h>
+#include <memory>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -27,6 +28,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -47,9 +49,12 @@ struct ref_softmax_fwd_t : public primitive_t {
                     && utils::one_of(dst_md()->data_type, f32, bf16, s8, u8)
                     && platform::has_data_type_support(src_md()->data_type)
                     && platform::has_data_type_support(dst_md()->data_type)
-                    && attr()->has_default_values(skip_mask_t::oscale)
-                    && attr_oscale_ok()
-                    && set_default_formats() == status::success;
+                    && attr()->has_default_values(
+                            skip_mask_t::oscale | skip_mask_t::post_ops)
+                    && attr_oscale_ok() && post_ops_ok()
+                    && set_default_formats() == status::success
+                    && attr_.set_default_formats(dst_md(0))
+                            == status::success;
             if (!ok) return status::unimplemented;
 
             nthr_ = 0;
@@ -66,6 +71,13 @@ struct ref_softmax_fwd_t : public primitive_t {
         }
 
     private:
+        bool post_ops_ok() const {
+            for (const auto &post_op : attr()->post_ops_.entry_)
+                if (!(post_op.is_eltwise() || post_op.is_binary()))
+                    return false;
+            return true;
+        }
+
         void init_scratchpad() {
             auto scratchpad = scratchpad_registry().registrar();
             const dim_t in_s = inner_size();
@@ -103,9 +115,15 @@ struct ref_softmax_fwd_t : public primitive_t {
             if (bd.inner_idxs[iblk] == axis)
                 axis_blk_size *= bd.inner_blks[iblk];
 
+        // Post-ops are applied by logical offsets, see the generic version.
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                && pd()->attr()->post_ops_.len() == 0;
+
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
         return status::success;
     }
 
@@ -124,6 +142,7 @@ private:
 
     bool use_dense_;
     int outer_size_, channels_, inner_size_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 struct ref_softmax_bwd_t : public primitive_t {
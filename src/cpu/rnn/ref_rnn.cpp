@@ -29,6 +29,10 @@
 
  */
 
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/simple_q10n.hpp"
@@ -204,6 +208,267 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     const auto src_iter_c_mdw = memory_desc_wrapper(pd()->src_md(2));
     const auto dst_iter_c_mdw = memory_desc_wrapper(pd()->dst_md(2));
 
+    const int n_slots = rnn.n_wavefront_slots;
+#if DNNL_X64
+    const dim_t amx_scratchpad_per_slot = rnn.is_brgemm
+            ? ref_rnn_brgemm_t::amx_buffer_per_thr(rnn)
+            : 0;
+    const dim_t addr_batch_per_slot
+            = rnn.is_brgemm ? ref_rnn_brgemm_t::batch_per_thr(rnn) : 0;
+#endif
+
+    // Computes the cell of the j-th layer and the i-th iteration (in the order
+    // of the pass) of the direction `dir`. The cell uses the scratch buffers
+    // of the wavefront slot `slot`.
+    const auto compute_cell = [&](int dir, int j, int i, int slot) -> status_t {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter
+                = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // With sequence lengths, only the prefix of the minibatch up to the
+        // last sample whose sequence covers the time step is computed.
+        const bool reversed = rnn.exec_dir == r2l || dir == 1;
+        const int t = reversed ? rnn.n_iter - iter - 1 : iter;
+        int cell_mb = rnn.mb;
+        if (seq_lengths_)
+            while (cell_mb > 0 && seq_lengths_[cell_mb - 1] <= t)
+                cell_mb--;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+
+        // The scratch buffers of the slot
+        scratch_t *slot_scratch_gates = scratch_gates_
+                + slot * (rnn.scratch_gates_size / n_slots / sizeof(scratch_t));
+        ht_t *slot_scratch_ht = scratch_ht_
+                + slot * (rnn.scratch_ht_size / n_slots / sizeof(ht_t));
+        scratch_t *slot_scratch_cell = reinterpret_cast<scratch_t *>(
+                reinterpret_cast<char *>(scratch_cell_)
+                + slot * (rnn.scratch_cell_size / n_slots));
+#if DNNL_X64
+        gemm_acc_t *slot_amx_scratchpad = amx_scratchpad
+                ? amx_scratchpad + slot * amx_scratchpad_per_slot
+                : nullptr;
+        x64::brgemm_batch_element_t *slot_addr_batch = addr_batch_global
+                ? addr_batch_global + slot * addr_batch_per_slot
+                : nullptr;
+#endif
+
+        const auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
+                ? slot_scratch_gates
+                : slot_scratch_gates
+                        + iter * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = slot_scratch_ht;
+        }
+
+// Since the function FN(...) returns by reference so an extra exception
+// has to be made for nullptr argument
+#define SAFE_PTR(FN, ...) CONCAT2(FN, _) ? &(FN(__VA_ARGS__)) : nullptr
+        const auto execute_cell = [&](const rnn_conf_t &cell_rnn) {
+#if DNNL_X64
+            return (this->*cell_func)(ctx, cell_rnn, cell_position,
+                    cell_dst_layer, cell_dst_iter_c,
+                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                    SAFE_PTR(weights_layer, lay, dir, 0),
+                    SAFE_PTR(weights_iter, lay, dir, 0),
+                    SAFE_PTR(weights_projection, lay, dir),
+                    SAFE_PTR(weights_peephole, lay, dir, 0),
+                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                                : nullptr,
+                    bias(lay, dir), cell_src_layer,
+                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                    cell_src_iter_c,
+                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                    SAFE_PTR(diff_bias, lay, dir, 0),
+                    SAFE_PTR(ws_gates, lay, dir, iter, 0),
+                    cell_scratch_gates, proj_ht, scratch_diff_ht_,
+                    SAFE_PTR(ws_grid, lay, dir, iter, 0), slot_scratch_cell,
+                    scratch_gates_blocked_, scratch_src_layer_,
+                    scratch_src_iter_, cell_dst_iter, slot_amx_scratchpad,
+                    slot_addr_batch);
+#else
+            return (this->*cell_func)(cell_rnn, cell_position, cell_dst_layer,
+                    cell_dst_iter_c,
+                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                    SAFE_PTR(weights_layer, lay, dir, 0),
+                    SAFE_PTR(weights_iter, lay, dir, 0),
+                    SAFE_PTR(weights_projection, lay, dir),
+                    SAFE_PTR(weights_peephole, lay, dir, 0),
+                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                                : nullptr,
+                    bias(lay, dir), cell_src_layer,
+                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                    cell_src_iter_c,
+                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                    SAFE_PTR(diff_bias, lay, dir, 0),
+                    SAFE_PTR(ws_gates, lay, dir, iter, 0),
+                    cell_scratch_gates, proj_ht, scratch_diff_ht_,
+                    SAFE_PTR(ws_grid, lay, dir, iter, 0), slot_scratch_cell,
+                    cell_dst_iter, amx_scratchpad);
+#endif
+        };
+#undef SAFE_PTR
+
+        if (!seq_lengths_) return execute_cell(rnn);
+
+        if (cell_mb == rnn.mb) {
+            CHECK(execute_cell(rnn));
+        } else if (cell_mb > 0) {
+            rnn_conf_t cell_rnn = rnn;
+            cell_rnn.mb = cell_mb;
+            CHECK(execute_cell(cell_rnn));
+        }
+
+        // The samples whose sequence is over keep their states
+        const bool is_lstm = pd()->cell_kind() == alg_kind::vanilla_lstm;
+        const size_t c_dt_size = types::data_type_size(rnn.src_iter_c_dt);
+        const dim_t src_iter_c_ld = (cell_position & c_state_first_iter)
+                ? rnn.src_iter_c_ld_
+                : rnn.ws_states_iter_c_ld;
+        const dim_t dst_iter_c_ld = (cell_position & c_state_last_iter)
+                ? rnn.dst_iter_c_ld_
+                : rnn.ws_states_iter_c_ld;
+        for (int b = 0; b < rnn.mb; b++) {
+            if (seq_lengths_[b] > t) continue;
+            array_copy(cell_dst_layer + b * rnn.ws_states_layer_ld,
+                    cell_src_iter + b * rnn.ws_states_iter_ld, rnn.dic);
+            if (is_lstm)
+                std::memcpy(static_cast<char *>(cell_dst_iter_c)
+                                + b * dst_iter_c_ld * c_dt_size,
+                        static_cast<const char *>(cell_src_iter_c)
+                                + b * src_iter_c_ld * c_dt_size,
+                        rnn.dhc * c_dt_size);
+        }
+        return status::success;
+    };
+
+    if (rnn.use_wavefront) {
+        // The cell (l, t) depends on the cells (l - 1, t) and (l, t - 1) of
+        // the same direction only, so the cells on an anti-diagonal
+        // l + t = wave of all the directions are computed concurrently. Each
+        // cell is computed by a single thread, while a wave of one cell uses
+        // all of them.
+        assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer);
+        for (int wave = 0; wave < rnn.n_layer + rnn.n_iter - 1; wave++) {
+            const int j_start = nstl::max(0, wave - rnn.n_iter + 1);
+            const int j_end = nstl::min(rnn.n_layer, wave + 1);
+            const int n_cells = rnn.n_dir * (j_end - j_start);
+            const auto compute_wave_cell = [&](int c, int slot) {
+                const int j = j_start + c / rnn.n_dir;
+                return compute_cell(c % rnn.n_dir, j, wave - j, slot);
+            };
+
+            if (n_cells == 1) {
+                CHECK(compute_wave_cell(0, 0));
+                continue;
+            }
+
+            std::atomic<status_t> st(status::success);
+            parallel(nstl::min(n_cells, n_slots), [&](int ithr, int nthr) {
+                int start {0}, end {0};
+                balance211(n_cells, nthr, ithr, start, end);
+                for (int c = start; c < end; c++) {
+                    const status_t st_cell = compute_wave_cell(c, ithr);
+                    if (st_cell != status::success) st = st_cell;
+                }
+            });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for (int dir = 0; dir < rnn.n_dir; dir++) {
         for (int j = 0; j < rnn.n_layer; j++) {
@@ -236,165 +501,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
             // TODO: enable merging projection gemm in bwd lstm projection
 
-            for (int i = 0; i < rnn.n_iter; i++) {
-                const int iter = (aprop == prop_kind::forward)
-                        ? i
-                        : rnn.n_iter - i - 1;
-
-                // We set parameters to the cell execution call
-
-                // dst_layer is equal to dst_iter. To avoid
-                // duplication of memory access we hence use only
-                // dst_layer and set dst_iter to nullptr, unless we
-                // cannot for one of the following condition:
-                // - in the last layer and last iteration, we need to
-                //   copy ht in two tensors (dst_layer and dst_iter)
-                dst_layer_t *cell_dst_layer
-                        = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-                dst_iter_t *cell_dst_iter = nullptr;
-                const src_layer_t *cell_src_layer
-                        = &(ws_states_layer(lay, dir, iter + 1, 0));
-                const src_iter_t *cell_src_iter
-                        = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-                void *cell_dst_iter_c = const_cast<void *>(
-                        ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-                const void *cell_src_iter_c
-                        = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-                // the cell_position is used only when skip_data_copy is
-                // supported currently supported only for forward
-                cell_position_t cell_position = middle_cell;
-                if (iter == 0) cell_position |= first_iter;
-                if (lay == 0) cell_position |= first_layer;
-                if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-                if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-                // The dst_* paths should be before the src_* paths as
-                // the later will override cell_src_layer and
-                // cell_src_iter appropriately for 1st layer and 1st
-                // iter.
-                const bool last_iter_skip_copy = rnn.skip_dst_iter_copy()
-                        && (cell_position & last_iter);
-                if (last_iter_skip_copy) {
-                    cell_dst_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                    cell_src_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-                }
-
-                if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                    // Note: for last layer and last iter, the output is in dst_layer
-                    // and still need to be copied to dst_iter
-                    cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                    cell_dst_iter = last_iter_skip_copy
-                            ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                            : nullptr;
-                    cell_src_iter = (iter != 0)
-                            ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                            : cell_src_iter;
-                }
-                if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                    cell_src_iter
-                            = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-                if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                    cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-                // because the c state is always f32 and require no
-                // conversion, we can always skip to copy for the 1st
-                // and last iteration
-                if (iter == 0 && src_iter_c_) {
-                    cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                            src_iter_c_mdw.off(lay, dir, 0, 0));
-                    cell_position |= c_state_first_iter;
-                }
-                if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                    cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                            dst_iter_c_mdw.off(lay, dir, 0, 0));
-                    cell_position |= c_state_last_iter;
-                }
-
-                const auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
-                        ? scratch_gates_
-                        : scratch_gates_
-                                + iter * rnn.scratch_gates_nld
-                                        * rnn.scratch_gates_ld;
-
-                dst_iter_t *proj_ht = nullptr;
-                if (rnn.is_lstm_projection) {
-                    if (rnn.is_training)
-                        proj_ht = &(ws_ht(lay, dir, iter, 0));
-                    else
-                        proj_ht = scratch_ht_;
-                }
-
-// Since the function FN(...) returns by reference so an extra exception
-// has to be made for nullptr argument
-#define SAFE_PTR(FN, ...) CONCAT2(FN, _) ? &(FN(__VA_ARGS__)) : nullptr
-#if DNNL_X64
-                CHECK((this->*cell_func)(ctx, rnn, cell_position,
-                        cell_dst_layer, cell_dst_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                        SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                        SAFE_PTR(weights_layer, lay, dir, 0),
-                        SAFE_PTR(weights_iter, lay, dir, 0),
-                        SAFE_PTR(weights_projection, lay, dir),
-                        SAFE_PTR(weights_peephole, lay, dir, 0),
-                        w_proj_comp
-                                ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                        bias(lay, dir), cell_src_layer,
-                        SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                        cell_src_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                        SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                        SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                        SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                        SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                        SAFE_PTR(diff_bias, lay, dir, 0),
-                        SAFE_PTR(ws_gates, lay, dir, iter, 0),
-                        cell_scratch_gates, proj_ht, scratch_diff_ht_,
-                        SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                        scratch_gates_blocked_, scratch_src_layer_,
-                        scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                        addr_batch_global));
-#else
-                CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
-                        cell_dst_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                        SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                        SAFE_PTR(weights_layer, lay, dir, 0),
-                        SAFE_PTR(weights_iter, lay, dir, 0),
-                        SAFE_PTR(weights_projection, lay, dir),
-                        SAFE_PTR(weights_peephole, lay, dir, 0),
-                        w_proj_comp
-                                ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                        bias(lay, dir), cell_src_layer,
-                        SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                        cell_src_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                        SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                        SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                        SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                        SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                        SAFE_PTR(diff_bias, lay, dir, 0),
-                        SAFE_PTR(ws_gates, lay, dir, iter, 0),
-                        cell_scratch_gates, proj_ht, scratch_diff_ht_,
-                        SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                        cell_dst_iter, amx_scratchpad));
-#endif
-#undef SAFE_PTR
-            }
+            for (int i = 0; i < rnn.n_iter; i++)
+                CHECK(compute_cell(dir, j, i, 0));
 
             if ((aprop == prop_kind::backward) && rnn.merge_gemm_layer) {
                 const src_layer_t *src_layer
@@ -1165,6 +1273,27 @@ rnn_weights_assign_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 }
 
 //********************* Execution function *********************//
+// Zeroes dst_layer at the time steps past the end of the sequence of each
+// sample. For int8 outputs the zero is quantized.
+template <typename dst_layer_dt>
+static void zero_dst_layer_tails(const rnn_conf_t &rnn, const rnn_pd_t *pd,
+        dst_layer_dt *dst_layer_, const int32_t *seq_lengths) {
+    const memory_desc_wrapper dst_layer_d(pd->dst_md(0));
+    const bool quantized = rnn.is_int8()
+            && pd->dst_md(0)->data_type != data_type::f32;
+    const dst_layer_dt zero = quantized
+            ? (dst_layer_dt)nearbyintf(pd->attr()->rnn_data_qparams_.shift_)
+            : (dst_layer_dt)0.f;
+    const dim_t n_channels = dst_layer_d.dims()[2];
+
+    parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+        if (seq_lengths[b] > it) return;
+        auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b)];
+        for (dim_t c = 0; c < n_channels; c++)
+            dd[c] = zero;
+    });
+}
+
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
 void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
@@ -1175,6 +1304,7 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             = CTX_IN_MEM(const src_layer_t *, DNNL_ARG_AUGRU_ATTENTION);
     auto src_iter = CTX_IN_MEM(const char *, DNNL_ARG_SRC_ITER);
     auto src_iter_c = CTX_IN_MEM(const void *, DNNL_ARG_SRC_ITER_C);
+    auto seq_lengths = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
     auto layer_weights_n_comp
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_LAYER);
     auto iter_weights_n_comp = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_ITER);
@@ -1333,8 +1463,8 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             rnn, ptr_wei_layer, ptr_wei_iter, ptr_wei_projection,
             weights_peephole, w_projection_comp, ptr_bias, src_layer,
             augru_attention, (const src_iter_t *)src_iter, src_iter_c,
-            (dst_layer_t *)dst_layer, (dst_iter_t *)dst_iter, dst_iter_c,
-            ws_states_layer, ws_states_iter, ws_states_iter_c,
+            seq_lengths, (dst_layer_t *)dst_layer, (dst_iter_t *)dst_iter,
+            dst_iter_c, ws_states_layer, ws_states_iter, ws_states_iter_c,
             ws_diff_states_layer, ws_diff_states_iter, ws_diff_states_iter_c,
             ws_gates, ws_ht, ws_grid, scratch_gates, scratch_ht,
             scratch_diff_ht, scratch_cell,
@@ -1360,6 +1490,14 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
                     dst_iter, ws_states_layer, ws_diff_states_layer);
     }
 
+    if (rnn.use_seq_lengths) {
+        if (pd()->dst_md(0)->data_type == data_type::f32)
+            zero_dst_layer_tails(rnn, pd(), (float *)dst_layer, seq_lengths);
+        else
+            zero_dst_layer_tails(
+                    rnn, pd(), (dst_layer_t *)dst_layer, seq_lengths);
+    }
+
     if (!(rnn.skip_dst_iter_copy() && rnn.is_fwd)) {
         if (pd()->dst_md(1)->data_type == data_type::f32)
             copy_res_iter(rnn, (float *)dst_iter, dst_iter_c, diff_src_iter,
@@ -150,7 +150,9 @@ struct _ref_rnn_common_t : public primitive_t {
                     && everyone_is(
                             weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias()
+                    && IMPLICATION(this->with_seq_lengths(),
+                            this->desc()->prop_kind == forward_inference);
 
             if (!ok) return status::unimplemented;
 
@@ -271,7 +273,7 @@ struct _ref_rnn_common_t : public primitive_t {
                     && everyone_is(
                             weights_type, weights_iter_dt, weights_layer_dt)
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias() && !this->with_seq_lengths();
 
             if (!ok) return status::unimplemented;
 
@@ -176,6 +176,65 @@ void rnn_utils::get_scratchpad_and_workspace_sizes(const rnn_conf_t &rnn,
             scratch_cell_offset, scratchpad_size, workspace_size);
 }
 
+int rnn_utils::max_wavefront_cells(const rnn_conf_t &rnn) {
+    return rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter);
+}
+
+bool rnn_utils::use_wavefront_schedule(const rnn_conf_t &rnn, int nthr) {
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP
+    // Each concurrent cell is computed by a single thread, which relies on
+    // nested parallel regions being executed by the calling thread only.
+    UNUSED(rnn);
+    UNUSED(nthr);
+    return false;
+#else
+    // The schedule can be forced on (1) or off (0) with the
+    // ONEDNN_RNN_WAVEFRONT environment variable.
+    static const int wavefront_mode = getenv_int_user("RNN_WAVEFRONT", -1);
+
+    // The cells of the backward pass accumulate into the same diff weights.
+    if (!rnn.is_fwd || rnn.is_training) return false;
+    if (nthr == 1 || max_wavefront_cells(rnn) == 1) return false;
+    // Packed weights are partitioned for the number of threads of the whole
+    // primitive.
+    if (rnn.use_layer_packed_gemm || rnn.use_iter_packed_gemm
+            || rnn.use_projection_packed_gemm)
+        return false;
+
+    if (wavefront_mode >= 0) return wavefront_mode != 0;
+
+    // Compare the time of both schedules, in flops per thread. A GEMM is
+    // worth splitting between threads only in chunks of at least
+    // `min_thr_flops` flops. The linear schedule may compute the layer GEMM
+    // of all the iterations at once, which the wavefront gives up. The
+    // wavefront runs on average `n_cells / n_waves` cells at once, one
+    // thread each.
+    const double min_thr_flops = 1e6;
+    auto gemm_time = [&](double flops) {
+        const double par = nstl::max(
+                1., nstl::min((double)nthr, flops / min_thr_flops));
+        return flops / par;
+    };
+    const double layer_flops = 2. * rnn.mb * rnn.n_gates * rnn.dhc * rnn.slc;
+    const double iter_flops = 2. * rnn.mb
+            * ((double)rnn.n_gates * rnn.dhc * rnn.sic
+                    + (rnn.is_lstm_projection ? (double)rnn.dic * rnn.dhc : 0));
+    const double n_cells = (double)rnn.n_dir * rnn.n_layer * rnn.n_iter;
+    const bool merge_gemm_layer
+            = rnn.merge_gemm_layer && !rnn.use_seq_lengths;
+    const double linear_time = merge_gemm_layer
+            ? n_cells / rnn.n_iter * gemm_time(rnn.n_iter * layer_flops)
+                    + n_cells * gemm_time(iter_flops)
+            : n_cells * gemm_time(layer_flops + iter_flops);
+
+    const double n_waves = rnn.n_layer + rnn.n_iter - 1;
+    const double wavefront_par = nstl::min((double)nthr, n_cells / n_waves);
+    const double wavefront_time
+            = n_cells * (layer_flops + iter_flops) / wavefront_par;
+    return wavefront_time < linear_time;
+#endif
+}
+
 status_t rnn_utils::set_good_strides(
         memory_desc_t &weights_md, format_tag_t tag) {
     auto &strides = weights_md.format_desc.blocking.strides;
@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -76,9 +77,10 @@
             const float *w_proj_comp, void **bias_, \
             const src_layer_t *src_layer_, \
             const src_layer_t *augru_attention_, const src_iter_t *src_iter_, \
-            const void *src_iter_c_, dst_layer_t *dst_layer_, \
-            dst_iter_t *dst_iter_, void *dst_iter_c_, \
-            src_layer_t *ws_states_layer_, src_iter_t *ws_states_iter_, \
+            const void *src_iter_c_, const int32_t *seq_lengths_, \
+            dst_layer_t *dst_layer_, dst_iter_t *dst_iter_, \
+            void *dst_iter_c_, src_layer_t *ws_states_layer_, \
+            src_iter_t *ws_states_iter_, \
             void *ws_states_iter_c_, gemm_acc_t *ws_diff_states_layer_, \
             gemm_acc_t *ws_diff_states_iter_, \
             gemm_acc_t *ws_diff_states_iter_c_, gates_t *ws_gates_, \
@@ -118,9 +120,10 @@
             const float *w_proj_comp, void **bias_, \
             const src_layer_t *src_layer_, \
             const src_layer_t *augru_attention_, const src_iter_t *src_iter_, \
-            const void *src_iter_c_, dst_layer_t *dst_layer_, \
-            dst_iter_t *dst_iter_, void *dst_iter_c_, \
-            src_layer_t *ws_states_layer_, src_iter_t *ws_states_iter_, \
+            const void *src_iter_c_, const int32_t *seq_lengths_, \
+            dst_layer_t *dst_layer_, dst_iter_t *dst_iter_, \
+            void *dst_iter_c_, src_layer_t *ws_states_layer_, \
+            src_iter_t *ws_states_iter_, \
             void *ws_states_iter_c_, gemm_acc_t *ws_diff_states_layer_, \
             gemm_acc_t *ws_diff_states_iter_, \
             gemm_acc_t *ws_diff_states_iter_c_, gates_t *ws_gates_, \
@@ -361,6 +364,19 @@ struct rnn_conf_t {
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
 
+    // Wavefront schedule of the grid: the cells with the same sum of layer
+    // and iteration indices (of all directions) do not depend on each other
+    // and are computed concurrently. Each concurrent cell uses its own slot
+    // of the scratch_gates, scratch_ht and scratch_cell buffers.
+    bool use_wavefront = false;
+    int n_wavefront_slots = 1;
+
+    // Per-sample sequence lengths: a cell only computes the prefix of the
+    // minibatch that holds the samples whose sequence is not over yet, the
+    // states of the finished samples are carried over unchanged. All the
+    // states then live in the workspace, so their copies are never skipped.
+    bool use_seq_lengths = false;
+
     inline bool is_int8() const {
         return is_signed_int8() || is_unsigned_int8();
     }
@@ -397,17 +413,17 @@ struct rnn_conf_t {
                         f32u8f32f32, all_f32, all_bf16);
     }
     inline bool skip_src_iter_copy() const {
-        return (exec_dir == l2r) && (src_iter_ld_ > 0)
+        return (exec_dir == l2r) && !use_seq_lengths && (src_iter_ld_ > 0)
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r)
+        return (exec_dir == l2r) && !use_seq_lengths
                 && utils::one_of(dt_conf, s8s8s8s8, f32s8f32s8, u8u8u8u8,
                         f32u8f32u8, all_f32, all_bf16);
     }
     inline bool skip_dst_iter_copy() const {
-        return (exec_dir == l2r) && (dst_iter_ld_ > 0)
+        return (exec_dir == l2r) && !use_seq_lengths && (dst_iter_ld_ > 0)
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
@@ -562,6 +578,13 @@ struct rnn_conf_t {
             = brgemm_rnn_execute_loop_order_t::undefined;
 };
 
+// Returns the maximum number of cells that can be computed concurrently by the
+// wavefront schedule.
+int max_wavefront_cells(const rnn_conf_t &rnn);
+// Returns true if the grid should be computed as a wavefront. Assumes that
+// the kind of GEMMs used by the cells is already chosen.
+bool use_wavefront_schedule(const rnn_conf_t &rnn, int nthr);
+
 bool is_ldigo(const memory_desc_wrapper &md);
 bool is_ldgoi(const memory_desc_wrapper &md);
 bool is_ldio(const memory_desc_wrapper &md);
@@ -765,6 +788,8 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             alg_kind::lbr_gru, alg_kind::vanilla_augru, alg_kind::lbr_augru);
     const bool is_inference = !rnn.is_training;
 
+    rnn.use_seq_lengths = rd.flags & dnnl_rnn_flags_seq_lengths;
+
     // To be able to merge the GEMM on the layer input when not
     // copying, we need to have a trivial stride for the T dimension
     const auto src_layer_is_trivial_stride
@@ -833,6 +858,16 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.use_projection_packed_gemm = false;
 #endif
 
+    /* Decide whether to compute the grid as a wavefront. A wavefront cell
+     * computes the layer GEMM for its own iteration only. */
+    rnn.use_wavefront = use_wavefront_schedule(rnn, dnnl_get_max_threads());
+    rnn.n_wavefront_slots = rnn.use_wavefront
+            ? nstl::min(dnnl_get_max_threads(), max_wavefront_cells(rnn))
+            : 1;
+    if (rnn.use_wavefront) rnn.merge_gemm_layer = false;
+    // A merged layer GEMM would compute the finished samples as well
+    if (rnn.use_seq_lengths) rnn.merge_gemm_layer = false;
+
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
     const auto set_pack_sizes
@@ -1024,17 +1059,18 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
-    rnn.scratch_gates_size = rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
+    rnn.scratch_gates_size = (size_t)rnn.n_wavefront_slots
+            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
             * rnn.scratch_gates_ld * sizeof(typename T::scratch_t);
-    rnn.scratch_ht_size
-            = rnn.scratch_ht_nld * rnn.scratch_ht_ld * sizeof(typename T::ht_t);
+    rnn.scratch_ht_size = (size_t)rnn.n_wavefront_slots * rnn.scratch_ht_nld
+            * rnn.scratch_ht_ld * sizeof(typename T::ht_t);
     rnn.scratch_diff_ht_size = rnn.is_training ? rnn.scratch_diff_ht_nld
                     * rnn.scratch_diff_ht_ld * sizeof(typename T::gemm_acc_t)
                                                : (size_t)0;
 
     /* set other sizes */
     /// scratchpad buffer for each cell to hold intermediate data in gru/lbr_gru
-    rnn.scratch_cell_size = rnn.is_lbr
+    const size_t scratch_cell_slot_size = rnn.is_lbr
             ? (size_t)rnn.scratch_gates_nld * rnn.scratch_gates_ld
                     * sizeof(typename T::gemm_acc_t)
             : (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
@@ -1043,6 +1079,7 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                                     * rnn.ws_states_layer_ld
                                     * sizeof(typename T::gemm_acc_t)
                             : 0);
+    rnn.scratch_cell_size = rnn.n_wavefront_slots * scratch_cell_slot_size;
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
             * sizeof(typename T::gemm_acc_t);
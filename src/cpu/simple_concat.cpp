@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2021 Intel Corporation
+* Copyright 2017-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -44,7 +44,9 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         const memory_desc_wrapper i_d(pd()->src_md(a));
         const memory_desc_wrapper o_d(pd()->src_image_md(a));
         const auto iptr = CTX_IN_MEM(const data_t *, DNNL_ARG_MULTIPLE_SRC + a);
-        if (iptr == nullptr) {
+        // a source placed in the destination memory is already in its image
+        if (iptr == nullptr
+                || (iptr == o_base_ptr && pd()->src_inplace(a))) {
             iptrs[a] = nullptr;
             nelems_to_copy[a] = 0;
             continue;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2020 Intel Corporation
+* Copyright 2017-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -41,7 +41,7 @@ struct simple_concat_t : public primitive_t {
             const memory_desc_wrapper dst_d(dst_md());
             bool ok = platform::has_data_type_support(data_type)
                     && cpu_concat_pd_t::init() == status::success
-                    && dst_d.ndims() <= 6;
+                    && !with_scales() && dst_d.ndims() <= 6;
             if (!ok) return status::unimplemented;
 
             for (size_t i = 0; i < src_mds_.size(); ++i) {
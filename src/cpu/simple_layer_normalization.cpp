@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include "common/reorder.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/binary_injector_utils.hpp"
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/cpu_engine.hpp"
 
@@ -53,19 +54,38 @@ template <data_type_t data_type>
 status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
         engine_t *engine) {
     using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
     const memory_desc_wrapper src_d(src_md());
 
     const bool ok = is_fwd() && !has_zero_dim_memory()
             && platform::has_data_type_support(data_type)
-            && utils::everyone_is(
-                    data_type, src_md()->data_type, dst_md()->data_type)
+            && src_md()->data_type == data_type
+            && utils::one_of(dst_md()->data_type, data_type, s8, u8)
             && (f32 == stat_md()->data_type) && check_scale_shift_data_type()
             && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
                     == 1 // plain format, last logical dim is last physical
-            && attr()->has_default_values() && set_default_formats_common();
+            && attr()->has_default_values(
+                    skip_mask_t::oscale | skip_mask_t::post_ops)
+            && attr_oscale_ok()
+            && lnorm_utils::post_ops_ok(
+                    data_type, attr()->post_ops_, dst_md())
+            && set_default_formats_common()
+            && src_d.similar_to(*dst_md(), true, false)
+            && attr_.set_default_formats(dst_md(0)) == status::success;
     if (!ok) return status::unimplemented;
 
+    // The binary post-ops arguments are located by the logical offset of the
+    // destination, which matches the physical one for plain layouts only.
+    using namespace format_tag;
+    const bool with_binary
+            = attr()->post_ops_.find(primitive_kind::binary) >= 0;
+    if (with_binary
+            && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                       ab, abc, abcd, abcde)
+                    == format_tag::undef)
+        return status::unimplemented;
+
     CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
 
     if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
@@ -87,7 +107,11 @@ status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
 
     auto scratchpad = ctx.get_scratchpad_grantor();
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const float *oscale = pd()->attr()->output_scales_.scales_;
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector_utils::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
 
     const memory_desc_wrapper ss_d(pd()->weights_md());
     const size_t shift_off
@@ -113,6 +137,7 @@ status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
     }
 
     const memory_desc_wrapper src_d(pd()->src_md());
+    const size_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
 
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
@@ -122,8 +147,9 @@ status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
         balance211(N, nthr, ithr, N_start, N_end);
         const int block_size = N_end - N_start;
         (*stat_and_data_kernel_)(&src[N_start * C_padded],
-                &dst[N_start * C_padded], scale, shift, &mean[N_start],
-                &variance[N_start], block_size);
+                &dst[N_start * C_padded * dst_dt_size], scale, shift,
+                &mean[N_start], &variance[N_start], oscale,
+                post_ops_binary_rhs_arg_vec.data(), dst, ctx, block_size);
     });
     return status::success;
 }
@@ -137,8 +163,8 @@ status_t simple_layer_normalization_bwd_t<data_type>::pd_t::init(
     const bool ok = is_bwd() && !has_zero_dim_memory()
             && set_default_formats_common()
             && platform::has_data_type_support(data_type)
-            && utils::everyone_is(
-                    data_type, src_md()->data_type, dst_md()->data_type)
+            && utils::everyone_is(data_type, src_md()->data_type,
+                    diff_dst_md()->data_type, diff_src_md()->data_type)
             && (f32 == stat_md()->data_type) && check_scale_shift_data_type()
             && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,8 +18,10 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
 #endif
 
@@ -33,9 +35,24 @@ namespace lnorm_utils {
 using namespace data_type;
 
 template <>
-void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
+void stat_and_data_kernel_t<f32>::operator()(const float *src, void *dst_ptr,
         const float *scale, const float *shift, float *mean, float *var,
+        const float *oscale, const void * /* post_ops_binary_rhs_arg_vec */,
+        const void *dst_orig, const exec_ctx_t &ctx,
         const size_t block_size) const {
+    const bool with_pp = with_oscale_ || with_postops_ || dst_dt_ != f32;
+    // Binary post-ops require a plain dense destination, hence the logical
+    // offset of the block is its physical one.
+    const dim_t dst_block_off = with_postops_
+            ? (static_cast<const char *>(dst_ptr)
+                      - static_cast<const char *>(dst_orig))
+                    / types::data_type_size(dst_dt_)
+            : 0;
+    ref_post_ops_t::args_t args;
+    args.ctx = &ctx;
+    args.dst_md = dst_md_;
+
+    float *dst = static_cast<float *>(dst_ptr);
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
     for (size_t offset = 0; offset < block_size; offset++) {
@@ -61,7 +78,22 @@ void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
         }
 
         const float inv_sqrtvar = 1. / sqrtf(v_variance + eps_);
-        if (use_scaleshift_ || (use_scale_ && use_shift_)) {
+        if (with_pp) {
+            const bool with_scale = use_scaleshift_ || use_scale_;
+            const bool with_shift = use_scaleshift_ || use_shift_;
+            for (dim_t c = 0; c < C_; ++c) {
+                const float sm = (with_scale ? scale[c] : 1.0f) * inv_sqrtvar;
+                const float sv = with_shift ? shift[c] : 0.0f;
+                const size_t elem = c + C_ * offset;
+                float d = sm * (src[elem] - v_mean) + sv;
+                if (with_oscale_) d *= oscale[0];
+                if (with_postops_) {
+                    args.l_offset = dst_block_off + elem;
+                    ref_post_ops_->execute(d, args);
+                }
+                io::store_float_value(dst_dt_, d, dst_ptr, elem);
+            }
+        } else if (use_scaleshift_ || (use_scale_ && use_shift_)) {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = scale[c] * inv_sqrtvar;
@@ -190,8 +222,10 @@ void diff_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
 
 template <>
 void stat_and_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        bfloat16_t *dst, const float *scale, const float *shift, float *mean,
-        float *var, const size_t block_size) const {
+        void *dst, const float *scale, const float *shift, float *mean,
+        float *var, const float *oscale,
+        const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+        const exec_ctx_t &ctx, const size_t block_size) const {
     assert(!"No default stat_and_data_kernel_t operator() for bf16 input!");
 }
 
@@ -248,6 +282,28 @@ diff_data_kernel_t<data_type> *diff_data_kernel_t<data_type>::create(
     return new diff_data_kernel_t<data_type>(pd);
 }
 
+bool post_ops_ok(data_type_t data_type, const post_ops_t &post_ops,
+        const memory_desc_t *dst_md) {
+#if DNNL_X64
+    using namespace cpu::x64;
+    const cpu_isa_t isa = data_type == bf16 ? avx512_core : avx2;
+    if (mayiuse(isa)) {
+        const memory_desc_wrapper dst_d(dst_md);
+        static const bcast_set_t supported_strategies
+                = {broadcasting_strategy_t::scalar,
+                        broadcasting_strategy_t::no_broadcast};
+        return injector::post_ops_ok(
+                {isa, {injector::binary, injector::eltwise}, post_ops, &dst_d,
+                        false /*sum_at_pos_0_only*/,
+                        false /*sum_requires_scale_one*/,
+                        true /*sum_requires_zp_zero*/, supported_strategies});
+    }
+#endif
+    for (const auto &post_op : post_ops.entry_)
+        if (!(post_op.is_eltwise() || post_op.is_binary())) return false;
+    return true;
+}
+
 template struct diff_ss_kernel_t<f32>;
 template struct diff_ss_kernel_t<bf16>;
 template struct stat_and_data_kernel_t<f32>;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,7 +17,12 @@
 #ifndef CPU_SIMPLE_LAYER_NORMALIZATION_KERNELS_HPP
 #define CPU_SIMPLE_LAYER_NORMALIZATION_KERNELS_HPP
 
+#include <memory>
+
 #include "common/layer_normalization_pd.hpp"
+#include "common/primitive_exec_types.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -31,9 +36,13 @@ struct stat_and_data_kernel_t {
             const layer_normalization_pd_t *pd);
     virtual ~stat_and_data_kernel_t() = default;
 
-    virtual void operator()(const data_t *src, data_t *dst, const float *scale,
-            const float *shift, float *mean, float *var,
-            const size_t block_size) const;
+    // `dst` points to the first row of the block and `dst_orig` to the first
+    // row of the whole destination, the offset between them is used to
+    // locate the binary post-ops arguments.
+    virtual void operator()(const data_t *src, void *dst, const float *scale,
+            const float *shift, float *mean, float *var, const float *oscale,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+            const exec_ctx_t &ctx, const size_t block_size) const;
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -45,7 +54,14 @@ protected:
         , use_shift_(pd->use_shift())
         , save_stats_(pd->is_training())
         , calculate_stats_(!pd->stats_are_src())
-        , eps_(pd->desc()->layer_norm_epsilon) {}
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , dst_dt_(pd->dst_md()->data_type)
+        , with_oscale_(!pd->attr()->output_scales_.has_default_values())
+        , with_postops_(pd->attr()->post_ops_.len() > 0)
+        , dst_md_(pd->dst_md())
+        , ref_post_ops_(with_postops_ ? utils::make_unique<ref_post_ops_t>(
+                                pd->attr()->post_ops_)
+                                      : nullptr) {}
 
     int C_;
     bool use_scaleshift_;
@@ -54,6 +70,11 @@ protected:
     bool save_stats_;
     bool calculate_stats_;
     const float eps_;
+    data_type_t dst_dt_;
+    bool with_oscale_;
+    bool with_postops_;
+    const memory_desc_t *dst_md_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 template <data_type_t data_type>
@@ -108,6 +129,11 @@ protected:
     bool use_shift_;
 };
 
+// Checks that the post-ops are supported by the stat_and_data_kernel_t
+// implementation selected for the source data type.
+bool post_ops_ok(data_type_t data_type, const post_ops_t &post_ops,
+        const memory_desc_t *dst_md);
+
 } // namespace lnorm_utils
 } // namespace cpu
 } // namespace impl
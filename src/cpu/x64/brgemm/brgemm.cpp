@@ -148,7 +148,7 @@ bool can_dispatch_uker(const brgemm_t *brg) {
 }
 
 void maybe_try_bf32(brgemm_t *brg) {
-    const bool try_bf32 = brg->is_f32
+    const bool try_bf32 = brg->is_f32 && !one_of(brg->isa_impl, avx2, avx2_vnni)
             && brg->brgattr.fpmath_mode == fpmath_mode::bf16
             && mayiuse(avx512_core_bf16_amx_bf16);
     if (try_bf32) {
@@ -167,26 +167,33 @@ void maybe_try_bf32(brgemm_t *brg) {
 status_t brgemm_blocking(brgemm_t *brg) {
 
     if (!brg->is_amx) {
-        brg->ld_block = 16;
+        const bool is_ymm = one_of(brg->isa_impl, avx2, avx2_vnni);
+        brg->ld_block = is_ymm ? 8 : 16;
         brg->ldb = brg->load_dim / brg->ld_block;
         brg->ldb_tail = brg->load_dim % brg->ld_block;
 
-        brg->ld_block2 = 4; // (M < 9) ? 2 : 4 | TODO - fix this for INT8
+        // (M < 9) ? 2 : 4 | TODO - fix this for INT8
+        // avx2: 3 x 4 accumulators leave room for loads in 16 registers
+        brg->ld_block2 = is_ymm ? 3 : 4;
         brg->ldb2 = brg->ldb / brg->ld_block2;
         brg->ldb2_tail = brg->ldb % brg->ld_block2;
 
         if (brg->ldb2 == 0) brg->ld_block2 = nstl::max(1, brg->ldb2_tail);
-        brg->embd_bcst = !brg->is_int8 && !brg->is_bf16
+        // avx2 has no embedded broadcast
+        brg->embd_bcst = !is_ymm && !brg->is_int8 && !brg->is_bf16
                 && (brg->ldb2_tail <= 1 && brg->ldb2 == 0);
 
         int ld_block = (brg->ldb2 != 0) ? brg->ld_block2 : brg->ldb2_tail;
         int adj_ld_block = (ld_block == 0) ? (ld_block + 1) : ld_block;
 
-        const int max_avx512_regs = 32;
+        const int max_vregs = is_ymm ? 16 : 32;
         const int max_bcst_regs = 1;
         const bool req_compensation = brg->req_s8s8_compensation
                 || brg->zp_type_a != brgemm_broadcast_t::none;
-        int max_regs = max_avx512_regs - (adj_ld_block + max_bcst_regs);
+        // avx2 keeps the mask of the load dimension tail in a register
+        const int max_mask_regs = is_ymm && brg->ldb_tail != 0;
+        int max_regs = max_vregs
+                - (adj_ld_block + max_bcst_regs + max_mask_regs);
         int max_block
                 = (brg->embd_bcst ? 28
                                   : ((brg->beta == 1.f || brg->beta == 0.f)
@@ -195,6 +202,7 @@ status_t brgemm_blocking(brgemm_t *brg) {
         max_block -= req_compensation;
         if (brg->is_bf16_emu) max_block = nstl::min(max_block, 28);
         max_block /= adj_ld_block;
+        if (max_block < 1) return status::unimplemented;
         int min_block = 1;
         float best_bd_block_eff = 0.f;
         brg->bd_block = 1;
@@ -466,14 +474,31 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
     brg->dt_d = brg->dt_c;
     brg->dt_bias = brg->dt_c;
 
-    if (!IMPLICATION(brg->is_f32, mayiuse(avx512_core)))
-        return status::unimplemented;
-    if (!IMPLICATION(brg->is_bf16, mayiuse(avx512_core_bf16)))
-        return status::unimplemented;
-    if (!IMPLICATION(brg->is_int8, mayiuse(avx512_core_vnni)))
-        return status::unimplemented;
+    // The avx2 flavor of the kernel is used when it is requested explicitly
+    // or when avx512 is not available on the platform.
+    const bool use_avx2 = one_of(isa, avx2, avx2_vnni)
+            || (isa == isa_any && !mayiuse(avx512_core));
+    if (use_avx2) {
+        // int8 requires the vex encoded vpdpbusd, there is no bf16 support
+        if (brg->is_bf16) return status::unimplemented;
+        if (brg->is_int8 && isa == avx2) return status::unimplemented;
+        brg->isa_impl = brg->is_int8 ? avx2_vnni : avx2;
+        if (!mayiuse(brg->isa_impl)) return status::unimplemented;
+    } else {
+        if (!IMPLICATION(brg->is_f32, mayiuse(avx512_core)))
+            return status::unimplemented;
+        if (!IMPLICATION(brg->is_bf16, mayiuse(avx512_core_bf16)))
+            return status::unimplemented;
+        if (!IMPLICATION(brg->is_int8, mayiuse(avx512_core_vnni)))
+            return status::unimplemented;
+        brg->isa_impl = brg->is_f32
+                ? avx512_core
+                : (brg->is_bf16 ? avx512_core_bf16 : avx512_core_vnni);
+    }
 
-    if (isa != isa_any) {
+    if (use_avx2) {
+        brg->is_int8_amx = brg->is_bf16_amx = false;
+    } else if (isa != isa_any) {
         if (!one_of(isa, avx512_core, avx512_core_bf16, avx512_core_vnni,
                     avx512_core_bf16_amx_bf16, avx512_core_bf16_amx_int8)) {
             return status::invalid_arguments;
@@ -494,6 +519,9 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
         brg->is_bf16_amx = brg->is_bf16 && mayiuse(avx512_core_bf16_amx_bf16);
     }
     brg->is_amx = (brg->is_int8_amx || brg->is_bf16_amx);
+    if (brg->is_amx)
+        brg->isa_impl = brg->is_int8_amx ? avx512_core_bf16_amx_int8
+                                         : avx512_core_bf16_amx_bf16;
     brg->req_s8s8_compensation
             = brg->is_int8 && !brg->is_int8_amx && brg->dt_a == data_type::s8;
     brg->LDA = (is_row_major()) ? static_cast<int>(LDA) : static_cast<int>(LDB);
@@ -643,6 +671,11 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
             && (!one_of(dt_bias, data_type::undef, data_type::f32)))
         return status::unimplemented;
 
+    const bool is_ymm = one_of(brg->isa_impl, avx2, avx2_vnni);
+    // bf16 conversions are not implemented for the avx2 flavor of the kernel
+    if (is_ymm && (dt_d == data_type::bf16 || dt_bias == data_type::bf16))
+        return status::unimplemented;
+
     brg->dt_d = dt_d;
     brg->typesize_D = types::data_type_size(brg->dt_d);
 
@@ -672,7 +705,7 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
 
     const int binary_ind = post_ops.find(primitive_kind::binary);
     brg->with_binary = binary_ind != -1;
-    const cpu_isa_t isa = get_max_cpu_isa();
+    const cpu_isa_t isa = is_ymm ? avx2 : get_max_cpu_isa();
 
     if ((brg->with_binary && !dst_md)
             || !injector::post_ops_ok(
@@ -696,6 +729,7 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
     const auto sum_dt
             = with_sum ? post_ops.entry_[sum_idx].sum.dt : data_type::undef;
     brg->sum_dt = sum_dt != data_type::undef ? sum_dt : dt_d;
+    if (is_ymm && brg->sum_dt == data_type::bf16) return status::unimplemented;
 
     const int eltwise_ind = post_ops.find(primitive_kind::eltwise);
     brg->with_eltwise = eltwise_ind != -1;
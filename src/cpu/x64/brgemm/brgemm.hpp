@@ -32,9 +32,13 @@ namespace x64 {
 ///     hardware will be used for BRGEMM kernel generation
 /// @param type Type of batch
 /// @param dt_a Data type of A matrix, can be
+///     AVX2: f32
+///     AVX2_VNNI: f32, u8(row-major layout), s8(column-major layout)
 ///     AVX512: f32, u8(row-major layout), s8(column-major layout), bf16
 ///     AMX: u8, s8, bf16
 /// @param dt_b Data type of B matrix
+///     AVX2: f32
+///     AVX2_VNNI: f32, s8(row-major layout), u8(column-major layout)
 ///     AVX512: f32, s8(row-major layout), u8(column-major layout), bf16
 ///     AMX: u8, s8, bf16
 /// @note
@@ -237,11 +237,13 @@ void jit_brdgmm_kernel_base_t::apply_post_ops(
                 register_guard_sum_zp(p_sum_zp_reg_set, this, {reg_ptr_sum_zp});
 
         if (p_sum_scale_reg_set)
-            mov(reg_ptr_sum_scale, reinterpret_cast<size_t>(p_sum_scale));
+            mov_host_addr(reg_ptr_sum_scale,
+                    reinterpret_cast<uintptr_t>(p_sum_scale));
 
         auto vmm_sum_zp = vmm_tmp(0);
         if (p_sum_zp_reg_set) {
-            mov(reg_ptr_sum_zp, reinterpret_cast<size_t>(p_sum_zp));
+            mov_host_addr(
+                    reg_ptr_sum_zp, reinterpret_cast<uintptr_t>(p_sum_zp));
             vcvtdq2ps(vmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
         }
 
@@ -581,11 +581,14 @@ void jit_brgemm_amx_uker_base_t::apply_post_ops_to_vector(const int idx,
         const int32_t *p_sum_zp = &brg.sum_zp;
         const bool p_sum_zp_reg_set = *p_sum_zp != 0;
 
-        if (p_sum_scale_reg_set) mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
+        if (p_sum_scale_reg_set)
+            mov_host_addr(reg_ptr_sum_scale,
+                    reinterpret_cast<uintptr_t>(p_sum_scale));
 
         const auto &zmm_sum_zp = zmm_tmp_2();
         if (p_sum_zp_reg_set) {
-            mov(reg_ptr_sum_zp, reinterpret_cast<size_t>(p_sum_zp));
+            mov_host_addr(
+                    reg_ptr_sum_zp, reinterpret_cast<uintptr_t>(p_sum_zp));
             vcvtdq2ps(zmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
         }
 
@@ -640,11 +643,13 @@ void jit_brgemm_amx_uker_base_t::apply_post_ops_to_range(
 
         {
             if (p_sum_scale_reg_set)
-                mov(reg_ptr_sum_scale, reinterpret_cast<size_t>(p_sum_scale));
+                mov_host_addr(reg_ptr_sum_scale,
+                        reinterpret_cast<uintptr_t>(p_sum_scale));
 
             const auto &zmm_sum_zp = zmm_tmp_2();
             if (p_sum_zp_reg_set) {
-                mov(reg_ptr_sum_zp, reinterpret_cast<size_t>(p_sum_zp));
+                mov_host_addr(
+                        reg_ptr_sum_zp, reinterpret_cast<uintptr_t>(p_sum_zp));
                 vcvtdq2ps(zmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
             }
 
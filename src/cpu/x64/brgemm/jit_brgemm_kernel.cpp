@@ -38,9 +38,16 @@ namespace x64 {
 using namespace dnnl::impl::utils;
 using namespace Xbyak;
 
+// The kernel is generated either for Zmm (avx512_core and higher) or for Ymm
+// (avx2 and avx2_vnni) vector registers. The Ymm flavor has no opmask
+// registers, the tails by the load dimension are handled with `vmaskmovps`
+// in the microkernel and with partial loads and stores when storing
+// accumulators.
+template <typename Wmm>
 struct jit_brgemm_kernel_t : public jit_generator {
     jit_brgemm_kernel_t(const brgemm_t &abrg)
-        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true,
+                abrg.isa_impl)
         , brg(abrg)
         , postops_injector_(nullptr) {
 
@@ -63,17 +70,25 @@ struct jit_brgemm_kernel_t : public jit_generator {
                             broadcasting_strategy_t::per_mb_w,
                             broadcasting_strategy_t::per_w,
                             broadcasting_strategy_t::no_broadcast};
-            const binary_injector::rhs_arg_static_params_t rhs_sp {
-                    static_cast<size_t>(Xbyak::Zmm(1).getIdx()), this->r14,
-                    this->r15, preserve_gpr, preserve_vmm,
-                    GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(data_C_ptr_),
-                    dst_md_wrapper, static_cast<size_t>(brg.ldb_tail),
-                    ld_tail_mask, use_exact_tail_scalar_bcast};
+            const auto rhs_sp = is_ymm
+                    ? binary_injector::rhs_arg_static_params_t {
+                            static_cast<size_t>(Vmm(1).getIdx()), this->r14,
+                            this->r15, preserve_gpr, preserve_vmm,
+                            GET_OFF(post_ops_binary_rhs_arg_vec),
+                            GET_OFF(data_C_ptr_), dst_md_wrapper,
+                            static_cast<size_t>(brg.ldb_tail),
+                            use_exact_tail_scalar_bcast}
+                    : binary_injector::rhs_arg_static_params_t {
+                            static_cast<size_t>(Vmm(1).getIdx()), this->r14,
+                            this->r15, preserve_gpr, preserve_vmm,
+                            GET_OFF(post_ops_binary_rhs_arg_vec),
+                            GET_OFF(data_C_ptr_), dst_md_wrapper,
+                            static_cast<size_t>(brg.ldb_tail), ld_tail_mask,
+                            use_exact_tail_scalar_bcast};
             const binary_injector::static_params_t bsp {
                     this->param1, enabled_bcast_strategy, rhs_sp};
 
-            postops_injector_ = utils::make_unique<
-                    injector::jit_uni_postops_injector_t<avx512_core>>(
+            postops_injector_ = utils::make_unique<po_injector_t>(
                     this, brg.attr->post_ops_, bsp);
 
             using namespace dnnl::impl::cpu::binary_injector_utils;
@@ -100,12 +115,18 @@ struct jit_brgemm_kernel_t : public jit_generator {
     }
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_kernel_t)
+    bool is_relocatable() const override { return true; }
 
     brgemm_t brg;
 
 private:
-    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_core>>
-            postops_injector_;
+    using Vmm = Wmm;
+    static constexpr bool is_ymm = std::is_same<Wmm, Xbyak::Ymm>::value;
+    static constexpr int max_vregs = is_ymm ? 16 : 32;
+    using po_injector_t = injector::jit_uni_postops_injector_t<
+            is_ymm ? avx2 : avx512_core>;
+
+    std::unique_ptr<po_injector_t> postops_injector_;
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 
     using reg64_t = const Xbyak::Reg64;
@@ -220,49 +241,60 @@ private:
     Xbyak::Opmask ld_full_mask = Xbyak::Opmask(2);
     Xbyak::Opmask ld_tail_mask = Xbyak::Opmask(3);
 
-    Xbyak::Zmm accm(int ld_block, int bd, int ld) {
-        return Xbyak::Zmm(31 - (bd * ld_block + ld));
+    Xbyak::Label ld_tail_mask_table_;
+
+    Vmm accm(int ld_block, int bd, int ld) {
+        return Vmm(max_vregs - 1 - (bd * ld_block + ld));
     }
 
-    Xbyak::Zmm bcst(int bd = 0) {
+    Vmm bcst(int bd = 0) {
         if (n_bcast_1_load) {
-            int idx = 31 - (brg.ld_block2 * brg.bd_block) - bd;
+            int idx = max_vregs - 1 - (brg.ld_block2 * brg.bd_block) - bd;
             assert(idx > 0);
-            return Xbyak::Zmm(idx);
+            return Vmm(idx);
         } else
-            return this->zmm0;
+            return Vmm(0);
     }
 
-    Xbyak::Zmm load(int ld = 0) {
+    Vmm load(int ld = 0) {
         if (n_bcast_1_load) {
-            return this->zmm0;
+            return Vmm(0);
         } else {
-            int idx = 31 - (brg.ld_block2 * brg.bd_block) - ld;
+            int idx = max_vregs - 1 - (brg.ld_block2 * brg.bd_block) - ld;
             assert(idx > 0);
-            return Xbyak::Zmm(idx);
+            return Vmm(idx);
         }
     }
 
-    const Xbyak::Zmm &zmm_tmp_1() const noexcept { return this->zmm0; }
-    const Xbyak::Zmm &zmm_tmp_2() const noexcept { return this->zmm1; }
-    const Xbyak::Zmm &zmm_tmp_3() const noexcept { return this->zmm2; }
-    const Xbyak::Zmm &zmm_inp_shift() const noexcept { return this->zmm1; }
+    Vmm vmm_tmp_1() const noexcept { return Vmm(0); }
+    Vmm vmm_tmp_2() const noexcept { return Vmm(1); }
+    Vmm vmm_tmp_3() const noexcept { return Vmm(2); }
+    Vmm vmm_inp_shift() const noexcept { return Vmm(1); }
+    // Ymm only: the mask of the load dimension tail for `vmaskmovps`, valid
+    // in the microkernel. The register is reserved by the blocking.
+    Vmm vmm_ld_tail_mask() const noexcept {
+        return Vmm(brg.req_s8s8_compensation ? 2 : 1);
+    }
 
     /* bf16 emulation */
-    const Xbyak::Zmm &bf16_emu_reserv_1() const noexcept { return this->zmm0; }
-    const Xbyak::Zmm &bf16_emu_reserv_2() const noexcept { return this->zmm1; }
-    const Xbyak::Zmm &bf16_emu_reserv_3() const noexcept { return this->zmm2; }
-    const Xbyak::Zmm &bf16_emu_reserv_4() const noexcept { return this->zmm3; }
+    Xbyak::Zmm bf16_emu_reserv_1() const noexcept { return Xbyak::Zmm(0); }
+    Xbyak::Zmm bf16_emu_reserv_2() const noexcept { return Xbyak::Zmm(1); }
+    Xbyak::Zmm bf16_emu_reserv_3() const noexcept { return Xbyak::Zmm(2); }
+    Xbyak::Zmm bf16_emu_reserv_4() const noexcept { return Xbyak::Zmm(3); }
     // note: zmm reserv_5 is not necessary since it's only used for 'vdpbf16ps'
 
-    Xbyak::Zmm zmm_mask(const Xbyak::Zmm zmm_in, bool mask_flag, bool store,
+    Vmm vmm_mask(const Vmm vmm_in, bool mask_flag, bool store,
             Xbyak::Opmask ktail_mask) const;
     Xbyak::Ymm ymm_mask(const Xbyak::Ymm ymm_in, bool mask_flag, bool store,
             Xbyak::Opmask ktail_mask) const;
 
-    void cvt2ps(data_type_t type_in, const Xbyak::Zmm zmm_in,
-            const Xbyak::Operand &op, bool mask_flag, bool store,
-            Xbyak::Opmask ktail_mask);
+    void cvt2ps(data_type_t type_in, const Vmm vmm_in, const Xbyak::Address &op,
+            bool mask_flag, bool store, Xbyak::Opmask ktail_mask);
+    void load_ld_tail_mask();
+    // Loads the `n` elements of f32/s32 type from `addr` into `vmm`, handles
+    // the load dimension tail on Ymm.
+    void load_dwords(const Vmm &vmm, const Xbyak::Address &addr, bool is_tail);
+    void broadcast_dword(const Vmm &vmm, const Xbyak::Address &addr);
 
     void advance_ldb_post_op_regs();
     void restore_ldb_post_op_regs(int ld_block2);
@@ -339,117 +371,152 @@ private:
     bool vpad_exist = false;
 };
 
-int jit_brgemm_kernel_t::A_offset(int bd, int rd, bool is_amx) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::A_offset(
+        int bd, int rd, bool is_amx) const noexcept {
     return (is_amx) ? brg.typesize_A * (bd * brg.bd_block * brg.LDA)
                     : brg.typesize_A * (bd * brg.LDA + rd);
 }
-int jit_brgemm_kernel_t::B_offset(int ld, int rd, bool is_amx) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::B_offset(
+        int ld, int rd, bool is_amx) const noexcept {
     return (is_amx)
             ? brg.typesize_B * (brg.rd_step * ld * brg.ld_block)
             : brg.typesize_B * (rd * brg.LDB + brg.rd_step * ld * brg.ld_block);
 }
-int jit_brgemm_kernel_t::C_offset(int bd, int ld) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::C_offset(int bd, int ld) const noexcept {
     return brg.typesize_C * (bd * brg.LDC + ld * brg.ld_block);
 }
-int jit_brgemm_kernel_t::D_offset(int bd, int ld) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::D_offset(int bd, int ld) const noexcept {
     return brg.typesize_D * (bd * brg.LDD + ld * brg.ld_block);
 }
-int jit_brgemm_kernel_t::po_offset(int bd, int ld) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::po_offset(int bd, int ld) const noexcept {
     return bd * brg.LDD + ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::rdb_A_offset() const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::rdb_A_offset() const noexcept {
     return brg.typesize_A * brg.rd_block;
 }
-int jit_brgemm_kernel_t::rdb_B_offset() const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::rdb_B_offset() const noexcept {
     return brg.typesize_B * brg.rd_block * brg.LDB;
 }
 
-int jit_brgemm_kernel_t::ldb_B_offset(int ld_block2, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::ldb_B_offset(int ld_block2, bool is_tail) const
         noexcept {
     return (is_tail) ? brg.typesize_B * brg.ldb_tail * brg.ld_step
                      : brg.typesize_B * ld_block2 * brg.ld_block * brg.ld_step;
 }
-int jit_brgemm_kernel_t::ldb_C_offset(int ld_block2, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::ldb_C_offset(int ld_block2, bool is_tail) const
         noexcept {
     return (is_tail) ? brg.typesize_C * brg.ldb_tail
                      : brg.typesize_C * ld_block2 * brg.ld_block;
 }
-int jit_brgemm_kernel_t::ldb_D_offset(int ld_block2, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::ldb_D_offset(int ld_block2, bool is_tail) const
         noexcept {
     return (is_tail) ? brg.typesize_D * brg.ldb_tail
                      : brg.typesize_D * ld_block2 * brg.ld_block;
 }
-int jit_brgemm_kernel_t::ldb_po_offset(int ld_block2, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::ldb_po_offset(int ld_block2, bool is_tail) const
         noexcept {
     return (is_tail) ? brg.ldb_tail : ld_block2 * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::bdb_A_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_A_offset(int bd_block2) const noexcept {
     return brg.typesize_A * bd_block2 * brg.bd_block * brg.LDA;
 }
-int jit_brgemm_kernel_t::bdb_C_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_C_offset(int bd_block2) const noexcept {
     return brg.typesize_C * bd_block2 * brg.bd_block * brg.LDC;
 }
-int jit_brgemm_kernel_t::bdb_D_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_D_offset(int bd_block2) const noexcept {
     return brg.typesize_D * bd_block2 * brg.bd_block * brg.LDD;
 }
-int jit_brgemm_kernel_t::bdb_po_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_po_offset(int bd_block2) const noexcept {
     return bd_block2 * brg.bd_block * brg.LDD;
 }
 
-int jit_brgemm_kernel_t::bias_offset(int ld, bool is_tail) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bias_offset(int ld, bool is_tail) const noexcept {
     return (is_tail) ? brg.typesize_bias * brg.ldb_tail
                      : brg.typesize_bias * ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::oc_logical_offset(int ld, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::oc_logical_offset(int ld, bool is_tail) const
         noexcept {
     return (is_tail) ? brg.ldb_tail : ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::compensations_offset(int ld, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::compensations_offset(int ld, bool is_tail) const
         noexcept {
     return (is_tail) ? sizeof(int32_t) * brg.ldb_tail
                      : sizeof(int32_t) * ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::bdb_compensation_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_compensation_offset(
+        int bd_block2) const noexcept {
     return sizeof(int32_t) * bd_block2 * brg.bd_block * brg.LDB;
 }
 
-int jit_brgemm_kernel_t::compensation_vpad_offset(int ld, int bd) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::compensation_vpad_offset(int ld, int bd) const
         noexcept {
     return sizeof(int32_t) * (ld * brg.ld_block + bd * brg.LDB);
 }
 
-int jit_brgemm_kernel_t::scales_offset(int ld, bool is_tail) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::scales_offset(
+        int ld, bool is_tail) const noexcept {
     return (is_tail) ? brg.is_oc_scale * sizeof(float) * brg.ldb_tail
                      : brg.is_oc_scale * sizeof(float) * ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::zp_comp_a_offset(int ld, bool is_tail) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::zp_comp_a_offset(
+        int ld, bool is_tail) const noexcept {
     return (is_tail) ? sizeof(int32_t) * brg.ldb_tail
                      : sizeof(int32_t) * ld * brg.ld_block;
 }
 
-int jit_brgemm_kernel_t::bdb_zp_comp_a_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_zp_comp_a_offset(
+        int bd_block2) const noexcept {
     return sizeof(int32_t) * bd_block2 * brg.bd_block * brg.LDB;
 }
 
-int jit_brgemm_kernel_t::zp_comp_a_vpad_offset(int ld, int bd) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::zp_comp_a_vpad_offset(
+        int ld, int bd) const noexcept {
     return sizeof(int32_t) * (ld * brg.ld_block + bd * brg.LDB);
 }
 
-int jit_brgemm_kernel_t::zp_comp_b_offset(int bd) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::zp_comp_b_offset(int bd) const noexcept {
     return sizeof(int32_t) * bd;
 }
 
-int jit_brgemm_kernel_t::bdb_zp_comp_b_offset(int bd_block2) const noexcept {
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::bdb_zp_comp_b_offset(
+        int bd_block2) const noexcept {
     return zp_comp_b_offset(bd_block2 * brg.bd_block);
 }
 
-int jit_brgemm_kernel_t::zp_c_values_offset(int ld, bool is_tail) const
+template <typename Wmm>
+int jit_brgemm_kernel_t<Wmm>::zp_c_values_offset(int ld, bool is_tail) const
         noexcept {
     if (brg.zp_type_c == brgemm_broadcast_t::per_n) {
         return (is_tail) ? sizeof(int32_t) * brg.ldb_tail
@@ -459,38 +526,81 @@ int jit_brgemm_kernel_t::zp_c_values_offset(int ld, bool is_tail) const
     return 0;
 }
 
-Xbyak::Zmm jit_brgemm_kernel_t::zmm_mask(const Xbyak::Zmm zmm_in,
-        bool mask_flag, bool store, Xbyak::Opmask ktail_mask) const {
-    return mask_flag ? (store ? zmm_in | ktail_mask : zmm_in | ktail_mask | T_z)
-                     : zmm_in;
+template <typename Wmm>
+Wmm jit_brgemm_kernel_t<Wmm>::vmm_mask(const Vmm vmm_in, bool mask_flag,
+        bool store, Xbyak::Opmask ktail_mask) const {
+    // Ymm tails are handled by the callers, there are no opmasks on avx2
+    if (is_ymm) return vmm_in;
+    return mask_flag ? (store ? vmm_in | ktail_mask : vmm_in | ktail_mask | T_z)
+                     : vmm_in;
 }
 
-Xbyak::Ymm jit_brgemm_kernel_t::ymm_mask(const Xbyak::Ymm ymm_in,
+template <typename Wmm>
+Xbyak::Ymm jit_brgemm_kernel_t<Wmm>::ymm_mask(const Xbyak::Ymm ymm_in,
         bool mask_flag, bool store, Xbyak::Opmask ktail_mask) const {
     return mask_flag ? (store ? ymm_in | ktail_mask : ymm_in | ktail_mask | T_z)
                      : ymm_in;
 }
 
-void jit_brgemm_kernel_t::cvt2ps(data_type_t type_in, const Xbyak::Zmm zmm_in,
-        const Xbyak::Operand &op, bool mask_flag, bool store,
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::cvt2ps(data_type_t type_in, const Vmm vmm_in,
+        const Xbyak::Address &op, bool mask_flag, bool store,
         Xbyak::Opmask ktail_mask) {
-    const Xbyak::Zmm zmm = zmm_mask(zmm_in, mask_flag, store, ktail_mask);
+    // On Ymm only the load dimension tail requires the partial load
+    const bool is_ymm_tail = is_ymm && mask_flag
+            && ktail_mask.getIdx() == ld_tail_mask.getIdx();
+    if (is_ymm_tail) {
+        const Xbyak::Ymm ymm_in(vmm_in.getIdx());
+        load_data(type_in, ymm_in, op, brg.ldb_tail);
+        if (type_in != data_type::f32) vcvtdq2ps(ymm_in, ymm_in);
+        return;
+    }
+    const Vmm vmm = vmm_mask(vmm_in, mask_flag, store, ktail_mask);
     switch (type_in) {
         case data_type::f32:
-        case data_type::s32: vmovups(zmm, op); break;
+        case data_type::s32: vmovups(vmm, op); break;
         case data_type::bf16:
-            vpmovzxwd(zmm, op);
-            vpslld(zmm, zmm, 16);
+            vpmovzxwd(vmm, op);
+            vpslld(vmm, vmm, 16);
             break;
-        case data_type::s8: vpmovsxbd(zmm, op); break;
-        case data_type::u8: vpmovzxbd(zmm, op); break;
+        case data_type::s8: vpmovsxbd(vmm, op); break;
+        case data_type::u8: vpmovzxbd(vmm, op); break;
         default: assert(!"unsupported data type");
     }
     if (!one_of(type_in, data_type::f32, data_type::bf16))
-        vcvtdq2ps(zmm_in, zmm_in);
+        vcvtdq2ps(vmm_in, vmm_in);
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::load_dwords(
+        const Vmm &vmm, const Xbyak::Address &addr, bool is_tail) {
+    if (is_ymm && is_tail)
+        load_bytes(Xbyak::Ymm(vmm.getIdx()), addr,
+                brg.ldb_tail * (int)sizeof(int32_t));
+    else if (is_tail)
+        vmovups(vmm | ld_tail_mask | T_z, addr);
+    else
+        vmovups(vmm, addr);
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::broadcast_dword(
+        const Vmm &vmm, const Xbyak::Address &addr) {
+    // Ymm has no embedded broadcast, the value goes to the whole register
+    vbroadcastss(vmm, addr);
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::load_ld_tail_mask() {
+    // The table holds `simd_w` ones followed by `simd_w` zeros, the mask of
+    // `ldb_tail` elements starts at `simd_w - ldb_tail`.
+    const int simd_w = 8;
+    const int offset = (simd_w - brg.ldb_tail) * sizeof(int32_t);
+    vmovups(vmm_ld_tail_mask(), ptr[rip + ld_tail_mask_table_ + offset]);
 }
 
-void jit_brgemm_kernel_t::advance_ldb_post_op_regs() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::advance_ldb_post_op_regs() {
     if (brg.with_bias) {
         mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]);
         add(reg_aux_bias, bias_offset(1));
@@ -520,7 +630,8 @@ void jit_brgemm_kernel_t::advance_ldb_post_op_regs() {
     }
 }
 
-void jit_brgemm_kernel_t::restore_ldb_post_op_regs(int ld_block2) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::restore_ldb_post_op_regs(int ld_block2) {
     if (brg.with_bias) {
         mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]);
         sub(reg_aux_bias, bias_offset(ld_block2 - 1));
@@ -550,7 +661,8 @@ void jit_brgemm_kernel_t::restore_ldb_post_op_regs(int ld_block2) {
     }
 }
 
-void jit_brgemm_kernel_t::advance_bdb_post_op_regs(int adj_bd_block) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::advance_bdb_post_op_regs(int adj_bd_block) {
     if (brg.zp_type_b != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_b, ptr[rsp + reg_aux_zp_comp_b_offs_]);
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
@@ -569,7 +681,8 @@ void jit_brgemm_kernel_t::advance_bdb_post_op_regs(int adj_bd_block) {
     }
 }
 
-void jit_brgemm_kernel_t::restore_bdb_post_op_regs(int bd_block2) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::restore_bdb_post_op_regs(int bd_block2) {
     bool post_processed = false;
     if (bd_block2 > 1) {
         if (brg.zp_type_b != brgemm_broadcast_t::none) {
@@ -594,7 +707,8 @@ void jit_brgemm_kernel_t::restore_bdb_post_op_regs(int bd_block2) {
     if (post_processed) mov(reg_buf, ptr[rsp + reg_buf_offs_]);
 }
 
-void jit_brgemm_kernel_t::ldb_regs_shift(int ld_block2, bool is_tail) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::ldb_regs_shift(int ld_block2, bool is_tail) {
     int C_offset = (is_tail) ? ldb_C_offset(1, true) : ldb_C_offset(ld_block2);
     int D_offset = (is_tail) ? ldb_D_offset(1, true) : ldb_D_offset(ld_block2);
     add(reg_aux_C, C_offset);
@@ -656,7 +770,8 @@ void jit_brgemm_kernel_t::ldb_regs_shift(int ld_block2, bool is_tail) {
     }
 }
 
-void jit_brgemm_kernel_t::advance_bd_block2_post_op_regs(int bd_block2) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::advance_bd_block2_post_op_regs(int bd_block2) {
     if (with_binary_per_oc_sp_bcast_) {
         mov(reg_aux_binary_postops_oc_l,
                 ptr[rsp + reg_binary_postops_oc_l_offs_]);
@@ -686,7 +801,9 @@ void jit_brgemm_kernel_t::advance_bd_block2_post_op_regs(int bd_block2) {
     }
 }
 
-void jit_brgemm_kernel_t::copy_post_ops_stack_values_to_aux(bool is_reg_tail) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::copy_post_ops_stack_values_to_aux(
+        bool is_reg_tail) {
     if (!is_reg_tail) {
         mov(reg_aux_C, reg_C);
         mov(reg_aux_D, reg_D);
@@ -738,7 +855,8 @@ void jit_brgemm_kernel_t::copy_post_ops_stack_values_to_aux(bool is_reg_tail) {
     }
 }
 
-void jit_brgemm_kernel_t::read_params() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::read_params() {
     Label label_done;
 
     if (brg.with_binary) mov(ptr[rsp + abi_param1_offs_], param1);
@@ -825,8 +943,10 @@ void jit_brgemm_kernel_t::read_params() {
     mov(ptr[rsp + reg_zp_a_val_offs_], reg_zp_a_val);
 }
 
-void jit_brgemm_kernel_t::zero_accumulators(int bd_block2, bool is_bdb_tail,
-        int ld_block2, bool is_ld_tail, bool skip_accumulation) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::zero_accumulators(int bd_block2,
+        bool is_bdb_tail, int ld_block2, bool is_ld_tail,
+        bool skip_accumulation) {
     if (brg.is_amx) {
         // avoid usage of tile registers if there is no accumulation
         if (skip_accumulation) return;
@@ -845,12 +965,13 @@ void jit_brgemm_kernel_t::zero_accumulators(int bd_block2, bool is_bdb_tail,
     }
 }
 
-void jit_brgemm_kernel_t::apply_alpha_beta(
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::apply_alpha_beta(
         int bd_block, int ld_block2, bool is_ld_tail) {
     auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
-    auto zmm_beta = zmm_tmp_1();
-    auto zmm_alpha = zmm_tmp_2();
-    auto zmm_prev_dst = zmm_tmp_3();
+    auto vmm_beta = vmm_tmp_1();
+    auto vmm_alpha = vmm_tmp_2();
+    auto vmm_prev_dst = vmm_tmp_3();
 
     const bool apply_alpha = brg.alpha != 1.f;
     const bool apply_beta = brg.beta != 0.f;
@@ -861,36 +982,43 @@ void jit_brgemm_kernel_t::apply_alpha_beta(
 
     if (apply_beta && !use_vadd_for_beta) {
         mov(reg_tmp_gpr, float2int(static_cast<float>(brg.beta)));
-        movq(Xmm(zmm_beta.getIdx()), reg_tmp_gpr);
-        vbroadcastss(zmm_beta, Xmm(zmm_beta.getIdx()));
+        movq(Xmm(vmm_beta.getIdx()), reg_tmp_gpr);
+        vbroadcastss(vmm_beta, Xmm(vmm_beta.getIdx()));
     }
     if (apply_alpha) {
         mov(reg_tmp_gpr, float2int(static_cast<float>(brg.alpha)));
-        movq(Xmm(zmm_alpha.getIdx()), reg_tmp_gpr);
-        vbroadcastss(zmm_alpha, Xmm(zmm_alpha.getIdx()));
+        movq(Xmm(vmm_alpha.getIdx()), reg_tmp_gpr);
+        vbroadcastss(vmm_alpha, Xmm(vmm_alpha.getIdx()));
     }
     for_(int bd = 0; bd < bd_block; bd++)
     for (int ld = 0; ld < ld_block2; ld++) {
-        auto zmm = accm(ld_block2, bd, ld);
-        if (dq2ps_required) vcvtdq2ps(zmm, zmm);
-        if (apply_alpha) vmulps(zmm, zmm, zmm_alpha);
+        auto vmm = accm(ld_block2, bd, ld);
+        if (dq2ps_required) vcvtdq2ps(vmm, vmm);
+        if (apply_alpha) vmulps(vmm, vmm, vmm_alpha);
         if (apply_beta) {
             auto ptr_C = ptr[reg_aux_C + C_offset(bd, ld)];
-            if (use_vadd_for_beta) {
-                auto zmm_masked = zmm | k_mask | T_z;
+            if (use_vadd_for_beta && is_ymm && is_ld_tail) {
+                load_dwords(vmm_prev_dst, ptr_C, true);
+                if (brg.is_int8)
+                    vpaddd(vmm, vmm, vmm_prev_dst);
+                else
+                    vaddps(vmm, vmm, vmm_prev_dst);
+            } else if (use_vadd_for_beta) {
+                auto vmm_masked = vmm_mask(vmm, true, false, k_mask);
                 if (brg.is_int8)
-                    vpaddd(zmm_masked, zmm, ptr_C);
+                    vpaddd(vmm_masked, vmm, ptr_C);
                 else
-                    vaddps(zmm_masked, zmm, ptr_C);
+                    vaddps(vmm_masked, vmm, ptr_C);
             } else {
-                cvt2ps(brg.dt_c, zmm_prev_dst, ptr_C, true, false, k_mask);
-                vfmadd231ps(zmm, zmm_prev_dst, zmm_beta);
+                cvt2ps(brg.dt_c, vmm_prev_dst, ptr_C, true, false, k_mask);
+                vfmadd231ps(vmm, vmm_prev_dst, vmm_beta);
             }
         }
     }
 }
 
-void jit_brgemm_kernel_t::apply_post_ops(
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::apply_post_ops(
         int bd_block, int ld_block2, int ldb_and_bdb_offset, bool is_ld_tail) {
 
     binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
@@ -904,12 +1032,12 @@ void jit_brgemm_kernel_t::apply_post_ops(
         if (handle_binary_po_offset_) {
             for_(int bd = 0; bd < bd_block; bd++)
             for (int ld = 0; ld < ld_block2; ld++) {
-                const auto zmm_idx = accm(ld_block2, bd, ld).getIdx();
+                const auto vmm_idx = accm(ld_block2, bd, ld).getIdx();
 
-                rhs_arg_params.vmm_idx_to_out_reg.emplace(zmm_idx, reg_aux_D);
+                rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_aux_D);
                 rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
-                        zmm_idx, D_offset(bd, ld));
-                if (is_ld_tail) rhs_arg_params.vmm_tail_idx_.emplace(zmm_idx);
+                        vmm_idx, D_offset(bd, ld));
+                if (is_ld_tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
             }
         }
     }
@@ -930,28 +1058,41 @@ void jit_brgemm_kernel_t::apply_post_ops(
                             p_sum_zp_reg_set, this, {reg_ptr_sum_zp});
 
             if (p_sum_scale_reg_set)
-                mov(reg_ptr_sum_scale, reinterpret_cast<size_t>(p_sum_scale));
+                mov_host_addr(reg_ptr_sum_scale,
+                        reinterpret_cast<uintptr_t>(p_sum_scale));
 
-            const auto &zmm_sum_zp = zmm_tmp_2();
+            const auto vmm_sum_zp = vmm_tmp_2();
             if (p_sum_zp_reg_set) {
-                mov(reg_ptr_sum_zp, reinterpret_cast<size_t>(p_sum_zp));
-                vcvtdq2ps(zmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
+                mov_host_addr(
+                        reg_ptr_sum_zp, reinterpret_cast<uintptr_t>(p_sum_zp));
+                if (is_ymm) {
+                    vpbroadcastd(vmm_sum_zp, ptr[reg_ptr_sum_zp]);
+                    vcvtdq2ps(vmm_sum_zp, vmm_sum_zp);
+                } else
+                    vcvtdq2ps(vmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
             }
 
+            // Ymm has no embedded broadcast, the scale is kept in a register
+            const auto vmm_sum_scale = vmm_tmp_3();
+            if (is_ymm && p_sum_scale_reg_set)
+                broadcast_dword(vmm_sum_scale, ptr[reg_ptr_sum_scale]);
+
             const auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
 
             for (int bd = 0; bd < bd_block; bd++) {
                 for (int ld = 0; ld < ld_block2; ld++) {
-                    const auto zmm = accm(ld_block2, bd, ld);
+                    const auto vmm = accm(ld_block2, bd, ld);
                     const auto addr = ptr[reg_aux_D + D_offset(bd, ld)];
-                    const auto zmm_prev_dst = Xbyak::Zmm(0);
-                    cvt2ps(brg.sum_dt, zmm_prev_dst, addr, true, false, k_mask);
-                    if (p_sum_zp_reg_set) vsubps(zmm_prev_dst, zmm_sum_zp);
+                    const auto vmm_prev_dst = Vmm(0);
+                    cvt2ps(brg.sum_dt, vmm_prev_dst, addr, true, false, k_mask);
+                    if (p_sum_zp_reg_set) vsubps(vmm_prev_dst, vmm_sum_zp);
                     if (!p_sum_scale_reg_set)
-                        vaddps(zmm, zmm_prev_dst);
+                        vaddps(vmm, vmm_prev_dst);
+                    else if (is_ymm)
+                        vfmadd231ps(vmm, vmm_prev_dst, vmm_sum_scale);
                     else
                         vfmadd231ps(
-                                zmm, zmm_prev_dst, zword_b[reg_ptr_sum_scale]);
+                                vmm, vmm_prev_dst, zword_b[reg_ptr_sum_scale]);
                 }
             }
         }
@@ -963,10 +1104,11 @@ void jit_brgemm_kernel_t::apply_post_ops(
     }
 
     postops_injector_->compute_vector_range(
-            32 - bd_block * ld_block2, 32, rhs_arg_params);
+            max_vregs - bd_block * ld_block2, max_vregs, rhs_arg_params);
 }
 
-void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(
         int bd_block, int ld_block2, int ldb_and_bdb_offset, bool is_ld_tail) {
     auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
 
@@ -981,13 +1123,13 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
     if (brg.with_bias) { mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]); }
     for_(int bd = 0; bd < bd_block; bd++)
     for (int ld = 0; ld < ld_block2; ld++) {
-        auto zmm = accm(ld_block2, bd, ld);
-        if (dq2ps_required) vcvtdq2ps(zmm, zmm);
+        auto vmm = accm(ld_block2, bd, ld);
+        if (dq2ps_required) vcvtdq2ps(vmm, vmm);
         if (brg.with_bias) {
-            auto zmm_bias = zmm_tmp_1();
+            auto vmm_bias = vmm_tmp_1();
             auto ptr_bias = ptr[reg_aux_bias + bias_offset(ld)];
-            cvt2ps(brg.dt_bias, zmm_bias, ptr_bias, true, false, k_mask);
-            vaddps(zmm, zmm, zmm_bias);
+            cvt2ps(brg.dt_bias, vmm_bias, ptr_bias, true, false, k_mask);
+            vaddps(vmm, vmm, vmm_bias);
         }
     }
 
@@ -995,9 +1137,17 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
         mov(reg_aux_scales, ptr[rsp + reg_aux_scales_offs_]);
         for (int bd = 0; bd < bd_block; bd++) {
             for (int ld = 0; ld < ld_block2; ld++) {
-                const Xbyak::Zmm zmm = zmm_mask(
-                        accm(ld_block2, bd, ld), true, false, k_mask);
-                vmulps(zmm, zmm, ptr[reg_aux_scales + scales_offset(ld)]);
+                const auto addr = ptr[reg_aux_scales + scales_offset(ld)];
+                if (is_ymm) {
+                    const auto vmm = accm(ld_block2, bd, ld);
+                    const auto vmm_scales = vmm_tmp_1();
+                    load_dwords(vmm_scales, addr, is_ld_tail);
+                    vmulps(vmm, vmm, vmm_scales);
+                } else {
+                    const Vmm vmm = vmm_mask(
+                            accm(ld_block2, bd, ld), true, false, k_mask);
+                    vmulps(vmm, vmm, addr);
+                }
             }
         }
     }
@@ -1007,33 +1157,38 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
 
     if (brg.zp_type_c != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_c_values, ptr[rsp + reg_aux_zp_c_values_offs_]);
-        auto zmm_zp_c = zmm_tmp_1();
+        auto vmm_zp_c = vmm_tmp_1();
         if (brg.zp_type_c == brgemm_broadcast_t::per_tensor) {
-            vcvtdq2ps(
-                    zmm_zp_c, EVEX_compress_addr(reg_aux_zp_c_values, 0, true));
+            if (is_ymm) {
+                vpbroadcastd(vmm_zp_c, ptr[reg_aux_zp_c_values]);
+                vcvtdq2ps(vmm_zp_c, vmm_zp_c);
+            } else
+                vcvtdq2ps(vmm_zp_c,
+                        EVEX_compress_addr(reg_aux_zp_c_values, 0, true));
         }
         for (int ld = 0; ld < ld_block2; ld++) {
             if (brg.zp_type_c == brgemm_broadcast_t::per_n) {
                 int zp_c_off = zp_c_values_offset(ld);
-                auto zp_c_addr
-                        = EVEX_compress_addr(reg_aux_zp_c_values, zp_c_off);
-                cvt2ps(data_type::s32, zmm_zp_c, zp_c_addr, true, false,
+                auto zp_c_addr = is_ymm
+                        ? ptr[reg_aux_zp_c_values + zp_c_off]
+                        : EVEX_compress_addr(reg_aux_zp_c_values, zp_c_off);
+                cvt2ps(data_type::s32, vmm_zp_c, zp_c_addr, true, false,
                         k_mask);
             }
             for (int bd = 0; bd < bd_block; bd++) {
-                auto zmm = accm(ld_block2, bd, ld);
-                vaddps(zmm, zmm, zmm_zp_c);
+                auto vmm = accm(ld_block2, bd, ld);
+                vaddps(vmm, vmm, vmm_zp_c);
             }
         }
     }
 
     const bool dt_requires_saturation
             = one_of(brg.dt_d, data_type::u8, data_type::s8, data_type::s32);
-    auto zmm_lbound = zmm_tmp_1();
-    auto zmm_ubound = zmm_tmp_2();
+    auto vmm_lbound = vmm_tmp_1();
+    auto vmm_ubound = vmm_tmp_2();
     if (dt_requires_saturation) {
         init_saturate_f32(
-                zmm_lbound, zmm_ubound, reg_tmp_gpr, data_type::f32, brg.dt_d);
+                vmm_lbound, vmm_ubound, reg_tmp_gpr, data_type::f32, brg.dt_d);
     }
 
     if (brg.is_bf16_emu) bf16_emu_->init_vcvtneps2bf16();
@@ -1041,16 +1196,24 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
     for (int bd = 0; bd < bd_block; bd++) {
         if (dt_requires_saturation) {
             for (int ld = 0; ld < ld_block2; ld++) {
-                auto zmm = accm(ld_block2, bd, ld);
-                saturate_f32(zmm, zmm_lbound, zmm_ubound, brg.dt_d);
-                vcvtps2dq(zmm, zmm);
+                auto vmm = accm(ld_block2, bd, ld);
+                saturate_f32(vmm, vmm_lbound, vmm_ubound, brg.dt_d);
+                vcvtps2dq(vmm, vmm);
             }
         }
         for (int ld = 0; ld < ld_block2; ld++) {
             auto addr = ptr[reg_aux_D + D_offset(bd, ld)];
-            auto zmm = accm(ld_block2, bd, ld);
-            auto ymm = Xbyak::Ymm(zmm.getIdx());
-            const Xbyak::Zmm r_zmm = zmm_mask(zmm, true, true, k_mask);
+            auto vmm = accm(ld_block2, bd, ld);
+            if (is_ymm) {
+                // bf16 destination is not supported on avx2
+                store_data(brg.dt_d, Xbyak::Ymm(vmm.getIdx()), reg_aux_D,
+                        D_offset(bd, ld),
+                        is_ld_tail ? brg.ldb_tail : brg.ld_block);
+                continue;
+            }
+            auto zmm = Xbyak::Zmm(vmm.getIdx());
+            auto ymm = Xbyak::Ymm(vmm.getIdx());
+            const Xbyak::Zmm r_zmm = zmm | k_mask;
             const Xbyak::Ymm r_ymm = ymm_mask(ymm, true, true, k_mask);
             switch (brg.dt_d) {
                 case data_type::f32:
@@ -1072,38 +1235,43 @@ void jit_brgemm_kernel_t::store_accumulators_apply_post_ops(
     }
 }
 
-void jit_brgemm_kernel_t::apply_compensation(
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::apply_compensation(
         int bd_block, int ld_block2, bool is_ld_tail) {
     // apply compensation to accumulated values
     // to avoid the loss of accuracy when converting s32 to f32
-    auto k_mask = (!is_ld_tail) ? ld_full_mask : ld_tail_mask;
-
     if (brg.zp_type_a != brgemm_broadcast_t::none) {
-        auto zmm_zp_a_val = zmm_tmp_2();
+        auto vmm_zp_a_val = vmm_tmp_2();
         mov(reg_zp_a_val, ptr[rsp + reg_zp_a_val_offs_]);
-        vpbroadcastd(zmm_zp_a_val, reg_zp_a_val.cvt32());
+        if (is_ymm) {
+            const Xbyak::Xmm xmm_zp_a_val(vmm_zp_a_val.getIdx());
+            vmovd(xmm_zp_a_val, reg_zp_a_val.cvt32());
+            vpbroadcastd(vmm_zp_a_val, xmm_zp_a_val);
+        } else
+            vpbroadcastd(vmm_zp_a_val, reg_zp_a_val.cvt32());
 
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
         for (int ld = 0; ld < ld_block2; ld++) {
-            auto zmm_zp_comp_a = zmm_tmp_1();
+            auto vmm_zp_comp_a = vmm_tmp_1();
             int zp_comp_a_off = zp_comp_a_offset(ld);
-            auto zp_comp_a_addr
-                    = EVEX_compress_addr(reg_aux_zp_comp_a, zp_comp_a_off);
+            auto zp_comp_a_addr = is_ymm
+                    ? ptr[reg_aux_zp_comp_a + zp_comp_a_off]
+                    : EVEX_compress_addr(reg_aux_zp_comp_a, zp_comp_a_off);
             // apply src zero points value to the accumulated values
-            zmm_zp_comp_a = zmm_mask(zmm_zp_comp_a, true, false, k_mask);
-            vmovups(zmm_zp_comp_a, zp_comp_a_addr);
-            vpmulld(zmm_zp_comp_a, zmm_zp_comp_a, zmm_zp_a_val);
+            load_dwords(vmm_zp_comp_a, zp_comp_a_addr, is_ld_tail);
+            vpmulld(vmm_zp_comp_a, vmm_zp_comp_a, vmm_zp_a_val);
 
             for (int bd = 0; bd < bd_block; bd++) {
                 if (brg.with_comp_pads) {
                     auto zp_comp_a_vpad_offs = zp_comp_a_vpad_offset(ld, bd);
                     auto zp_comp_a_vpad_addr
-                            = zword[reg_aux_zp_comp_a + zp_comp_a_vpad_offs];
-                    vmovups(zmm_zp_comp_a, zp_comp_a_vpad_addr);
-                    vpmulld(zmm_zp_comp_a, zmm_zp_comp_a, zmm_zp_a_val);
+                            = ptr[reg_aux_zp_comp_a + zp_comp_a_vpad_offs];
+                    load_dwords(
+                            vmm_zp_comp_a, zp_comp_a_vpad_addr, is_ld_tail);
+                    vpmulld(vmm_zp_comp_a, vmm_zp_comp_a, vmm_zp_a_val);
                 }
-                auto zmm = accm(ld_block2, bd, ld);
-                vpaddd(zmm, zmm, zmm_zp_comp_a);
+                auto vmm = accm(ld_block2, bd, ld);
+                vpaddd(vmm, vmm, vmm_zp_comp_a);
             }
         }
     }
@@ -1112,11 +1280,21 @@ void jit_brgemm_kernel_t::apply_compensation(
         mov(reg_aux_zp_comp_b, ptr[rsp + reg_aux_zp_comp_b_offs_]);
         for (int bd = 0; bd < bd_block; bd++) {
             int zp_comp_b_off = zp_comp_b_offset(bd);
+            if (is_ymm) {
+                auto vmm_zp_comp_b = vmm_tmp_1();
+                vpbroadcastd(vmm_zp_comp_b,
+                        ptr[reg_aux_zp_comp_b + zp_comp_b_off]);
+                for (int ld = 0; ld < ld_block2; ld++) {
+                    auto vmm = accm(ld_block2, bd, ld);
+                    vpaddd(vmm, vmm, vmm_zp_comp_b);
+                }
+                continue;
+            }
             auto zp_comp_b_addr = EVEX_compress_addr(
                     reg_aux_zp_comp_b, zp_comp_b_off, true);
             for (int ld = 0; ld < ld_block2; ld++) {
-                auto zmm = accm(ld_block2, bd, ld);
-                vpaddd(zmm, zmm, zp_comp_b_addr);
+                auto vmm = accm(ld_block2, bd, ld);
+                vpaddd(vmm, vmm, zp_comp_b_addr);
             }
         }
     }
@@ -1124,28 +1302,29 @@ void jit_brgemm_kernel_t::apply_compensation(
     if (brg.req_s8s8_compensation) {
         mov(reg_aux_compensation, ptr[rsp + reg_aux_comp_offs_]);
         for (int ld = 0; ld < ld_block2; ld++) {
-            auto zmm_comp = zmm_tmp_1();
+            auto vmm_comp = vmm_tmp_1();
             int comp_offset = compensations_offset(ld);
-            auto comp_addr
-                    = EVEX_compress_addr(reg_aux_compensation, comp_offset);
-            zmm_comp = zmm_mask(zmm_comp, true, false, k_mask);
-            vmovups(zmm_comp, comp_addr);
+            auto comp_addr = is_ymm
+                    ? ptr[reg_aux_compensation + comp_offset]
+                    : EVEX_compress_addr(reg_aux_compensation, comp_offset);
+            load_dwords(vmm_comp, comp_addr, is_ld_tail);
 
             for (int bd = 0; bd < bd_block; bd++) {
                 if (brg.with_comp_pads) {
                     auto comp_vpad_offs = compensation_vpad_offset(ld, bd);
                     auto comp_vpad_addr
-                            = zword[reg_aux_compensation + comp_vpad_offs];
-                    vmovups(zmm_comp, comp_vpad_addr);
+                            = ptr[reg_aux_compensation + comp_vpad_offs];
+                    load_dwords(vmm_comp, comp_vpad_addr, is_ld_tail);
                 }
-                auto zmm = accm(ld_block2, bd, ld);
-                vpaddd(zmm, zmm, zmm_comp);
+                auto vmm = accm(ld_block2, bd, ld);
+                vpaddd(vmm, vmm, vmm_comp);
             }
         }
     }
 }
 
-void jit_brgemm_kernel_t::store_accumulators_without_post_ops(
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::store_accumulators_without_post_ops(
         int bd_block, int ld_block2, bool is_ld_tail) {
 
     // if (brg.is_int8 && alpha_or_beta_applicable && !beta_uses_vadd) ->
@@ -1155,34 +1334,39 @@ void jit_brgemm_kernel_t::store_accumulators_without_post_ops(
             = brg.beta == 1.f && IMPLICATION(brg.is_int8, brg.alpha == 1.0f);
     const bool dt_requires_saturation = brg.is_int8
             && !IMPLICATION(alpha_or_beta_applicable, beta_uses_vadd);
-    auto zmm_lbound = zmm_tmp_1();
-    auto zmm_ubound = zmm_tmp_2();
+    auto vmm_lbound = vmm_tmp_1();
+    auto vmm_ubound = vmm_tmp_2();
     if (dt_requires_saturation) {
         init_saturate_f32(
-                zmm_lbound, zmm_ubound, reg_tmp_gpr, data_type::f32, brg.dt_d);
+                vmm_lbound, vmm_ubound, reg_tmp_gpr, data_type::f32, brg.dt_d);
     }
 
     for (int bd = 0; bd < bd_block; bd++) {
         if (dt_requires_saturation) {
             for (int ld = 0; ld < ld_block2; ld++) {
-                auto zmm = accm(ld_block2, bd, ld);
-                saturate_f32(zmm, zmm_lbound, zmm_ubound, brg.dt_d);
-                vcvtps2dq(zmm, zmm);
+                auto vmm = accm(ld_block2, bd, ld);
+                saturate_f32(vmm, vmm_lbound, vmm_ubound, brg.dt_d);
+                vcvtps2dq(vmm, vmm);
             }
         }
         for (int ld = 0; ld < ld_block2; ld++) {
-            auto zmm = accm(ld_block2, bd, ld);
-            if (is_ld_tail)
+            auto vmm = accm(ld_block2, bd, ld);
+            if (is_ymm && is_ld_tail)
+                store_bytes(Xbyak::Ymm(vmm.getIdx()), reg_aux_C,
+                        C_offset(bd, ld), brg.ldb_tail * brg.typesize_C);
+            else if (is_ld_tail)
                 vmovups(ptr[reg_aux_C + C_offset(bd, ld)] | ld_tail_mask | T_z,
-                        zmm);
+                        vmm);
             else
-                vmovups(ptr[reg_aux_C + C_offset(bd, ld)], zmm);
+                vmovups(ptr[reg_aux_C + C_offset(bd, ld)], vmm);
         }
     }
 }
 
-void jit_brgemm_kernel_t::store_accumulators(int bd_block2, bool is_bdb_tail,
-        int ld_block2, bool is_ld_tail, bool skip_accumulation) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::store_accumulators(int bd_block2,
+        bool is_bdb_tail, int ld_block2, bool is_ld_tail,
+        bool skip_accumulation) {
     const bool has_zero_points = !everyone_is(brgemm_broadcast_t::none,
             brg.zp_type_a, brg.zp_type_b, brg.zp_type_c);
     const bool are_post_ops_applicable = one_of(true, brg.with_eltwise,
@@ -1320,7 +1504,8 @@ void jit_brgemm_kernel_t::store_accumulators(int bd_block2, bool is_bdb_tail,
     }
 }
 
-void jit_brgemm_kernel_t::restore_A_B_matrices() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::restore_A_B_matrices() {
     auto restore_reg_batch = brg.brgattr.max_bs > 1 || vpad_exist;
     if (brg.type == brgemm_addr) {
         if (restore_reg_batch) mov(reg_aux1_batch, reg_addr_batch);
@@ -1337,7 +1522,8 @@ void jit_brgemm_kernel_t::restore_A_B_matrices() {
     }
 }
 
-void jit_brgemm_kernel_t::set_A_B_matrices() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::set_A_B_matrices() {
     if (brg.type == brgemm_addr) {
         if (brg.brgattr.max_bs > 1) {
             if (brg.layout == brgemm_row_major) {
@@ -1391,8 +1577,9 @@ void jit_brgemm_kernel_t::set_A_B_matrices() {
     add(reg_aux_B, reg_b_offset);
 }
 
-void jit_brgemm_kernel_t::gemm_microkernel_amx(int bd_block2, bool is_bdb_tail,
-        int ld_block2, bool is_rd_tail, bool is_ld_tail) {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::gemm_microkernel_amx(int bd_block2,
+        bool is_bdb_tail, int ld_block2, bool is_rd_tail, bool is_ld_tail) {
     auto tdpbxxd = [=](const Tmm &x1, const Tmm &x2, const Tmm &x3) {
         if (brg.dt_a == data_type::bf16 && brg.dt_b == data_type::bf16) {
             tdpbf16ps(x1, x2, x3);
@@ -1450,17 +1637,19 @@ void jit_brgemm_kernel_t::gemm_microkernel_amx(int bd_block2, bool is_bdb_tail,
     }
 }
 
-void jit_brgemm_kernel_t::gemm_microkernel_avx512(int bd_block2,
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::gemm_microkernel_avx512(int bd_block2,
         bool is_bdb_tail, int ld_block2, bool is_rd_tail, bool is_ld_tail,
         int vpad, int rows_for_rd_tail) {
     MAYBE_UNUSED(bd_block2);
-    auto dot_product = [=](Zmm z1, Zmm z2, Zmm z3) {
+    auto dot_product = [=](Vmm z1, Vmm z2, Vmm z3) {
         if (brg.is_f32)
             vfmadd231ps(z1, z2, z3);
         else if (brg.is_bf16)
             vdpbf16ps(z1, z2, z3);
         else if (brg.is_int8)
-            vpdpbusd(z1, z3, z2);
+            vpdpbusd(z1, z3, z2,
+                    is_ymm ? Xbyak::VexEncoding : Xbyak::EvexEncoding);
     };
 
     int bd_block = (is_bdb_tail) ? brg.bdb_tail : brg.bd_block;
@@ -1482,9 +1671,9 @@ void jit_brgemm_kernel_t::gemm_microkernel_avx512(int bd_block2,
     } else
         rd_loop = brg.rd_block;
 
-    auto broadcast = [=](Zmm z1, size_t offset, bool is_tail) {
+    auto broadcast = [=](Vmm z1, size_t offset, bool is_tail) {
         if (is_tail) {
-            vpxord(z1, z1, z1);
+            uni_vpxor(z1, z1, z1);
             Xmm xmm_tmp = Xmm(z1.getIdx());
             load_bytes(
                     xmm_tmp, reg_aux_A, offset, rd_tail_size * brg.typesize_A);
@@ -1496,7 +1685,17 @@ void jit_brgemm_kernel_t::gemm_microkernel_avx512(int bd_block2,
                 vpbroadcastd(z1, ptr[reg_aux_A + offset]);
         }
 
-        if (brg.req_s8s8_compensation) vpaddb(z1, z1, zmm_inp_shift());
+        if (brg.req_s8s8_compensation) vpaddb(z1, z1, vmm_inp_shift());
+    };
+
+    auto load_B = [=](Vmm z1, size_t offset) {
+        const auto addr = ptr[reg_aux_B + offset];
+        if (is_ld_tail && is_ymm)
+            vmaskmovps(z1, vmm_ld_tail_mask(), addr);
+        else if (is_ld_tail)
+            vmovups(z1 | ld_tail_mask | T_z, addr);
+        else
+            vmovups(z1, addr);
     };
 
     bool maybe_load_bytes = (rows_for_rd_tail > 0 || brg.brgattr.wary_tail_read)
@@ -1514,33 +1713,22 @@ void jit_brgemm_kernel_t::gemm_microkernel_avx512(int bd_block2,
                         have_to_load_bytes && bd_by_load_bytes);
             }
             for (int ld = 0; ld < ld_block2; ld++) {
-                if (is_ld_tail) {
-                    vmovups(load() | ld_tail_mask | T_z,
-                            ptr[reg_aux_B + B_offset(ld, rd)]);
-                } else {
-                    vmovups(load(), ptr[reg_aux_B + B_offset(ld, rd)]);
-                }
+                load_B(load(), B_offset(ld, rd));
                 for (int bd = bd_b; bd < bd_e; bd++) {
-                    auto zmm = accm(ld_block2, bd, ld);
+                    auto vmm = accm(ld_block2, bd, ld);
                     if (is_emdbd)
-                        vfmadd231ps(zmm, load(),
+                        vfmadd231ps(vmm, load(),
                                 zword_b[reg_aux_A + A_offset(bd, rd)]);
                     else
-                        dot_product(zmm, load(), bcst(bd));
+                        dot_product(vmm, load(), bcst(bd));
                 }
             }
         }
     } else {
         for (int rd = 0; rd < rd_loop; rd += brg.rd_step) {
             int prefetch_count_B = 0;
-            for (int ld = 0; ld < ld_block2; ld++) {
-                if (is_ld_tail) {
-                    vmovups(load(ld) | ld_tail_mask | T_z,
-                            ptr[reg_aux_B + B_offset(ld, rd)]);
-                } else {
-                    vmovups(load(ld), ptr[reg_aux_B + B_offset(ld, rd)]);
-                }
-            }
+            for (int ld = 0; ld < ld_block2; ld++)
+                load_B(load(ld), B_offset(ld, rd));
 
             bool have_to_load_bytes
                     = maybe_load_bytes && (rd == rd_loop - brg.rd_step);
@@ -1559,19 +1747,20 @@ void jit_brgemm_kernel_t::gemm_microkernel_avx512(int bd_block2,
                             + brg.LDB * brg.rd_block * brg.typesize_B]);
                 }
                 for (int ld = 0; ld < ld_block2; ld++) {
-                    auto zmm = accm(ld_block2, bd, ld);
+                    auto vmm = accm(ld_block2, bd, ld);
                     if (is_emdbd)
-                        vfmadd231ps(zmm, load(ld),
+                        vfmadd231ps(vmm, load(ld),
                                 zword_b[reg_aux_A + A_offset(bd, rd)]);
                     else
-                        dot_product(zmm, load(ld), bcst());
+                        dot_product(vmm, load(ld), bcst());
                 }
             }
         }
     }
 }
 
-void jit_brgemm_kernel_t::ldb_loop(int bd_block2, bool is_bdb_tail,
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
         int ld_block2, int ldb_loop_length, bool is_reg_tail, bool is_ld_tail,
         bool check_top_vpad, bool check_bottom_vpad, int rows_for_rd_tail,
         bool skip_accumulation) {
@@ -1651,9 +1840,15 @@ void jit_brgemm_kernel_t::ldb_loop(int bd_block2, bool is_bdb_tail,
             if (brg.req_s8s8_compensation) {
                 mov(ptr[rsp + reg_bdb_loop_offs_], reg_bdb_loop);
                 mov(reg_s8_input_shift, 128);
-                vpbroadcastb(zmm_inp_shift(), reg_s8_input_shift.cvt8());
+                if (is_ymm) {
+                    const Xbyak::Xmm xmm_inp_shift(vmm_inp_shift().getIdx());
+                    vmovd(xmm_inp_shift, reg_s8_input_shift.cvt32());
+                    vpbroadcastb(vmm_inp_shift(), xmm_inp_shift);
+                } else
+                    vpbroadcastb(vmm_inp_shift(), reg_s8_input_shift.cvt8());
                 mov(reg_bdb_loop, ptr[rsp + reg_bdb_loop_offs_]);
             }
+            if (is_ymm && is_ld_tail) load_ld_tail_mask();
 
             if (brg.brgattr.max_bs > 1) mov(reg_BS_loop, reg_BS);
             L_aligned(BS_loop_label, 64);
@@ -1742,7 +1937,8 @@ void jit_brgemm_kernel_t::ldb_loop(int bd_block2, bool is_bdb_tail,
     }
 }
 
-void jit_brgemm_kernel_t::bdb_loop() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::bdb_loop() {
     auto do_ldb_loop = [=](int bd_block2, bool is_bdb_tail, bool check_top_vpad,
                                bool check_bottom_vpad, int rows_for_rd_tail,
                                bool skip_accumulation) {
@@ -1806,8 +2002,14 @@ void jit_brgemm_kernel_t::bdb_loop() {
         auto ld_block2 = (brg.ldb2 > 0)
                 ? brg.ld_block2
                 : ((brg.ldb2_tail > 0) ? brg.ldb2_tail : 1);
+        // Ymm kernel keeps the s8s8 input shift and the load dimension tail
+        // mask in the low registers.
+        const int n_reserved_vregs = is_ymm
+                ? brg.req_s8s8_compensation + (brg.ldb_tail != 0)
+                : 0;
         n_bcast_1_load = brg.is_int8
-                && ((brg.bd_block * (ld_block2 + 1) < 32)
+                && ((brg.bd_block * (ld_block2 + 1)
+                            < max_vregs - n_reserved_vregs)
                         && (bd_blocks_for_rd_tail == 0)
                         && (rows_for_rd_tail == 0));
         // loop order may be specified in brgemm attributes
@@ -1951,7 +2153,8 @@ void jit_brgemm_kernel_t::bdb_loop() {
         bdb_loop_general(false);
 }
 
-void jit_brgemm_kernel_t::generate() {
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::generate() {
     preamble();
 
     sub(rsp, stack_space_needed_);
@@ -1966,10 +2169,12 @@ void jit_brgemm_kernel_t::generate() {
 
     reg64_t reg_mask = rax;
 
-    mov(reg_mask, full_mask);
-    kmovq(ld_full_mask, reg_mask);
-    mov(reg_mask, tail_mask);
-    kmovq(ld_tail_mask, reg_mask);
+    if (!is_ymm) {
+        mov(reg_mask, full_mask);
+        kmovq(ld_full_mask, reg_mask);
+        mov(reg_mask, tail_mask);
+        kmovq(ld_tail_mask, reg_mask);
+    }
 
     read_params();
 
@@ -1980,6 +2185,16 @@ void jit_brgemm_kernel_t::generate() {
     postamble();
 
     if (brg.with_eltwise) postops_injector_->prepare_table();
+
+    if (is_ymm && brg.ldb_tail > 0) {
+        const int simd_w = 8;
+        align(32);
+        L(ld_tail_mask_table_);
+        for (int i = 0; i < simd_w; i++)
+            dd(0xffffffff);
+        for (int i = 0; i < simd_w; i++)
+            dd(0);
+    }
 }
 
 brgemm_attr_t::brgemm_attr_t()
@@ -2000,7 +2215,10 @@ brgemm_attr_t::brgemm_attr_t()
     , use_interleave_stores(false) {}
 
 brgemm_kernel_common_t::brgemm_kernel_common_t(const brgemm_t abrd) {
-    brgemm_kernel_ = new jit_brgemm_kernel_t(abrd);
+    if (utils::one_of(abrd.isa_impl, avx2, avx2_vnni))
+        brgemm_kernel_ = new jit_brgemm_kernel_t<Xbyak::Ymm>(abrd);
+    else
+        brgemm_kernel_ = new jit_brgemm_kernel_t<Xbyak::Zmm>(abrd);
 }
 
 status_t brgemm_kernel_common_t::create_kernel() {
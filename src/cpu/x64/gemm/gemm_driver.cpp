@@ -69,6 +69,52 @@ struct alignas(64) gemm_per_thread_t {
     gemm_slice_t slice;
 };
 
+// The batch scope of the calling thread.
+struct batch_thread_state_t {
+    int scopes = 0;
+    char *buffer = nullptr;
+    size_t buffer_size = 0;
+};
+
+static batch_thread_state_t &batch_thread_state() {
+    static thread_local batch_thread_state_t state;
+    return state;
+}
+
+static bool in_batch_scope() {
+    return batch_thread_state().scopes > 0;
+}
+
+gemm_batch_thread_scope_t::gemm_batch_thread_scope_t() {
+    batch_thread_state().scopes++;
+}
+
+gemm_batch_thread_scope_t::~gemm_batch_thread_scope_t() {
+    auto &state = batch_thread_state();
+    if (--state.scopes > 0) return;
+    free(state.buffer);
+    state.buffer = nullptr;
+    state.buffer_size = 0;
+}
+
+// Returns a buffer of `size` bytes for the kernel driver. In a batch scope
+// the buffer is kept by the thread and only grows.
+static char *get_kernel_buffer(size_t size) {
+    if (!in_batch_scope()) return (char *)malloc(size, 128);
+
+    auto &state = batch_thread_state();
+    if (size > state.buffer_size) {
+        free(state.buffer);
+        state.buffer = (char *)malloc(size, 128);
+        state.buffer_size = state.buffer ? size : 0;
+    }
+    return state.buffer;
+}
+
+static void release_kernel_buffer(char *mem) {
+    if (!in_batch_scope()) free(mem);
+}
+
 template <typename T>
 int get_vector_length() {
     int v_bytes;
@@ -611,7 +657,7 @@ static dnnl_status_t gemm_kernel_driver(int ithr, dim_t m, dim_t n, dim_t k,
     char *mem = nullptr;
 
     if (mem_size > 0) {
-        mem = (char *)malloc(mem_size, 128);
+        mem = get_kernel_buffer(mem_size);
         if (!mem) return dnnl_out_of_memory;
     }
 
@@ -776,7 +822,7 @@ static dnnl_status_t gemm_kernel_driver(int ithr, dim_t m, dim_t n, dim_t k,
         }
     }
 
-    free(mem);
+    release_kernel_buffer(mem);
 
     return dnnl_success;
 }
@@ -1693,7 +1739,8 @@ static dnnl_status_t gemm_threading_driver(
     if (is_b_packed && arg->ao != 0)
         if (!arg->b_packed->has_col_sums()) return dnnl_invalid_arguments;
 
-    auto nthr_max = dnnl_get_current_num_threads();
+    // The problems of a batch are computed by a single thread each.
+    auto nthr_max = in_batch_scope() ? 1 : dnnl_get_current_num_threads();
     int nthr_goal = nthr_max;
 
     adjust_thread_count<c_type>(arg->m, arg->n, arg->k, &nthr_goal);
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2020 Intel Corporation
+* Copyright 2018-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/c_types_map.hpp"
+#include "common/utils.hpp"
 
 #include "cpu/x64/gemm/gemm_info.hpp"
 #include "cpu/x64/gemm/gemm_pack_storage.hpp"
@@ -38,6 +39,17 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
         const bool force_jit_nocopy_gemm, pack_type packing = pack_type::none,
         gemm_pack_storage_t *pack_dst = NULL, bool measure_only = false);
 
+// Marks the calling thread as computing a part of a batch of problems for the
+// lifetime of the object: the problems are computed by the calling thread
+// only, and their packing buffers are kept from one problem to the next
+// instead of being allocated for every problem.
+struct gemm_batch_thread_scope_t {
+    gemm_batch_thread_scope_t();
+    ~gemm_batch_thread_scope_t();
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gemm_batch_thread_scope_t);
+};
+
 void prep_ref_gemm_s8u8s32_pack(
         bool do_a, dim_t rows, dim_t cols, gemm_pack_storage_t *pack_dst);
 
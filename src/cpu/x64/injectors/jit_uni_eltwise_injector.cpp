@@ -1082,7 +1082,7 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::pow_compute_vector_fwd(
         h->uni_vmovups(h->ptr[h->rsp + 1 * vlen], vmm_src); // beta
 
         // save function address in gpr to pass in in call instruction
-        h->mov(h->rbp, reinterpret_cast<uintptr_t>(powf));
+        h->mov_host_addr(h->rbp, reinterpret_cast<uintptr_t>(powf));
 
         // The 64-bit Windows ABI requires the caller to allocate 32 bytes of
         // a so called "shadow space" for the callee.  It also requires that
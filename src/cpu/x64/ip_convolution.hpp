@@ -26,6 +26,7 @@
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/cpu_inner_product_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -115,10 +116,13 @@ status_t set_and_or_check_formats(const convolution_desc_t &desc,
     // Currently this means:
     // - int8 with any forward prop_kind on any isa
     // - fp32/bf16 with any prop_kind on avx512_core and higher
+    // - f16 forward with f16 compute support
     const bool is_set_allowed = false
             || (utils::one_of(
                         weights_md.data_type, data_type::f32, data_type::bf16)
                     && mayiuse(avx512_core))
+            || (is_fwd && weights_md.data_type == data_type::f16
+                    && platform::has_f16_compute_support())
             || (is_fwd && weights_md.data_type == data_type::s8);
 
     // NOTE: Only plain layouts should be supported since the dims of
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/x64/jit_avx2_f16cvt.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+void jit_avx2_cvt_f16_t::generate() {
+    const Reg64 reg_out = abi_param1;
+    const Reg64 reg_inp = abi_param2;
+    const Reg64 reg_nelems = abi_param3;
+
+    const int inp_size = to_f32_ ? sizeof(float16_t) : sizeof(float);
+    const int out_size = to_f32_ ? sizeof(float) : sizeof(float16_t);
+    // Round to the nearest even whatever the rounding mode of MXCSR is.
+    const uint8_t rne = 0;
+
+    auto cvt = [&](int unroll) {
+        for (int i = 0; i < unroll; i++) {
+            const Ymm vmm(i);
+            const auto inp = ptr[reg_inp + i * simd_w * inp_size];
+            const auto out = ptr[reg_out + i * simd_w * out_size];
+            if (to_f32_) {
+                vcvtph2ps(vmm, inp);
+                vmovups(out, vmm);
+            } else {
+                vmovups(vmm, inp);
+                vcvtps2ph(out, vmm, rne);
+            }
+        }
+        add(reg_inp, unroll * simd_w * inp_size);
+        add(reg_out, unroll * simd_w * out_size);
+        sub(reg_nelems, unroll * simd_w);
+    };
+
+    constexpr int unroll = 4;
+    Label l_unroll_loop, l_simd_loop, l_exit;
+
+    L(l_unroll_loop);
+    {
+        cmp(reg_nelems, unroll * simd_w);
+        jl(l_simd_loop, T_NEAR);
+        cvt(unroll);
+        jmp(l_unroll_loop, T_NEAR);
+    }
+
+    L(l_simd_loop);
+    {
+        cmp(reg_nelems, simd_w);
+        jl(l_exit, T_NEAR);
+        cvt(1);
+        jmp(l_simd_loop, T_NEAR);
+    }
+
+    L(l_exit);
+    vzeroupper();
+    ret();
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX2_F16CVT_HPP
+#define CPU_X64_JIT_AVX2_F16CVT_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/float16.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Converts arrays between f16 and f32 with the F16C instructions. The number
+// of elements passed to the kernel must be a multiple of `simd_w`.
+struct jit_avx2_cvt_f16_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_cvt_f16_t)
+
+    static constexpr int simd_w = 8;
+
+    // Converts from f16 to f32 if `to_f32` is true, from f32 to f16
+    // otherwise. The conversion to f16 rounds to the nearest even.
+    jit_avx2_cvt_f16_t(bool to_f32)
+        : jit_generator(jit_name()), to_f32_(to_f32) {
+        create_kernel();
+    }
+
+    void generate() override;
+
+    void operator()(float *out, const float16_t *inp, size_t nelems) const {
+        assert(to_f32_ && nelems % simd_w == 0);
+        jit_generator::operator()(out, inp, nelems);
+        msan_unpoison(out, nelems * sizeof(float));
+    }
+
+    void operator()(float16_t *out, const float *inp, size_t nelems) const {
+        assert(!to_f32_ && nelems % simd_w == 0);
+        jit_generator::operator()(out, inp, nelems);
+        msan_unpoison(out, nelems * sizeof(float16_t));
+    }
+
+    static bool is_supported() {
+        return mayiuse(avx2) && cpu().has(Xbyak::util::Cpu::tF16C);
+    }
+
+private:
+    bool to_f32_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -118,7 +118,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
         brgattr.use_interleave_stores = brgattr.use_uker;
         brgattr.hint_prefetching = jcp_.hint_prefetching;
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
-        auto LDD = jcp_.oc_without_padding;
+        auto LDD = jcp_.dst_w_stride;
         brg.with_sum = with_sum;
         CHECK(brgemm_desc_set_postops(
                 &brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
@@ -163,7 +163,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
     src_w_sz = (dim_t)IW * jcp.ngroups * jcp.ic_without_padding;
     src_h_sz = IH * src_w_sz;
     src_d_sz = ID * src_h_sz;
-    dst_w_sz = (dim_t)OW * jcp.oc_without_padding;
+    dst_w_sz = (dim_t)OW * jcp.dst_w_stride;
     dst_h_sz = OH * dst_w_sz;
     dst_d_sz = OD * dst_h_sz;
 
@@ -365,7 +365,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
     const auto ptr_D = dst
             + dst_dt_size
                     * (n * dst_d_sz + od * dst_h_sz + oh * dst_w_sz
-                            + ow * jcp.oc_without_padding + g_oc);
+                            + ow * jcp.dst_w_stride + g_oc);
     char *const ptr_C = (jcp.use_buffer) ? c_buffer : (char *)ptr_D;
 
     const auto bias_w
@@ -602,6 +602,8 @@ template struct brgemm_1x1_convolution_fwd_t<avx512_core_vnni>;
 template struct brgemm_1x1_convolution_fwd_t<avx512_core_bf16>;
 template struct brgemm_1x1_convolution_fwd_t<avx512_core_bf16_amx_int8>;
 template struct brgemm_1x1_convolution_fwd_t<avx512_core_bf16_amx_bf16>;
+template struct brgemm_1x1_convolution_fwd_t<avx2_vnni>;
+template struct brgemm_1x1_convolution_fwd_t<avx2>;
 
 } // namespace x64
 } // namespace cpu
@@ -86,6 +86,13 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 protected:
     status_t init(engine_t *engine) override;
 
+    size_t get_resident_size() const override {
+        // The kernel descriptors and the AMX palettes are kept alongside the
+        // generated code.
+        return sizeof(*this) + sizeof(*pd()) + host_binaries_.code_size()
+                + brg_kernel_palette_.size() * sizeof(amx_palette_t);
+    }
+
 private:
     //  brgemm convolution execution context
     struct brgemm_exec_ctx_t {
@@ -93,7 +100,9 @@ private:
             : src(CTX_IN_MEM(const char *, DNNL_ARG_SRC))
             , weights(CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS))
             , bias(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
-            , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST))
+            , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST)
+                      + pd->jcp_.dst_dsz
+                              * memory_desc_wrapper(pd->dst_md()).offset0())
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
                       pd->attr()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
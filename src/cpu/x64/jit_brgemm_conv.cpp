@@ -258,7 +258,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
                 }
                 CHECK(brgemm_desc_set_attr(brg, brgattr));
 
-                auto LDD = jcp_.oc_without_padding;
+                auto LDD = jcp_.dst_w_stride;
                 brg->with_sum = with_sum;
                 CHECK(brgemm_desc_set_postops(
                         brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
@@ -518,7 +518,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::init(engine_t *engine) {
     src_w_sz = static_cast<dim_t>(IW) * jcp.ngroups * jcp.ic_without_padding;
     src_h_sz = IH * src_w_sz;
     src_d_sz = ID * src_h_sz;
-    dst_w_sz = static_cast<dim_t>(OW) * jcp.oc_without_padding;
+    dst_w_sz = static_cast<dim_t>(OW) * jcp.dst_w_stride;
     dst_h_sz = OH * dst_w_sz;
     dst_d_sz = OD * dst_h_sz;
 
@@ -784,6 +784,24 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::init(engine_t *engine) {
 
     return status::success;
 }
+
+template <cpu_isa_t isa, bool use_inversion>
+size_t brgemm_convolution_fwd_t<isa, use_inversion>::get_resident_size()
+        const {
+    const auto _pd = pd();
+    size_t size = sizeof(*this) + sizeof(*_pd) + host_binaries_.code_size();
+    // The kernel descriptors and the precomputed tables.
+    for (const auto &brg : _pd->brgs_)
+        if (brg) size += sizeof(brgemm_t);
+    for (const auto &mask : _pd->bd_masks)
+        if (mask) size += mask->size();
+    size += brg_kernel_palettes_.size() * sizeof(S_t);
+    for (const auto *v : {&owb_kw_top_vpads, &owb_kw_bottom_vpads, &kd_bs,
+                 &kd_es, &kh_bs, &kh_es})
+        size += v->size() * sizeof(dim_t);
+    return size;
+}
+
 template <cpu_isa_t isa, bool use_inversion>
 status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
         const exec_ctx_t &ctx) const {
@@ -1105,7 +1123,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
             p.ptr_out = dst_base
                     + dst_dsz
                             * (od * dst_h_sz + oh * dst_w_sz
-                                    + ow_pw_s * jcp.oc_without_padding);
+                                    + ow_pw_s * jcp.dst_w_stride);
             p.ptr_in = static_cast<void *>(jcp.use_buffer
                             ? (c_buffer + acc_dsz * (ow_pw_s - ow) * jcp.LDC)
                             : p.ptr_out);
@@ -1116,7 +1134,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::perform_outwork(
                     : dst_base
                             + dst_dsz
                                     * (od * dst_h_sz + oh * dst_w_sz
-                                            + ow_pw_s * jcp.oc_without_padding);
+                                            + ow_pw_s * jcp.dst_w_stride);
             p.ptr_out = static_cast<void *>(ptr_Cz);
         }
         (*outwork_ker)(&p);
@@ -1446,7 +1464,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_base(
         ptr_D = dst_base
                 + dst_dsz
                         * (btc.od * dst_h_sz + btc.oh * dst_w_sz
-                                + ow_b * jcp.oc_without_padding);
+                                + ow_b * jcp.dst_w_stride);
         ptr_C = (jcp.use_buffer)
                 ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
                 : static_cast<char *>(ptr_D);
@@ -1581,7 +1599,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_trans(
     ptr_D = dst_base
             + dst_dsz
                     * (btc.od * dst_h_sz + btc.oh * dst_w_sz
-                            + ow_b * jcp.oc_without_padding);
+                            + ow_b * jcp.dst_w_stride);
     ptr_C = (jcp.use_buffer) ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
                              : static_cast<char *>(ptr_D);
 
@@ -1735,7 +1753,7 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_vpad(
     ptr_D = dst_base
             + dst_dsz
                     * (btc.od * dst_h_sz + btc.oh * dst_w_sz
-                            + ow_b * jcp.oc_without_padding);
+                            + ow_b * jcp.dst_w_stride);
     ptr_C = (jcp.use_buffer) ? btc.c_buffer + acc_dsz * (ow_b - ow) * jcp.LDC
                              : static_cast<char *>(ptr_D);
 
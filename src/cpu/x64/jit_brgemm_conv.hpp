@@ -116,6 +116,8 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    size_t get_resident_size() const override;
+
 protected:
     status_t init(engine_t *engine) override;
 
@@ -130,7 +132,9 @@ private:
             : src(CTX_IN_MEM(const char *, DNNL_ARG_SRC))
             , weights(CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS))
             , bias(CTX_IN_MEM(const char *, DNNL_ARG_BIAS))
-            , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST))
+            , dst(CTX_OUT_MEM(char *, DNNL_ARG_DST)
+                      + pd->jcp_.dst_dsz
+                              * memory_desc_wrapper(pd->dst_md()).offset0())
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
                       pd->attr()->post_ops_, ctx)) {}
         const char *const __restrict src;
@@ -37,6 +37,7 @@ struct jit_brgemm_conv_comp_pad_call_s {
 
 struct jit_avx512_core_brgemm_conv_comp_pad_kernel_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_brgemm_conv_comp_pad_kernel_t)
+    bool is_relocatable() const override { return true; }
 
     using reg64_t = const Xbyak::Reg64;
 
@@ -38,6 +38,7 @@ struct jit_brgemm_conv_trans_kernel_call_s {
 
 struct jit_avx512_core_brgemm_conv_trans_kernel_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_brgemm_conv_trans_kernel_t)
+    bool is_relocatable() const override { return true; }
 
     using reg64_t = const Xbyak::Reg64;
 
@@ -96,6 +97,7 @@ protected:
 struct jit_avx512_core_brgemm_conv_rtus_kernel_t
     : jit_avx512_core_brgemm_conv_trans_kernel_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_brgemm_conv_rtus_kernel_t)
+    bool is_relocatable() const override { return true; }
 
     jit_avx512_core_brgemm_conv_rtus_kernel_t(
             const jit_brgemm_conv_conf_t &ajcp);
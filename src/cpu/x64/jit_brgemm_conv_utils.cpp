@@ -64,6 +64,31 @@ inline status_t init_tag(format_tag_t &tag, memory_desc_t &md,
     return status::success;
 }
 
+// Returns the stride of the width of a channels-last tensor, which exceeds the
+// number of channels if the tensor is a channel slice of a larger
+// channels-last tensor (e.g. the image of a source in the destination of a
+// concat), or 0 if the tensor is not channels-last.
+dim_t get_channels_last_w_stride(const memory_desc_wrapper &mdw) {
+    if (!mdw.is_blocking_desc() || mdw.blocking_desc().inner_nblks != 0)
+        return 0;
+
+    const int ndims = mdw.ndims();
+    const auto &strides = mdw.blocking_desc().strides;
+    const auto &pdims = mdw.padded_dims();
+    if (ndims < 3 || strides[1] != 1 || strides[ndims - 1] < pdims[1])
+        return 0;
+
+    dim_t stride = strides[ndims - 1];
+    for (int d = ndims - 2; d >= 2; --d) {
+        stride *= pdims[d + 1];
+        if (strides[d] != stride) return 0;
+    }
+    stride *= pdims[2];
+    if (pdims[0] > 1 && strides[0] != stride) return 0;
+
+    return strides[ndims - 1];
+}
+
 bool is_amx(cpu_isa_t isa) {
     return one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
 }
@@ -74,7 +99,8 @@ bool post_ops_ok(jit_brgemm_conv_conf_t &jcp, primitive_attr_t &attr,
 
     const auto &post_ops = attr.post_ops_;
 
-    return injector::post_ops_ok(post_ops_ok_args_t(get_max_cpu_isa(),
+    return injector::post_ops_ok(post_ops_ok_args_t(
+            is_superset(jcp.isa, avx512_core) ? get_max_cpu_isa() : avx2,
             {sum, eltwise, binary}, post_ops, &dst_d,
             false /*sum_at_pos_0_only*/, false /*sum_requires_scale_one*/,
             false /*sum_requires_zp_zero*/,
@@ -337,7 +363,10 @@ status_t pick_tags(jit_brgemm_conv_conf_t &jcp, memory_desc_t &src_md,
     const bool any_eligible = (jcp.prop_kind == prop_kind::forward_inference
             || jcp.wei_dt == data_type::s8 || is_amx(jcp.isa));
     CHECK(init_tag(jcp.src_tag, src_md, src_d, src_tag, any_eligible));
-    CHECK(init_tag(jcp.dst_tag, dst_md, dst_d, dst_tag, any_eligible));
+    if (jcp.dst_w_stride > jcp.oc_without_padding)
+        jcp.dst_tag = dst_tag;
+    else
+        CHECK(init_tag(jcp.dst_tag, dst_md, dst_d, dst_tag, any_eligible));
     CHECK(init_tag(jcp.wei_tag, weights_md, weights_d, wei_tag, true));
 
     return status::success;
@@ -578,7 +607,7 @@ status_t brg_blocking_t::estimate_brgemm_ur() {
                     * (exec_type == exec_trans ? ic_block
                                                : ngroups * ic_without_padding);
     LDB = oc_block;
-    LDC = use_buffer ? oc_block : oc_without_padding;
+    LDC = use_buffer ? oc_block : dst_w_stride;
 
     // Configure matrix sizes
     // for amx if ic_block != ic then we use exec_trans so K is ic_block
@@ -648,7 +677,7 @@ status_t brg_blocking_t::get_brgemm_ur(
         return status::invalid_arguments;
     CHECK(estimate_brgemm_ur());
 
-    LDD = oc_without_padding;
+    LDD = dst_w_stride;
 
     const float alpha = 1.0;
     const float beta = 1.0;
@@ -1576,7 +1605,8 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     brg_blocking_t::L2 = platform::get_per_core_cache_size(2);
     brg_blocking_t::L3 = platform::get_per_core_cache_size(2);
 
-    if (!mayiuse(avx512_core)) return status::unimplemented;
+    const bool is_avx2 = one_of(isa, avx2, avx2_vnni);
+    if (!mayiuse(is_avx2 ? isa : avx512_core)) return status::unimplemented;
 
     const memory_desc_wrapper src_d(&src_md);
     const memory_desc_wrapper weights_d(&weights_md);
@@ -1594,6 +1624,9 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.mb = src_d.dims()[0];
     jcp.oc_without_padding = dst_d.dims()[1];
     jcp.oc = jcp.oc_without_padding / jcp.ngroups;
+    const dim_t dst_w_stride = get_channels_last_w_stride(dst_d);
+    jcp.dst_w_stride
+            = dst_w_stride > 0 ? dst_w_stride : jcp.oc_without_padding;
     jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
     jcp.ic = jcp.ic_without_padding;
     jcp.id = (ndims == 5) ? src_d.dims()[2] : 1;
@@ -1664,9 +1697,10 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     jcp.s8s8_avx512 = jcp.src_dt == s8 && !is_amx(jcp.isa);
 
-    if (!IMPLICATION(jcp.wei_dt == s8, mayiuse(avx512_core_vnni)))
+    if (!IMPLICATION(jcp.wei_dt == s8,
+                is_avx2 ? isa == avx2_vnni : mayiuse(avx512_core_vnni)))
         return status::unimplemented;
-    if (!IMPLICATION(jcp.wei_dt == bf16, mayiuse(avx512_core_bf16)))
+    if (!IMPLICATION(jcp.wei_dt == bf16, !is_avx2 && mayiuse(avx512_core_bf16)))
         return status::unimplemented;
 
     if (one_of(jcp.src_dt, u8, s8)) {
@@ -2108,6 +2142,10 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     }
     best_brgb.save_to_jcp(jcp);
 
+    // The input transformation (rtus) kernel is implemented for Zmm only
+    if (one_of(isa, avx2, avx2_vnni) && jcp.is_rtus)
+        return status::unimplemented;
+
     // =============== end blocking =================================
     jcp.brg_stride_a = jcp.ic_block * jcp.src_dsz;
     jcp.brg_stride_b = jcp.ic_block * jcp.oc * jcp.wei_dsz;
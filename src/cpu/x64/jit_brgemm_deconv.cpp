@@ -0,0 +1,364 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_brgemm_deconv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const data_type_t dt = isa == avx512_core_bf16 ? bf16 : f32;
+    const data_type_t dst_dt = dst_md_.data_type;
+
+    bool ok = is_fwd() && mayiuse(isa)
+            && desc()->alg_kind == alg_kind::deconvolution_direct
+            && !with_groups() && src_md_.data_type == dt
+            && weights_md_.data_type == dt
+            && (dt == bf16 ? one_of(dst_dt, f32, bf16) : dst_dt == f32)
+            && IMPLICATION(with_bias(),
+                    dt == bf16 ? one_of(bias_md_.data_type, f32, bf16)
+                               : bias_md_.data_type == f32)
+            // The reduction over the input channels is done by pairs in
+            // bf16.
+            && IMPLICATION(dt == bf16, IC() % 2 == 0)
+            && attr()->has_default_values(skip_mask_t::post_ops, dst_dt)
+            && attr()->post_ops_.check_sum_consistent_dt(dst_dt)
+            && set_default_formats() && post_ops_ok()
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    init_w_phases();
+
+    nthr_ = dnnl_get_max_threads();
+    need_postops_ = with_bias() || attr()->post_ops_.len() > 0
+            || dst_dt != f32;
+
+    // The chunks of a phase are as long as the widest range of pixels with
+    // all the taps in the source, up to the number of rows a brgemm kernel
+    // keeps in registers several times.
+    dim_t max_len = 1;
+    for (const auto &ph : w_phases_)
+        max_len = nstl::max(max_len, ph.jhi - ph.jlo);
+    m_blk_ = nstl::min<dim_t>(max_len, 64);
+
+    // Only the kernels for the sizes of the chunks met in the phases are
+    // generated: full chunks, their tails and the pixels at the borders.
+    m_idx_.assign(m_blk_ + 1, -1);
+    m_idx_[1] = 0;
+    for (const auto &ph : w_phases_) {
+        const dim_t len = ph.jhi - ph.jlo;
+        if (len >= m_blk_) m_idx_[m_blk_] = 0;
+        if (len % m_blk_ > 0) m_idx_[len % m_blk_] = 0;
+    }
+    int n_ms = 0;
+    for (auto &idx : m_idx_)
+        if (idx == 0) idx = n_ms++;
+
+    n_blk_ = nstl::min<dim_t>(OC(), 64);
+    nb_oc_ = div_up(OC(), n_blk_);
+
+    dim_t max_kw = 0;
+    for (const auto &ph : w_phases_)
+        max_kw = nstl::max<dim_t>(max_kw, ph.kw.size());
+    max_bs_ = (int)nstl::max<dim_t>(1, KD() * KH() * max_kw);
+
+    // The destination pixels of a chunk are SW * OC apart. The f32
+    // destination is accumulated in place, a bf16 one in a buffer of a
+    // thread.
+    const dim_t LDD = KSW() * OC();
+    const dim_t LDC = dst_dt == f32 ? LDD : n_blk_;
+    const data_type_t bia_dt = with_bias() ? bias_md_.data_type : undef;
+
+    brgs_.resize(n_ms * 2);
+    for_(dim_t m = 1; m <= m_blk_; m++)
+    for (int i_n = 0; i_n < 2; i_n++) {
+        if (m_idx_[m] < 0) continue;
+        const dim_t N = i_n ? OC() % n_blk_ : n_blk_;
+        if (N == 0) continue;
+        brgemm_t &brg = brgs_[brg_idx(m, N)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, dt, dt, false, false,
+                brgemm_row_major, 1.f, 0.f, IC(), OC(), LDC, m, N, IC()));
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = max_bs_;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md_, LDD, bia_dt));
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_deconvolution_fwd_t<isa>::pd_t::set_default_formats() {
+    using namespace format_tag;
+    const int nd = ndims();
+    const format_tag_t dat_tag = pick(nd - 3, nwc, nhwc, ndhwc);
+    // The weights of a tap form an IC x OC matrix, with pairs of input
+    // channels interleaved in bf16.
+    const format_tag_t wei_tag = isa == avx512_core_bf16
+            ? pick(nd - 3, wIo2i, hwIo2i, dhwIo2i)
+            : pick(nd - 3, wio, hwio, dhwio);
+
+    auto set_or_check = [](memory_desc_t &md, format_tag_t tag) {
+        if (md.format_kind == format_kind::any)
+            return memory_desc_init_by_tag(md, tag) == status::success;
+        return memory_desc_matches_tag(md, tag);
+    };
+
+    return set_or_check(src_md_, dat_tag) && set_or_check(dst_md_, dat_tag)
+            && set_or_check(weights_md_, wei_tag)
+            && IMPLICATION(with_bias(), set_or_check(bias_md_, x));
+}
+
+template <cpu_isa_t isa>
+bool brgemm_deconvolution_fwd_t<isa>::pd_t::post_ops_ok() const {
+    using namespace injector;
+    const memory_desc_wrapper dst_d(&dst_md_);
+    return injector::post_ops_ok(post_ops_ok_args_t(
+            isa == avx2 ? avx2 : get_max_cpu_isa(), {sum, eltwise, binary},
+            attr()->post_ops_, &dst_d, false /*sum_at_pos_0_only*/,
+            false /*sum_requires_scale_one*/, false /*sum_requires_zp_zero*/,
+            {broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::scalar}));
+}
+
+template <cpu_isa_t isa>
+void brgemm_deconvolution_fwd_t<isa>::pd_t::init_w_phases() {
+    const dim_t SW = KSW(), DW = KDW() + 1;
+    w_phases_.assign(SW, w_phase_t());
+    for (dim_t r = 0; r < SW; r++) {
+        w_phase_t &ph = w_phases_[r];
+        ph.nj = OW() > r ? div_up(OW() - r, SW) : 0;
+        // The source pixel of the tap kw for ow = r + SW * j is
+        // iw = (ow + padL - kw * DW) / SW = j + iw_off.
+        dim_t jlo = 0, jhi = ph.nj;
+        for (dim_t kw = 0; kw < KW(); kw++) {
+            const dim_t s = r + padL() - kw * DW;
+            if (s % SW != 0) continue;
+            const dim_t iw_off = s / SW;
+            ph.kw.push_back(kw);
+            ph.iw_off.push_back(iw_off);
+            jlo = nstl::max(jlo, -iw_off);
+            jhi = nstl::min(jhi, IW() - iw_off);
+        }
+        ph.jlo = nstl::min(jlo, ph.nj);
+        ph.jhi = nstl::max(jhi, ph.jlo);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_deconvolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, (size_t)nthr_ * max_bs_);
+    if (dst_md_.data_type != data_type::f32)
+        scratchpad.template book<float>(
+                key_brgemm_primitive_buffer, nthr_ * m_blk_ * n_blk_);
+    // Zero source rows for the output pixels without any tap in the source.
+    scratchpad.template book<char>(key_brgemm_primitive_buffer_a,
+            m_blk_ * IC() * types::data_type_size(src_md_.data_type));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::init(engine_t *engine) {
+    const auto *pd = this->pd();
+    brg_kernels_.resize(pd->brgs_.size());
+    for_(dim_t m = 1; m <= pd->m_blk_; m++)
+    for (int i_n = 0; i_n < 2; i_n++) {
+        if (pd->m_idx_[m] < 0) continue;
+        const dim_t N = i_n ? pd->OC() % pd->n_blk_ : pd->n_blk_;
+        if (N == 0) continue;
+        const int idx = pd->brg_idx(m, N);
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd->brgs_[idx]));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t MB = pd()->MB(), IC = pd()->IC(), OC = pd()->OC();
+    const dim_t ID = pd()->ID(), IH = pd()->IH(), IW = pd()->IW();
+    const dim_t OD = pd()->OD(), OH = pd()->OH(), OW = pd()->OW();
+    const dim_t KD = pd()->KD(), KH = pd()->KH(), KW = pd()->KW();
+    const dim_t SD = pd()->KSD(), SH = pd()->KSH(), SW = pd()->KSW();
+    const dim_t DD = pd()->KDD() + 1, DH = pd()->KDH() + 1;
+    const dim_t padFront = pd()->padFront(), padT = pd()->padT();
+
+    const size_t src_dsz = src_d.data_type_size();
+    const size_t dst_dsz = dst_d.data_type_size();
+    const size_t wei_dsz = types::data_type_size(pd()->weights_md()->data_type);
+    const size_t bia_dsz = pd()->with_bias()
+            ? types::data_type_size(pd()->weights_md(1)->data_type)
+            : 0;
+    // Output channels are interleaved by pairs of input channels in bf16.
+    const dim_t oc_vnni = isa == avx512_core_bf16 ? 2 : 1;
+
+    const dim_t m_blk = pd()->m_blk_, n_blk = pd()->n_blk_;
+    const dim_t nb_oc = pd()->nb_oc_;
+    const int max_bs = pd()->max_bs_;
+    const bool need_postops = pd()->need_postops_;
+    const bool use_buffer = dst_d.data_type() != data_type::f32;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto c_buffer_base
+            = scratchpad.template get<float>(key_brgemm_primitive_buffer);
+    auto zero_src
+            = scratchpad.template get<char>(key_brgemm_primitive_buffer_a);
+    std::memset(zero_src, 0, m_blk * IC * src_dsz);
+
+    // Pixels of the source and the destination are dense rows of channels.
+    const dim_t src_row_size = IW * IC, dst_row_size = OW * OC;
+
+    const dim_t work_amount = MB * OD * OH * SW * nb_oc;
+    parallel(pd()->nthr_, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * max_bs;
+        float *c_buffer = use_buffer ? c_buffer_base + ithr * m_blk * n_blk
+                                     : nullptr;
+        // The source rows and the first weights of the valid (kd, kh) taps
+        // of the current output row.
+        std::vector<const char *> dh_src(KD * KH);
+        std::vector<const char *> dh_wei(KD * KH);
+
+        dim_t n {0}, od {0}, oh {0}, r {0}, ocb {0};
+        nd_iterator_init(start, n, MB, od, OD, oh, OH, r, SW, ocb, nb_oc);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const auto &ph = pd()->w_phases_[r];
+            const dim_t oc = ocb * n_blk;
+            const dim_t N = nstl::min(n_blk, OC - oc);
+
+            int n_dh = 0;
+            for_(dim_t kd = 0; kd < KD; kd++)
+            for (dim_t kh = 0; kh < KH; kh++) {
+                const dim_t sd = od + padFront - kd * DD;
+                const dim_t sh = oh + padT - kh * DH;
+                if (sd % SD != 0 || sh % SH != 0) continue;
+                const dim_t id = sd / SD, ih = sh / SH;
+                if (id < 0 || id >= ID || ih < 0 || ih >= IH) continue;
+                dh_src[n_dh] = src
+                        + (((n * ID + id) * IH + ih) * src_row_size)
+                                * src_dsz;
+                dh_wei[n_dh] = weights
+                        + (((kd * KH + kh) * KW) * IC * OC + oc * oc_vnni)
+                                * wei_dsz;
+                n_dh++;
+            }
+
+            char *dst_row = dst
+                    + ((((n * OD + od) * OH + oh) * dst_row_size) + r * OC
+                              + oc)
+                            * dst_dsz;
+
+            // Computes the pixels [j, j + m) of the phase with the taps in
+            // the source, or with a zero source if there is none.
+            auto compute = [&](dim_t j, dim_t m) {
+                int bs = 0;
+                for (int t = 0; t < n_dh; t++)
+                    for (size_t k = 0; k < ph.kw.size(); k++) {
+                        const dim_t iw = j + ph.iw_off[k];
+                        if (iw < 0 || iw + m > IW) continue;
+                        batch[bs].ptr.A = dh_src[t] + iw * IC * src_dsz;
+                        batch[bs].ptr.B
+                                = dh_wei[t] + ph.kw[k] * IC * OC * wei_dsz;
+                        bs++;
+                    }
+                if (bs == 0) {
+                    batch[0].ptr.A = zero_src;
+                    batch[0].ptr.B = weights + oc * oc_vnni * wei_dsz;
+                    bs = 1;
+                }
+
+                const brgemm_kernel_t *ker
+                        = brg_kernels_[pd()->brg_idx(m, N)].get();
+                char *ptr_D = dst_row + j * SW * OC * dst_dsz;
+                void *ptr_C = use_buffer ? (void *)c_buffer : (void *)ptr_D;
+                if (need_postops) {
+                    const brgemm_post_ops_data_t post_ops_data {
+                            bias ? bias + oc * bia_dsz : nullptr, nullptr,
+                            post_ops_binary_rhs_arg_vec.data(),
+                            static_cast<size_t>(oc), 0, dst};
+                    brgemm_kernel_execute_postops(ker, bs, batch, ptr_C,
+                            (void *)ptr_D, post_ops_data, nullptr);
+                } else {
+                    brgemm_kernel_execute(ker, bs, batch, ptr_C, nullptr);
+                }
+            };
+
+            for (dim_t j = 0; j < ph.jlo; j++)
+                compute(j, 1);
+            for (dim_t j = ph.jlo; j < ph.jhi; j += m_blk)
+                compute(j, nstl::min(m_blk, ph.jhi - j));
+            for (dim_t j = ph.jhi; j < ph.nj; j++)
+                compute(j, 1);
+
+            nd_iterator_step(n, MB, od, OD, oh, OH, r, SW, ocb, nb_oc);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_deconvolution_fwd_t<avx2>;
+template struct brgemm_deconvolution_fwd_t<avx512_core>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_DECONV_HPP
+#define CPU_X64_JIT_BRGEMM_DECONV_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Direct deconvolution forward with channels-last activations.
+//
+// An output pixel ow receives contributions only from the taps kw for which
+// (ow + padL - kw * (DW + 1)) is a multiple of the stride SW, so the output
+// row is split into SW phases ow = r + SW * j. Within a phase the set of taps
+// is fixed and the source pixel of every tap is j + const, hence a chunk of
+// consecutive j is a brgemm call of M pixels with LDA = IC, accumulating over
+// the valid (kd, kh, kw) taps in the batch, and writing the pixels SW * OC
+// apart in the destination. The zeros inserted by the stride are never
+// multiplied. The pixels at the borders of a phase, for which some taps fall
+// out of the source, are computed one by one with their valid taps only.
+//
+// The bias and the post-ops are applied by the brgemm kernel when the
+// destination is stored.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        using cpu_deconvolution_fwd_pd_t::cpu_deconvolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa, ""),
+                brgemm_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Taps of a phase of the output width and the range [jlo, jhi) of
+        // the pixels of the phase for which all the taps are in the source.
+        struct w_phase_t {
+            dim_t nj = 0, jlo = 0, jhi = 0;
+            std::vector<dim_t> kw, iw_off;
+        };
+
+        int brg_idx(dim_t m, dim_t n) const {
+            return m_idx_[m] * 2 + (n < n_blk_);
+        }
+
+        std::vector<w_phase_t> w_phases_;
+        dim_t m_blk_ = 0;
+        dim_t n_blk_ = 0, nb_oc_ = 0;
+        int max_bs_ = 0;
+        int nthr_ = 0;
+        // True if the brgemm kernels are to store the destination through
+        // the post-ops path (bias, post-ops or down-conversion).
+        bool need_postops_ = false;
+        // Index of the kernels processing m pixels, -1 if m never occurs.
+        std::vector<int> m_idx_;
+        // Kernels indexed by the index of m and the tail of the channels.
+        std::vector<brgemm_t> brgs_;
+
+    private:
+        bool set_default_formats();
+        bool post_ops_ok() const;
+        void init_w_phases();
+        void init_scratchpad();
+    };
+
+    brgemm_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
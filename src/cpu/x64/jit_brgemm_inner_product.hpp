@@ -208,6 +208,12 @@ struct brgemm_inner_product_fwd_t : public primitive_t {
         return execute_forward(ctx);
     }
 
+    size_t get_resident_size() const override {
+        // The kernel descriptors and the AMX palettes are kept alongside the
+        // generated code.
+        return sizeof(*this) + sizeof(*pd()) + host_binaries_.code_size();
+    }
+
 private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
@@ -376,6 +382,10 @@ struct brgemm_inner_product_bwd_data_t : public primitive_t {
         return status::success;
     }
 
+    size_t get_resident_size() const override {
+        return sizeof(*this) + sizeof(*pd()) + host_binaries_.code_size();
+    }
+
 private:
     void execute_backward_data(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
@@ -557,6 +567,10 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
         return status::success;
     }
 
+    size_t get_resident_size() const override {
+        return sizeof(*this) + sizeof(*pd()) + host_binaries_.code_size();
+    }
+
 private:
     struct thread_info_t;
     std::unique_ptr<jit_brgemm_kernel_diff_bias_t> kernels_db_[2][2];
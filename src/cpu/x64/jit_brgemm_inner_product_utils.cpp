@@ -265,7 +265,8 @@ bool post_ops_ok(jit_brgemm_primitive_conf_t &jbgp,
 
     const auto &post_ops = attr.post_ops_;
 
-    return injector::post_ops_ok(post_ops_ok_args_t(get_max_cpu_isa(),
+    return injector::post_ops_ok(post_ops_ok_args_t(
+            is_superset(jbgp.isa, avx512_core) ? get_max_cpu_isa() : avx2,
             {sum, eltwise, binary}, post_ops, &dst_d,
             false /*sum_at_pos_0_only*/, false /*sum_requires_scale_one*/,
             true /*sum_requires_zp_zero*/,
@@ -840,7 +841,11 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
     const memory_desc_wrapper dst_d(&dst_md);
 
     using namespace prop_kind;
-    if (!mayiuse(avx512_core)) return status::unimplemented;
+    // Only forward propagation has Ymm based kernels
+    const bool is_avx2 = one_of(isa, avx2, avx2_vnni);
+    if (!mayiuse(is_avx2 ? isa : avx512_core)) return status::unimplemented;
+    if (is_avx2 && !one_of(ipd.prop_kind, forward_training, forward_inference))
+        return status::unimplemented;
 
     int ndims = src_d.ndims();
     if (weights_d.ndims() != ndims || dst_d.ndims() != 2)
@@ -888,7 +893,8 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
             ? pick_by_prop_kind(jbgp.prop_kind, ipd.bias_desc.data_type,
                     data_type::undef, ipd.diff_bias_desc.data_type)
             : data_type::undef;
-    jbgp.signed_input = one_of(isa, avx512_core_vnni, avx512_core_bf16)
+    jbgp.signed_input
+            = one_of(isa, avx512_core_vnni, avx512_core_bf16, avx2_vnni)
             && jbgp.src_dt == s8;
     const bool is_int8 = one_of(jbgp.src_dt, u8, s8) && jbgp.wei_dt == s8;
     const bool is_bf16
@@ -906,12 +912,13 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
 
     if (!IMPLICATION(is_int8,
                 one_of(isa, avx512_core_vnni, avx512_core_bf16,
-                        avx512_core_bf16_amx_int8)))
+                        avx512_core_bf16_amx_int8, avx2_vnni)))
         return status::unimplemented;
     if (!IMPLICATION(is_bf16,
                 one_of(isa, avx512_core_bf16, avx512_core_bf16_amx_bf16)))
         return status::unimplemented;
-    if (!IMPLICATION(is_f32, jbgp.is_bf32 || (isa == avx512_core)))
+    if (!IMPLICATION(
+                is_f32, jbgp.is_bf32 || one_of(isa, avx512_core, avx2)))
         return status::unimplemented;
 
     if (is_int8) {
@@ -962,8 +969,11 @@ status_t init_ip_conf(cpu_isa_t isa, jit_brgemm_primitive_conf_t &jbgp,
                     | memory_extra_flags::compensation_conv_s8s8
                     | memory_extra_flags::scale_adjust;
             want_wei_md.extra.compensation_mask = (1 << 0);
-            want_wei_md.extra.scale_adjust
-                    = platform::s8s8_weights_scale_factor();
+            // vpdpbusd does not saturate, so the weights are not scaled
+            // down for avx2_vnni either
+            want_wei_md.extra.scale_adjust = isa == avx2_vnni
+                    ? 1.f
+                    : platform::s8s8_weights_scale_factor();
             if (weights_md.format_kind != format_kind::any
                     && want_wei_md != weights_md)
                 return status::unimplemented;
@@ -56,6 +56,7 @@ struct jit_brgemm_kernel_diff_bias_t : public jit_generator {
         , acc_typesize_(types::data_type_size(acc_dt_)) {}
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_kernel_diff_bias_t)
+    bool is_relocatable() const override { return true; }
 
 private:
     brgemm_t brg_;
@@ -331,6 +332,7 @@ struct jit_brgemm_kernel_post_ops : public jit_generator {
     ~jit_brgemm_kernel_post_ops() = default;
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_kernel_post_ops)
+    bool is_relocatable() const override { return true; }
 
     brgemm_t brg;
     jit_brgemm_conv_conf_t jcp;
@@ -495,10 +497,12 @@ private:
             const float *p_sum_scale = &p.entry_[sum_idx].sum.scale;
             const int32_t *p_sum_zp = &p.entry_[sum_idx].sum.zero_point;
             if (*p_sum_scale != 1.f)
-                mov(reg_ptr_sum_scale, (size_t)p_sum_scale);
+                mov_host_addr(reg_ptr_sum_scale,
+                        reinterpret_cast<uintptr_t>(p_sum_scale));
             auto zmm_sum_zp = Xbyak::Zmm(30);
             if (*p_sum_zp != 0) {
-                mov(reg_ptr_sum_zp, (size_t)p_sum_zp);
+                mov_host_addr(
+                        reg_ptr_sum_zp, reinterpret_cast<uintptr_t>(p_sum_zp));
                 vcvtdq2ps(zmm_sum_zp, ptr_b[reg_ptr_sum_zp]);
             }
 
@@ -0,0 +1,517 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/stream_profiler.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+namespace {
+
+// Computes s = exp(s - max) for a row of scores in place and stores the
+// partial sums of the exponents, one per lane, to `sum`.
+template <cpu_isa_t isa>
+struct jit_sdpa_softmax_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sdpa_softmax_kernel_t)
+
+    struct call_params_t {
+        float *scores;
+        const float *max;
+        float *sum;
+        size_t work_amount; // A multiple of simd_w.
+    };
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    jit_sdpa_softmax_kernel_t()
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa) {
+        exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_exp, 0.f, 0.f, 1.f, false, reg_table,
+                Opmask(1)));
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int n_vregs = cpu_isa_traits<isa>::n_vregs;
+    static constexpr int unroll = 4;
+    // The auxiliary registers of the injector are taken from the bottom.
+    static constexpr int first_data_idx = n_vregs - 2 - unroll;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_scores = r8;
+    Reg64 reg_sum = r9;
+    Reg64 reg_work = r10;
+    Reg64 reg_table = r11;
+    Reg64 reg_tmp = rax;
+
+    Vmm vmax = Vmm(n_vregs - 1);
+    Vmm vsum = Vmm(n_vregs - 2);
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    void compute(int n) {
+        for (int i = 0; i < n; i++) {
+            const Vmm v(first_data_idx + i);
+            uni_vmovups(v, ptr[reg_scores + i * vlen]);
+            uni_vsubps(v, v, vmax);
+        }
+        exp_injector_->compute_vector_range(
+                first_data_idx, first_data_idx + n);
+        for (int i = 0; i < n; i++) {
+            const Vmm v(first_data_idx + i);
+            uni_vaddps(vsum, vsum, v);
+            uni_vmovups(ptr[reg_scores + i * vlen], v);
+        }
+        add(reg_scores, n * vlen);
+        sub(reg_work, n * simd_w);
+    }
+
+    void generate() override {
+#define GET_OFF(field) offsetof(call_params_t, field)
+        preamble();
+        exp_injector_->load_table_addr();
+
+        mov(reg_scores, ptr[reg_param + GET_OFF(scores)]);
+        mov(reg_tmp, ptr[reg_param + GET_OFF(max)]);
+        uni_vbroadcastss(vmax, ptr[reg_tmp]);
+        mov(reg_sum, ptr[reg_param + GET_OFF(sum)]);
+        mov(reg_work, ptr[reg_param + GET_OFF(work_amount)]);
+        uni_vpxor(vsum, vsum, vsum);
+#undef GET_OFF
+
+        Label unroll_loop, loop, done;
+        L(unroll_loop);
+        {
+            cmp(reg_work, unroll * simd_w);
+            jl(loop, T_NEAR);
+            compute(unroll);
+            jmp(unroll_loop, T_NEAR);
+        }
+        L(loop);
+        {
+            cmp(reg_work, simd_w);
+            jl(done, T_NEAR);
+            compute(1);
+            jmp(loop, T_NEAR);
+        }
+        L(done);
+        uni_vmovups(ptr[reg_sum], vsum);
+
+        postamble();
+
+        exp_injector_->prepare_table();
+    }
+};
+
+// The softmax kernel does not need bf16 instructions.
+template <cpu_isa_t isa>
+constexpr cpu_isa_t softmax_isa() {
+    return isa == avx2 ? avx2 : avx512_core;
+}
+
+// The maximum vector length of the softmax kernel, in floats.
+constexpr dim_t max_simd_w = 16;
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    dt_ = src_md(0)->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    bool ok = mayiuse(isa)
+            && everyone_is(dt_, src_md(1)->data_type, src_md(2)->data_type)
+            && dt_ == (isa == avx512_core_bf16 ? bf16 : f32)
+            && IMPLICATION(is_bf16(), D() % 2 == 0)
+            && IMPLICATION(with_mask(), src_md(3)->data_type == f32)
+            && one_of(dst_dt, f32, bf16, s8, u8)
+            && platform::has_data_type_support(dst_dt)
+            && attr()->has_default_values(
+                    skip_mask_t::oscale | skip_mask_t::oscale_runtime)
+            && attr()->output_scales_.mask_ == 0
+            && set_default_params() == status::success
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // The rows of the matrices are to be dense.
+    const int nd = ndims();
+    auto is_row_major = [&](const memory_desc_t *md, dim_t cols, dim_t &ld) {
+        const memory_desc_wrapper mdw(md);
+        if (!mdw.is_blocking_desc() || mdw.blocking_desc().inner_nblks != 0)
+            return false;
+        const auto &strides = mdw.blocking_desc().strides;
+        ld = strides[nd - 2];
+        return strides[nd - 1] == 1 && ld >= cols;
+    };
+    ok = is_row_major(src_md(0), D(), ldq_)
+            && is_row_major(src_md(1), D(), ldk_)
+            && is_row_major(src_md(2), DV(), ldv_)
+            && is_row_major(dst_md(), DV(), ldd_)
+            && IMPLICATION(with_mask(),
+                    memory_desc_wrapper(src_md(3)).is_blocking_desc()
+                            && memory_desc_wrapper(src_md(3))
+                                            .blocking_desc()
+                                            .inner_nblks
+                                    == 0);
+    if (!ok) return status::unimplemented;
+
+    nthr_ = dnnl_get_max_threads();
+
+    // Smaller blocks of queries are taken when there are not enough of them
+    // to keep all the threads busy.
+    m_blk_ = nstl::min<dim_t>(SQ(), 64);
+    while (m_blk_ > 16 && MB() * div_up(SQ(), m_blk_) < nthr_)
+        m_blk_ = div_up(m_blk_, 2);
+    nb_m_ = div_up(SQ(), m_blk_);
+    m_tail_ = SQ() % m_blk_;
+
+    // The scores, the panels of keys and values of a block of keys and the
+    // accumulator of a thread are to fit in half of L2.
+    const dim_t l2_size = platform::get_per_core_cache_size(2) / 2;
+    const dim_t acc_size = m_blk_ * DV() * (dim_t)sizeof(float);
+    const dim_t key_size = (m_blk_ + D() + DV()) * (dim_t)sizeof(float);
+    n_blk_ = rnd_dn(nstl::max<dim_t>(l2_size - acc_size, 0) / key_size, 16);
+    n_blk_ = utils::saturate<dim_t>(16, 512, n_blk_);
+    n_blk_ = nstl::min(n_blk_, rnd_up(SKV(), 16));
+    nb_n_ = div_up(SKV(), n_blk_);
+    n_tail_ = SKV() % n_blk_;
+
+    for (int i_m = 0; i_m < 2; i_m++)
+        for (int i_n = 0; i_n < 2; i_n++) {
+            if (!with_kernel(i_m, i_n)) continue;
+            const dim_t M = i_m ? m_tail_ : m_blk_;
+            const dim_t N = i_n ? n_tail_ : n_blk_;
+            CHECK(init_brgemm(&brg_qk_[i_m][i_n], M, N, D(), ldq_, n_blk_,
+                    n_blk_, 0.f));
+            // The reduction over the keys is padded to even in bf16.
+            const dim_t K = is_bf16() ? rnd_up(N, 2) : N;
+            CHECK(init_brgemm(&brg_pv_[i_m][i_n], M, DV(), K, n_blk_,
+                    is_bf16() ? DV() : ldv_, DV(), 1.f));
+        }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_brgemm(brgemm_t *brg, dim_t M,
+        dim_t N, dim_t K, dim_t LDA, dim_t LDB, dim_t LDC, float beta) {
+    CHECK(brgemm_desc_init(brg, isa, brgemm_addr, dt_, dt_, false, false,
+            brgemm_row_major, 1.f, beta, LDA, LDB, LDC, M, N, K));
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    return brgemm_desc_set_attr(brg, brgattr);
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t dt_size = types::data_type_size(dt_);
+    scratchpad.template book<char>(
+            key_sdpa_keys_packed, MB() * nb_n_ * n_blk_ * D() * dt_size);
+    if (is_bf16())
+        scratchpad.template book<bfloat16_t>(
+                key_sdpa_values_packed, MB() * nb_n_ * n_blk_ * DV());
+    // The scores of a thread, followed by the probabilities in bf16.
+    const size_t scores_size = m_blk_ * n_blk_
+            * (sizeof(float) + (is_bf16() ? sizeof(bfloat16_t) : 0));
+    scratchpad.template book<char>(key_sdpa_scores, nthr_ * scores_size);
+    scratchpad.template book<float>(key_sdpa_acc, nthr_ * m_blk_ * DV());
+    // The running maximum and sum of every row of a thread and the partial
+    // sums of the softmax kernel.
+    scratchpad.template book<float>(
+            key_sdpa_stats, nthr_ * (2 * m_blk_ + max_simd_w));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::init(engine_t *engine) {
+    for (int i_m = 0; i_m < 2; i_m++)
+        for (int i_n = 0; i_n < 2; i_n++) {
+            if (!pd()->with_kernel(i_m, i_n)) continue;
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, pd()->brg_qk_[i_m][i_n]));
+            CHECK(safe_ptr_assign(brg_qk_kernels_[i_m][i_n], ker));
+            CHECK(brgemm_kernel_create(&ker, pd()->brg_pv_[i_m][i_n]));
+            CHECK(safe_ptr_assign(brg_pv_kernels_[i_m][i_n], ker));
+        }
+
+    CHECK(safe_ptr_assign(softmax_kernel_,
+            new jit_sdpa_softmax_kernel_t<softmax_isa<isa>()>()));
+    return softmax_kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    using softmax_kernel_t = jit_sdpa_softmax_kernel_t<softmax_isa<isa>()>;
+    using softmax_params_t = typename softmax_kernel_t::call_params_t;
+    constexpr dim_t simd_w = softmax_kernel_t::simd_w;
+
+    auto q = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    auto mask = pd()->with_mask()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_ATTN_MASK)
+            : nullptr;
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_SCALES_BUFFER(scales);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int nd = pd()->ndims();
+    const dim_t MB = pd()->MB();
+    const dim_t SQ = pd()->SQ();
+    const dim_t SKV = pd()->SKV();
+    const dim_t D = pd()->D();
+    const dim_t DV = pd()->DV();
+    const float scale = pd()->scale();
+    const bool causal = pd()->with_causal_mask();
+    const bool is_bf16 = pd()->is_bf16();
+    const size_t dt_size = types::data_type_size(pd()->dt_);
+
+    const dim_t m_blk = pd()->m_blk_, nb_m = pd()->nb_m_;
+    const dim_t n_blk = pd()->n_blk_, nb_n = pd()->nb_n_;
+    const dim_t ldk = pd()->ldk_, ldv = pd()->ldv_, ldd = pd()->ldd_;
+
+    // The mask is broadcast along its dimensions set to one.
+    const dim_t mask_col_stride
+            = !pd()->with_mask() || mask_d.dims()[nd - 1] == 1
+            ? 0
+            : mask_d.blocking_desc().strides[nd - 1];
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *keys_packed = scratchpad.template get<char>(key_sdpa_keys_packed);
+    bfloat16_t *values_packed
+            = scratchpad.template get<bfloat16_t>(key_sdpa_values_packed);
+    char *scores_base = scratchpad.template get<char>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+
+    auto block_size = [](dim_t i_blk, dim_t nb, dim_t blk, dim_t tail) {
+        return i_blk == nb - 1 && tail > 0 ? tail : blk;
+    };
+
+    // Phase 1: the keys are transposed into panels of n_blk columns, and the
+    // keys and the values are packed in the VNNI layout in bf16.
+    {
+        profiling_phase_t phase(ctx, "pack");
+        parallel_nd(MB, nb_n, [&](dim_t mb, dim_t ib) {
+            const dim_t j0 = ib * n_blk;
+            const dim_t n = block_size(ib, nb_n, n_blk, pd()->n_tail_);
+            const dim_t panel = mb * nb_n + ib;
+            const char *k_blk = k + pd()->off(k_d, mb, j0, 0) * dt_size;
+            if (is_bf16) {
+                auto kp = reinterpret_cast<bfloat16_t *>(keys_packed)
+                        + panel * D * n_blk;
+                auto k_bf16 = reinterpret_cast<const bfloat16_t *>(k_blk);
+                for (dim_t j = 0; j < n; j++)
+                    for (dim_t c = 0; c < D; c++)
+                        kp[((c / 2) * n_blk + j) * 2 + c % 2]
+                                = k_bf16[j * ldk + c];
+
+                auto vp = values_packed + panel * n_blk * DV;
+                auto v_bf16 = reinterpret_cast<const bfloat16_t *>(v)
+                        + pd()->off(v_d, mb, j0, 0);
+                for (dim_t j = 0; j < rnd_up(n, 2); j++)
+                    for (dim_t c = 0; c < DV; c++)
+                        vp[((j / 2) * DV + c) * 2 + j % 2]
+                                = j < n ? v_bf16[j * ldv + c]
+                                        : bfloat16_t(0.f);
+            } else {
+                auto kp = reinterpret_cast<float *>(keys_packed)
+                        + panel * D * n_blk;
+                auto k_f32 = reinterpret_cast<const float *>(k_blk);
+                for (dim_t j = 0; j < n; j++)
+                    for (dim_t c = 0; c < D; c++)
+                        kp[c * n_blk + j] = k_f32[j * ldk + c];
+            }
+        });
+    }
+
+    // Phase 2: every thread processes blocks of queries with all the blocks
+    // of keys and values.
+    profiling_phase_t phase(ctx, "attention");
+    const dim_t work_amount = MB * nb_m;
+    parallel(pd()->nthr_, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *scores = reinterpret_cast<float *>(scores_base
+                + ithr * m_blk * n_blk
+                        * (sizeof(float) + (is_bf16 ? sizeof(bfloat16_t) : 0)));
+        bfloat16_t *probs
+                = reinterpret_cast<bfloat16_t *>(scores + m_blk * n_blk);
+        float *acc = acc_base + ithr * m_blk * DV;
+        float *row_max = stats_base + ithr * (2 * m_blk + max_simd_w);
+        float *row_sum = row_max + m_blk;
+        float *partial_sums = row_sum + m_blk;
+
+        dim_t mb {0}, ib {0};
+        nd_iterator_init(start, mb, MB, ib, nb_m);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t i0 = ib * m_blk;
+            const dim_t m = block_size(ib, nb_m, m_blk, pd()->m_tail_);
+            const int i_m = m < m_blk;
+
+            for (dim_t r = 0; r < m; r++) {
+                row_max[r] = -INFINITY;
+                row_sum[r] = 0.f;
+            }
+            for (dim_t e = 0; e < m * DV; e++)
+                acc[e] = 0.f;
+
+            // The causal mask aligns the last query with the last key.
+            auto n_keys = [&](dim_t i) {
+                return causal ? nstl::max<dim_t>(
+                               0, nstl::min(SKV, i + SKV - SQ + 1))
+                              : SKV;
+            };
+            const dim_t kv_end = n_keys(i0 + m - 1);
+            const char *q_blk = q + pd()->off(q_d, mb, i0, 0) * dt_size;
+
+            for (dim_t jb = 0; jb < div_up(kv_end, n_blk); jb++) {
+                const dim_t j0 = jb * n_blk;
+                const dim_t n = block_size(jb, nb_n, n_blk, pd()->n_tail_);
+                const int i_n = n < n_blk;
+                const dim_t n_pad = rnd_up(n, simd_w);
+                const dim_t panel = mb * nb_n + jb;
+
+                brgemm_batch_element_t qk;
+                qk.ptr.A = q_blk;
+                qk.ptr.B = keys_packed + panel * D * n_blk * dt_size;
+                brgemm_kernel_execute(
+                        brg_qk_kernels_[i_m][i_n].get(), 1, &qk, scores);
+
+                for (dim_t r = 0; r < m; r++) {
+                    float *s = scores + r * n_blk;
+                    const dim_t n_valid = utils::saturate<dim_t>(
+                            0, n, n_keys(i0 + r) - j0);
+                    const float *mask_row = mask
+                            ? mask + pd()->off(mask_d, mb, i0 + r, j0)
+                            : nullptr;
+
+                    float blk_max = -INFINITY;
+                    for (dim_t j = 0; j < n_valid; j++) {
+                        s[j] *= scale;
+                        if (mask_row) s[j] += mask_row[j * mask_col_stride];
+                        blk_max = nstl::max(blk_max, s[j]);
+                    }
+                    for (dim_t j = n_valid; j < n_pad; j++)
+                        s[j] = -INFINITY;
+
+                    const float new_max = nstl::max(row_max[r], blk_max);
+                    if (new_max == -INFINITY) {
+                        // All the keys so far are masked out.
+                        for (dim_t j = 0; j < n_pad; j++)
+                            s[j] = 0.f;
+                    } else {
+                        softmax_params_t p;
+                        p.scores = s;
+                        p.max = &new_max;
+                        p.sum = partial_sums;
+                        p.work_amount = n_pad;
+                        (*softmax_kernel_)(&p);
+
+                        float blk_sum = 0.f;
+                        for (dim_t l = 0; l < simd_w; l++)
+                            blk_sum += partial_sums[l];
+                        const float corr = expf(row_max[r] - new_max);
+                        row_sum[r] = row_sum[r] * corr + blk_sum;
+                        if (corr != 1.f)
+                            for (dim_t c = 0; c < DV; c++)
+                                acc[r * DV + c] *= corr;
+                        row_max[r] = new_max;
+                    }
+
+                    if (is_bf16) {
+                        bfloat16_t *p_row = probs + r * n_blk;
+                        cvt_float_to_bfloat16(p_row, s, n);
+                        if (n % 2) p_row[n] = 0.f;
+                    }
+                }
+
+                brgemm_batch_element_t pv;
+                if (is_bf16) {
+                    pv.ptr.A = probs;
+                    pv.ptr.B = values_packed + panel * n_blk * DV;
+                } else {
+                    pv.ptr.A = scores;
+                    pv.ptr.B = v + pd()->off(v_d, mb, j0, 0) * dt_size;
+                }
+                brgemm_kernel_execute(
+                        brg_pv_kernels_[i_m][i_n].get(), 1, &pv, acc);
+            }
+
+            const dim_t dst_off = pd()->off(dst_d, mb, i0, 0);
+            for (dim_t r = 0; r < m; r++)
+                for (dim_t c = 0; c < DV; c++) {
+                    // A query with all the keys masked out has a zero output.
+                    const float res = row_sum[r] > 0.f
+                            ? acc[r * DV + c] * scales[0] / row_sum[r]
+                            : 0.f;
+                    io::store_float_value(dst_d.data_type(), res, dst,
+                            dst_off + r * ldd + c);
+                }
+
+            nd_iterator_step(mb, MB, ib, nb_m);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_sdpa_fwd_t<avx512_core_bf16>;
+template struct brgemm_sdpa_fwd_t<avx512_core>;
+template struct brgemm_sdpa_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
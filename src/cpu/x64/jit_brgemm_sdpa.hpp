@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Scaled dot-product attention computed block by block ("flash attention").
+//
+// The queries are split into blocks of m_blk rows, the keys and the values
+// into blocks of n_blk rows. For a block of queries, the scores with every
+// block of keys are computed by brgemm into an m_blk x n_blk tile, turned
+// into probabilities by an online softmax and multiplied by the block of
+// values into an m_blk x Dv accumulator. The running maximum and sum of every
+// row rescale the accumulator when the maximum grows. The tiles of a thread
+// are sized to stay in L2, so the full Sq x Skv scores are never stored.
+//
+// The keys are transposed into n_blk wide panels beforehand, as brgemm does
+// not support a transposed B matrix. In bf16 the keys and the values are
+// packed in the VNNI layout expected by brgemm.
+template <cpu_isa_t isa>
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa, ""), brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        bool is_bf16() const { return dt_ == data_type::bf16; }
+
+        // Returns true if the brgemm kernel for the tails `i_m` and `i_n` of
+        // the queries and the keys is used.
+        bool with_kernel(int i_m, int i_n) const {
+            return (i_m ? m_tail_ : m_blk_) > 0 && (i_n ? n_tail_ : n_blk_) > 0;
+        }
+
+        data_type_t dt_ = data_type::undef;
+        int nthr_ = 0;
+        dim_t m_blk_ = 0, m_tail_ = 0, nb_m_ = 0;
+        dim_t n_blk_ = 0, n_tail_ = 0, nb_n_ = 0;
+        // Leading dimensions of the queries, the keys, the values and the
+        // destination.
+        dim_t ldq_ = 0, ldk_ = 0, ldv_ = 0, ldd_ = 0;
+
+        // Scores kernels, Q * K^T, indexed by the tails of the queries and
+        // the keys.
+        brgemm_t brg_qk_[2][2];
+        // Output kernels, P * V, indexed by the tails of the queries and the
+        // keys (the reduction dimension).
+        brgemm_t brg_pv_[2][2];
+
+    private:
+        status_t init_brgemm(brgemm_t *brg, dim_t M, dim_t N, dim_t K,
+                dim_t LDA, dim_t LDB, dim_t LDC, float beta);
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_qk_kernels_[2][2];
+    std::unique_ptr<brgemm_kernel_t> brg_pv_kernels_[2][2];
+    std::unique_ptr<jit_generator> softmax_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -36,6 +36,7 @@ using namespace Xbyak;
 struct jit_brgemm_trans_m_k_f32_t : public jit_brgemm_trans_src_t,
                                     public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_trans_m_k_f32_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_trans_m_k_f32_t(const jit_brgemm_primitive_conf_t *conf)
         : jit_brgemm_trans_src_t(conf), jit_generator(jit_name()) {}
@@ -347,6 +348,7 @@ void jit_brgemm_trans_m_k_f32_t::generate() {
 struct jit_brgemm_trans_m_k_bf16_t : public jit_brgemm_trans_src_t,
                                      public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_trans_m_k_bf16_t)
+    bool is_relocatable() const override { return true; }
     jit_brgemm_trans_m_k_bf16_t(const jit_brgemm_primitive_conf_t *conf)
         : jit_brgemm_trans_src_t(conf), jit_generator(jit_name()) {}
 
@@ -606,12 +608,12 @@ void jit_brgemm_trans_m_k_bf16_t::generate() {
     kmovw(k33, 0x33);
 
     auto vmovdqa64 = [=](Zmm z, const int64_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
     auto vmovdqa32 = [=](Zmm z, const int32_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa32(z, ptr[imm_addr64]);
     };
 
@@ -911,6 +913,7 @@ void jit_brgemm_copy_to_coarse_t::generate() {
 struct jit_trans_to_vnni_t : public jit_brgemm_trans_to_vnni_t,
                              public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_trans_to_vnni_t)
+    bool is_relocatable() const override { return true; }
     jit_trans_to_vnni_t(const jit_brgemm_primitive_conf_t *conf,
             jit_brgemm_trans_to_vnni_t::matrix_to_transform_t
                     matrix_to_transform)
@@ -1107,7 +1110,7 @@ void jit_trans_to_vnni_t::generate() {
     kmovd(mask_tail, (1 << col_tail) - 1);
 
     auto vmovdqa64 = [=](Zmm z, const int64_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
@@ -1214,6 +1217,7 @@ void jit_trans_to_vnni_t::generate() {
 struct jit_copy_f32_t : public jit_brgemm_trans_to_vnni_t,
                         public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_copy_f32_t)
+    bool is_relocatable() const override { return true; }
     jit_copy_f32_t(const jit_brgemm_primitive_conf_t *conf,
             jit_brgemm_trans_to_vnni_t::matrix_to_transform_t
                     matrix_to_transform)
@@ -1357,6 +1361,7 @@ void jit_copy_f32_t::generate() {
 struct jit_brgemm_trans_wei_f32_t : public jit_brgemm_trans_wei_t,
                                     public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_trans_wei_f32_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_trans_wei_f32_t(const jit_brgemm_primitive_conf_t *conf)
         : jit_brgemm_trans_wei_t(conf), jit_generator(jit_name()) {}
@@ -1652,6 +1657,7 @@ void jit_brgemm_trans_wei_f32_t::generate() {
 struct jit_brgemm_trans_wei_bf16_t : public jit_brgemm_trans_wei_t,
                                      public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_trans_wei_bf16_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_trans_wei_bf16_t(const jit_brgemm_primitive_conf_t *conf)
         : jit_brgemm_trans_wei_t(conf), jit_generator(jit_name()) {}
@@ -1825,7 +1831,7 @@ void jit_brgemm_trans_wei_bf16_t::generate() {
                     0x0f0e0b0a};
 
     auto vmovdqa64 = [=](Zmm z, const int64_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
@@ -1891,6 +1897,7 @@ void jit_brgemm_trans_wei_bf16_t::generate() {
 struct jit_amx_ip_trans_diff_wei_to_vnni_t : public jit_amx_ip_trans_diff_wei,
                                              public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_amx_ip_trans_diff_wei_to_vnni)
+    bool is_relocatable() const override { return true; }
 
     jit_amx_ip_trans_diff_wei_to_vnni_t(const jit_brgemm_primitive_conf_t *jbgp,
             const int ext_ic_block, const int ext_oc_block)
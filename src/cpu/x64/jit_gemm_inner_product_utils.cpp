@@ -1223,6 +1223,9 @@ void jit_pp_kernel_t<isa>::operator()(void *dst, const void *acc,
 pp_kernel_t *jit_pp_kernel_create(size_t OC, size_t MB, dim_t dst_mb_stride,
         const primitive_attr_t *attr, data_type_t bias_dt, data_type_t acc_dt,
         const memory_desc_t *dst_md, bool skip_sum) {
+    // f16 data is handled by the reference kernel.
+    if (utils::one_of(data_type::f16, bias_dt, dst_md->data_type))
+        return nullptr;
     if (mayiuse(avx512_core_bf16)) {
         return new jit_pp_kernel_t<avx512_core_bf16>(
                 OC, MB, dst_mb_stride, attr, bias_dt, acc_dt, dst_md, skip_sum);
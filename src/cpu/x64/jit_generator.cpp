@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/serialization_stream.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Layout of a kernel binary:
+//   size_t name_len, char name[name_len]
+//   unsigned signature[signature_size]
+//   size_t code_size, uint8_t code[code_size]
+//   size_t nrelocs, {size_t code_offset, size_t top_offset} x nrelocs
+// where each relocation is an 8-byte absolute address of `top + top_offset`
+// written to `top + code_offset`.
+
+namespace {
+// The platform properties the code generation of a kernel may depend on: the
+// maximum ISA of the kernel, per-core cache sizes and the number of cores. A
+// binary generated on a different platform is rejected on load.
+constexpr size_t signature_size = 5;
+
+void get_platform_signature(
+        cpu_isa_t max_cpu_isa, unsigned signature[signature_size]) {
+    signature[0] = (unsigned)max_cpu_isa;
+    for (int level = 1; level <= 3; level++)
+        signature[level] = platform::get_per_core_cache_size(level);
+    signature[4] = platform::get_num_cores();
+}
+} // namespace
+
+void jit_generator::save_binary(host_binaries_t &binaries) const {
+    if (!is_relocatable() || embeds_host_addr_ || !isAutoGrow()) {
+        binaries.invalidate();
+        return;
+    }
+
+    std::vector<std::pair<size_t, size_t>> relocs;
+    bool ok = true;
+    forEachAddTopAddr([&](size_t code_offset, size_t top_offset, int size) {
+        ok = ok && size == (int)sizeof(size_t);
+        relocs.emplace_back(code_offset, top_offset);
+    });
+    if (!ok) {
+        binaries.invalidate();
+        return;
+    }
+
+    serialization_stream_t sstream;
+    const size_t name_len = std::strlen(name());
+    sstream.write(&name_len);
+    sstream.write(name(), name_len);
+    unsigned signature[signature_size];
+    get_platform_signature(max_cpu_isa_, signature);
+    sstream.write(signature, signature_size);
+    const size_t code_size = getSize();
+    sstream.write(&code_size);
+    sstream.write(CodeGenerator::getCode(), code_size);
+    const size_t nrelocs = relocs.size();
+    sstream.write(&nrelocs);
+    for (const auto &r : relocs) {
+        sstream.write(&r.first);
+        sstream.write(&r.second);
+    }
+
+    auto data = sstream.get_data();
+    binaries.add(std::move(data));
+}
+
+status_t jit_generator::create_kernel_from_cache_blob(cache_blob_t &blob) {
+    if (!isAutoGrow()) return status::invalid_arguments;
+
+    const uint8_t *binary = nullptr;
+    size_t binary_size = 0;
+    CHECK(blob.get_binary(&binary, &binary_size));
+
+    size_t pos = 0;
+    const auto read = [&](void *dst, size_t size) -> bool {
+        if (pos + size > binary_size) return false;
+        std::memcpy(dst, binary + pos, size);
+        pos += size;
+        return true;
+    };
+
+    size_t name_len = 0;
+    if (!read(&name_len, sizeof(name_len))) return status::invalid_arguments;
+    if (name_len != std::strlen(name()) || pos + name_len > binary_size
+            || std::memcmp(binary + pos, name(), name_len) != 0)
+        return status::invalid_arguments;
+    pos += name_len;
+
+    unsigned signature[signature_size];
+    get_platform_signature(max_cpu_isa_, signature);
+    if (pos + sizeof(signature) > binary_size
+            || std::memcmp(binary + pos, &signature, sizeof(signature)) != 0)
+        return status::invalid_arguments;
+    pos += sizeof(signature);
+
+    size_t code_size = 0;
+    if (!read(&code_size, sizeof(code_size)) || code_size == 0
+            || pos + code_size > binary_size)
+        return status::invalid_arguments;
+    const uint8_t *code = binary + pos;
+    pos += code_size;
+
+    size_t nrelocs = 0;
+    if (!read(&nrelocs, sizeof(nrelocs))) return status::invalid_arguments;
+
+    db(code, code_size);
+    for (size_t i = 0; i < nrelocs; i++) {
+        size_t code_offset = 0, top_offset = 0;
+        if (!read(&code_offset, sizeof(code_offset))
+                || !read(&top_offset, sizeof(top_offset))
+                || code_offset + sizeof(size_t) > code_size
+                || top_offset > code_size)
+            return status::invalid_arguments;
+        // The addresses are written by `ready()` once the final location of
+        // the code is known.
+        save(code_offset, top_offset, sizeof(size_t), Xbyak::inner::LaddTop);
+    }
+
+    jit_ker_ = getCode();
+    return jit_ker_ ? status::success : status::runtime_error;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -20,6 +20,7 @@
 #include <limits.h>
 
 #include "common/bit_cast.hpp"
+#include "common/cache_blob.hpp"
 #include "common/compiler_workarounds.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -2355,21 +2356,55 @@ public:
     }
 
     virtual status_t create_kernel() {
+        // When a primitive is created from a cache blob the code of
+        // relocatable kernels is taken from the blob instead of being
+        // generated.
+        auto *scope = host_binaries_scope_t::current();
+        if (scope && scope->blob() && is_relocatable())
+            return create_kernel_from_cache_blob(scope->blob());
+
         generate();
         jit_ker_ = getCode();
-        return (jit_ker_) ? status::success : status::runtime_error;
+        if (!jit_ker_) return status::runtime_error;
+        if (scope) save_binary(scope->binaries());
+        return status::success;
+    }
+
+    // Returns true if the kernel code may be moved to another address or
+    // process and hence stored in a cache blob. Such a kernel must not change
+    // its state in `generate()` beyond emitting the code, since `generate()`
+    // is skipped when the code comes from a cache blob. Host addresses must be
+    // embedded with `mov_host_addr()` only, which keeps the code out of the
+    // cache blob.
+    virtual bool is_relocatable() const { return false; }
+
+    // Loads an address of host data or function into a register. Code that
+    // embeds host addresses is bound to the current process.
+    void mov_host_addr(const Xbyak::Reg64 &reg, uintptr_t addr) {
+        embeds_host_addr_ = true;
+        mov(reg, addr);
     }
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    bool embeds_host_addr_ = false;
+
     const Xbyak::uint8 *getCode() {
         this->ready();
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
         register_jit_code(code, getSize());
+        if (auto *scope = host_binaries_scope_t::current())
+            scope->binaries().add_code_size(getSize());
         return code;
     }
 
+    // Serializes the code along with the list of absolute addresses pointing
+    // inside the code and appends it to `binaries`. Invalidates `binaries` if
+    // the code cannot be relocated.
+    void save_binary(host_binaries_t &binaries) const;
+    status_t create_kernel_from_cache_blob(cache_blob_t &blob);
+
     inline bool is_valid_isa(cpu_isa_t isa) {
         return is_subset(isa, max_cpu_isa_) && mayiuse(isa);
     }
@@ -821,6 +821,10 @@ struct jit_brgemm_conv_conf_t {
     int ndims;
     int mb;
     int ngroups, ic, oc, oc_without_padding, ic_without_padding;
+    // distance between consecutive pixels of the destination, greater than
+    // oc_without_padding if the destination is a channel slice of a larger
+    // channels-last tensor
+    int dst_w_stride;
 
     int od_block, oh_block, nb_od,
             nb_oh; // blocking  - included in parallelization
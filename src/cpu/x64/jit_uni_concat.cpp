@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    // The images of the sources in a destination that cannot hold them
+    // (e.g. a blocked destination with a tail in the middle) are left to the
+    // reference implementation.
+    CHECK(cpu_concat_pd_t::init());
+
+    nthr_ = dnnl_get_max_threads();
+    prbs_.resize(n_);
+    ker_descs_.resize(n_);
+    ker_sizes_.resize(n_);
+    work_offs_.resize(n_);
+    work_amount_ = 0;
+
+    for (int i = 0; i < n_; ++i) {
+        const memory_desc_wrapper src_d(src_md(i));
+        if (src_d.has_zero_dim()) return status::unimplemented;
+
+        primitive_attr_t r_attr;
+        const auto &scales = attr()->scales_.get(DNNL_ARG_MULTIPLE_SRC + i);
+        if (!scales.has_default_values())
+            CHECK(r_attr.output_scales_.copy_from(scales));
+
+        tr::prb_t prb;
+        CHECK(tr::prb_init(prb, *src_md(i), *src_image_md(i), &r_attr));
+        // The kernels are called without the tail information, hence the
+        // sources padded to a block are not supported.
+        if (prb.is_tail_present) return status::unimplemented;
+
+        tr::prb_block_for_cache(prb);
+        int ndims_ker_max {};
+        tr::prb_thread_kernel_balance(prb, ndims_ker_max, nthr_);
+
+        tr::kernel_t::desc_t ker_desc;
+        CHECK(tr::kernel_t::desc_init(ker_desc, prb, ndims_ker_max));
+
+        dim_t ker_size = 1, size = 1;
+        for (int d = 0; d < prb.ndims; ++d) {
+            if (d < ker_desc.prb.ndims) ker_size *= prb.nodes[d].n;
+            size *= prb.nodes[d].n;
+        }
+
+        prbs_[i] = prb;
+        ker_descs_[i] = ker_desc;
+        ker_sizes_[i] = ker_size;
+        work_offs_[i] = work_amount_;
+        work_amount_ += size;
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_uni_concat_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const char *>(key_concat_iptrs, n_inputs());
+    scratchpad.template book<const float *>(key_concat_scales, n_inputs());
+}
+
+status_t jit_uni_concat_t::init(engine_t *engine) {
+    const int n = pd()->n_inputs();
+    kernels_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        CHECK(safe_ptr_assign(
+                kernels_[i], tr::kernel_t::create(pd()->ker_descs_[i])));
+        CHECK(kernels_[i]->create_kernel());
+    }
+    return status::success;
+}
+
+// Calls the kernel of the source `i` for the chunks of the source that start
+// in the range [start, end) of the work of all the sources.
+void jit_uni_concat_t::execute_source(int i, dim_t start, dim_t end,
+        const char *src, char *dst, const float *scale) const {
+    const tr::prb_t &prb = pd()->prbs_[i];
+    const int ndims_ker = pd()->ker_descs_[i].prb.ndims;
+    const dim_t ker_size = pd()->ker_sizes_[i];
+    const dim_t work_off = pd()->work_offs_[i];
+
+    dim_t nchunks = 1;
+    for (int d = ndims_ker; d < prb.ndims; ++d)
+        nchunks *= prb.nodes[d].n;
+
+    const dim_t chunk_start = start <= work_off
+            ? 0
+            : utils::div_up(start - work_off, ker_size);
+    const dim_t chunk_end = end <= work_off
+            ? 0
+            : nstl::min(nchunks, utils::div_up(end - work_off, ker_size));
+
+    const size_t itype_sz = types::data_type_size(prb.itype);
+    const size_t otype_sz = types::data_type_size(prb.otype);
+
+    for (dim_t chunk = chunk_start; chunk < chunk_end; ++chunk) {
+        ptrdiff_t i_off = prb.ioff, o_off = prb.ooff;
+        dim_t idx = chunk;
+        for (int d = ndims_ker; d < prb.ndims; ++d) {
+            const dim_t n = prb.nodes[d].n;
+            i_off += (idx % n) * prb.nodes[d].is;
+            o_off += (idx % n) * prb.nodes[d].os;
+            idx /= n;
+        }
+
+        tr::call_param_t c;
+        c.in = src + i_off * itype_sz;
+        c.out = dst + o_off * otype_sz;
+        c.scale = scale;
+        (*kernels_[i])(&c);
+    }
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+
+    const int n = pd()->n_inputs();
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto srcs = scratchpad.template get<const char *>(key_concat_iptrs);
+    auto scales = scratchpad.template get<const float *>(key_concat_scales);
+
+    for (int i = 0; i < n; ++i) {
+        const int arg = DNNL_ARG_MULTIPLE_SRC + i;
+        srcs[i] = CTX_IN_MEM(const char *, arg);
+        // a source placed in the destination memory is already in its image
+        if (srcs[i] == dst && pd()->src_inplace(i)) srcs[i] = nullptr;
+        scales[i] = nullptr;
+        if (!pd()->attr()->scales_.get(arg).has_default_values()) {
+            ASSIGN_INPUT_SCALE_VALUE(scales[i], arg);
+        }
+    }
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(pd()->work_amount_, nthr, ithr, start, end);
+        for (int i = 0; i < n; ++i) {
+            if (srcs[i] == nullptr) continue;
+            execute_source(i, start, end, srcs[i], dst, scales[i]);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
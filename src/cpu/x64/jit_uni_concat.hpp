@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+#include "cpu/x64/jit_uni_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+/* Concat of sources with arbitrary data types, layouts and common scales.
+ *
+ * Every source is copied to its image in the destination by a transposition
+ * kernel of the jit:uni reorder. The calls of the kernels of all the sources
+ * are distributed between the threads of a single parallel region, so the
+ * destination is written in one pass without intermediate buffers. */
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T("jit:uni", jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        // Transposition problems of the sources to their images and the
+        // kernels processing the innermost nodes of the problems.
+        std::vector<tr::prb_t> prbs_;
+        std::vector<tr::kernel_t::desc_t> ker_descs_;
+        // Number of elements processed per kernel call and offset of the
+        // first element of each source in the work of all the sources.
+        std::vector<dim_t> ker_sizes_;
+        std::vector<dim_t> work_offs_;
+        dim_t work_amount_ = 0;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    void execute_source(int i, dim_t start, dim_t end, const char *src,
+            char *dst, const float *scale) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::vector<std::unique_ptr<tr::kernel_t>> kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,780 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace Xbyak;
+
+namespace {
+
+struct jit_gnorm_call_params_t {
+    const void *src;
+    const void *diff_dst;
+    void *dst;
+    // Per-channel vectors padded to the vector length.
+    const float *mean;
+    const float *a, *b, *d;
+    float *acc1, *acc2;
+    size_t nrows;
+};
+
+// Processes `nrows` rows of `len` elements, the per-channel vectors being the
+// same for all the rows:
+// - fwd_mean: acc1 = sum(src),
+// - fwd_var: acc1 = sum((src - mean)^2),
+// - bwd_stats: acc1 = sum(diff_dst), acc2 = sum(diff_dst * (src - mean)),
+// - fwd_apply: dst = post_ops(a * src + b),
+// - bwd_apply: dst = a * diff_dst + b * src + d.
+// The reductions keep a chunk of the row in registers over all the rows.
+template <cpu_isa_t isa>
+struct jit_gnorm_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gnorm_kernel_t)
+
+    enum kind_t { fwd_mean, fwd_var, bwd_stats, fwd_apply, bwd_apply };
+
+    jit_gnorm_kernel_t(kind_t kind, dim_t len, data_type_t src_dt,
+            data_type_t diff_dst_dt, data_type_t dst_dt,
+            const post_ops_t &post_ops = post_ops_t())
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , kind_(kind)
+        , len_(len)
+        , nv_(utils::div_up(len, simd_w))
+        , tail_(len % simd_w)
+        , src_dt_(src_dt)
+        , diff_dst_dt_(diff_dst_dt)
+        , dst_dt_(dst_dt)
+        , io_(this, io_isa(), io_data_types(src_dt, diff_dst_dt, dst_dt), {},
+                  io::io_tail_conf_t {static_cast<size_t>(simd_w),
+                          static_cast<size_t>(tail_), k_tail_mask,
+                          vmm_tail_mask.getIdx(), reg_tmp},
+                  io::io_emu_bf16_conf_t {}) {
+        for (int i = 0; i < post_ops.len(); ++i)
+            injectors_.emplace_back(new jit_uni_eltwise_injector_f32<isa>(
+                    this, post_ops.entry_[i].eltwise, true, reg_table,
+                    k_injector_mask));
+    }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    // Number of vectors of a chunk of a row, two accumulators and two data
+    // registers are needed per vector for the reductions. The registers
+    // reserved for the tail mask (avx2) and the bf16 emulation (avx512_core)
+    // are left untouched.
+    static constexpr int unroll = isa == avx2 ? 6 : 12;
+
+    const kind_t kind_;
+    const dim_t len_;
+    const dim_t nv_;
+    const dim_t tail_;
+    const data_type_t src_dt_, diff_dst_dt_, dst_dt_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_diff_dst = r9;
+    const Reg64 reg_dst = r10;
+    const Reg64 reg_rows = r11;
+    const Reg64 reg_mean = r12;
+    const Reg64 reg_a = r13;
+    const Reg64 reg_b = r14;
+    const Reg64 reg_d = r15;
+    const Reg64 reg_acc1 = rbx;
+    const Reg64 reg_acc2 = rdx;
+    const Reg64 reg_tmp = rsi;
+    const Reg64 reg_table = rax;
+
+    const Opmask k_injector_mask = Opmask(1);
+    const Opmask k_tail_mask = Opmask(2);
+    const Vmm vmm_tail_mask = Vmm(15);
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            injectors_;
+
+    static cpu_isa_t io_isa() {
+        return isa == avx512_core && mayiuse(avx512_core_bf16)
+                ? avx512_core_bf16
+                : isa;
+    }
+
+    using data_types_t =
+            typename io::jit_io_multi_dt_helper_t<Vmm>::data_types_t;
+
+    static data_types_t io_data_types(
+            data_type_t src_dt, data_type_t diff_dst_dt, data_type_t dst_dt) {
+        data_types_t dts;
+        for (auto dt : {src_dt, diff_dst_dt, dst_dt})
+            if (dt != data_type::undef) dts.insert(dt);
+        return dts;
+    }
+
+    Vmm vmm_acc1(int i) const { return Vmm(i); }
+    Vmm vmm_acc2(int i) const { return Vmm(unroll + i); }
+    Vmm vmm_data(int i) const { return Vmm(i); }
+    Vmm vmm_src() const { return Vmm(2 * unroll); }
+    Vmm vmm_diff_dst() const { return Vmm(2 * unroll + 1); }
+
+    bool is_tail(dim_t v) const { return tail_ != 0 && v == nv_ - 1; }
+
+    Address data_ptr(const Reg64 &base, data_type_t dt, dim_t v) const {
+        return ptr[base + v * simd_w * types::data_type_size(dt)];
+    }
+    Address vec_ptr(const Reg64 &base, dim_t v) const {
+        return ptr[base + v * vlen];
+    }
+
+#define GET_OFF(field) offsetof(jit_gnorm_call_params_t, field)
+    void load_data_pointers() {
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        if (utils::one_of(kind_, bwd_stats, bwd_apply))
+            mov(reg_diff_dst, ptr[reg_param + GET_OFF(diff_dst)]);
+        if (utils::one_of(kind_, fwd_apply, bwd_apply))
+            mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_rows, ptr[reg_param + GET_OFF(nrows)]);
+    }
+
+    void advance_data_pointers() {
+        add(reg_src, len_ * types::data_type_size(src_dt_));
+        if (utils::one_of(kind_, bwd_stats, bwd_apply))
+            add(reg_diff_dst, len_ * types::data_type_size(diff_dst_dt_));
+        if (utils::one_of(kind_, fwd_apply, bwd_apply))
+            add(reg_dst, len_ * types::data_type_size(dst_dt_));
+    }
+
+    void reduce_chunk(dim_t v0, int n) {
+        const bool two_accs = kind_ == bwd_stats;
+        for (int i = 0; i < n; ++i) {
+            uni_vpxor(vmm_acc1(i), vmm_acc1(i), vmm_acc1(i));
+            if (two_accs) uni_vpxor(vmm_acc2(i), vmm_acc2(i), vmm_acc2(i));
+        }
+
+        // The rows are walked again for every chunk, the pointers are
+        // reloaded from the parameters.
+        load_data_pointers();
+
+        Label row_loop;
+        L(row_loop);
+        {
+            for (int i = 0; i < n; ++i) {
+                const dim_t v = v0 + i;
+                const bool tail = is_tail(v);
+                const Vmm vsrc = vmm_src();
+                io_.at(src_dt_)->load(
+                        data_ptr(reg_src, src_dt_, v), vsrc, tail);
+                switch (kind_) {
+                    case fwd_mean:
+                        uni_vaddps(vmm_acc1(i), vmm_acc1(i), vsrc);
+                        break;
+                    case fwd_var:
+                        uni_vsubps(vsrc, vsrc, vec_ptr(reg_mean, v));
+                        uni_vfmadd231ps(vmm_acc1(i), vsrc, vsrc);
+                        break;
+                    case bwd_stats: {
+                        const Vmm vdd = vmm_diff_dst();
+                        io_.at(diff_dst_dt_)
+                                ->load(data_ptr(reg_diff_dst, diff_dst_dt_, v),
+                                        vdd, tail);
+                        uni_vaddps(vmm_acc1(i), vmm_acc1(i), vdd);
+                        uni_vsubps(vsrc, vsrc, vec_ptr(reg_mean, v));
+                        uni_vfmadd231ps(vmm_acc2(i), vdd, vsrc);
+                        break;
+                    }
+                    default: assert(!"unexpected kernel kind");
+                }
+            }
+            advance_data_pointers();
+            dec(reg_rows);
+            jnz(row_loop, T_NEAR);
+        }
+
+        // The accumulators are padded to the vector length.
+        for (int i = 0; i < n; ++i) {
+            uni_vmovups(vec_ptr(reg_acc1, v0 + i), vmm_acc1(i));
+            if (two_accs) uni_vmovups(vec_ptr(reg_acc2, v0 + i), vmm_acc2(i));
+        }
+    }
+
+    void apply_chunk(dim_t v0, int n) {
+        for (int i = 0; i < n; ++i) {
+            const dim_t v = v0 + i;
+            const bool tail = is_tail(v);
+            const Vmm vdata = vmm_data(i);
+            if (kind_ == fwd_apply) {
+                io_.at(src_dt_)->load(
+                        data_ptr(reg_src, src_dt_, v), vdata, tail);
+                uni_vmulps(vdata, vdata, vec_ptr(reg_a, v));
+                uni_vaddps(vdata, vdata, vec_ptr(reg_b, v));
+            } else {
+                const Vmm vsrc = Vmm(unroll);
+                io_.at(diff_dst_dt_)
+                        ->load(data_ptr(reg_diff_dst, diff_dst_dt_, v), vdata,
+                                tail);
+                io_.at(src_dt_)->load(
+                        data_ptr(reg_src, src_dt_, v), vsrc, tail);
+                uni_vmulps(vdata, vdata, vec_ptr(reg_a, v));
+                uni_vfmadd231ps(vdata, vsrc, vec_ptr(reg_b, v));
+                uni_vaddps(vdata, vdata, vec_ptr(reg_d, v));
+            }
+        }
+        for (auto &injector : injectors_)
+            injector->compute_vector_range(0, n);
+        for (int i = 0; i < n; ++i) {
+            const dim_t v = v0 + i;
+            io_.at(dst_dt_)->store(
+                    vmm_data(i), data_ptr(reg_dst, dst_dt_, v), is_tail(v));
+        }
+    }
+
+    void generate() override {
+        preamble();
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+        if (!injectors_.empty()) injectors_[0]->load_table_addr();
+
+        if (utils::one_of(kind_, fwd_mean, fwd_var, bwd_stats)) {
+            if (kind_ != fwd_mean)
+                mov(reg_mean, ptr[reg_param + GET_OFF(mean)]);
+            mov(reg_acc1, ptr[reg_param + GET_OFF(acc1)]);
+            if (kind_ == bwd_stats)
+                mov(reg_acc2, ptr[reg_param + GET_OFF(acc2)]);
+            for (dim_t v0 = 0; v0 < nv_; v0 += unroll)
+                reduce_chunk(v0, (int)nstl::min<dim_t>(unroll, nv_ - v0));
+        } else {
+            mov(reg_a, ptr[reg_param + GET_OFF(a)]);
+            mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+            if (kind_ == bwd_apply)
+                mov(reg_d, ptr[reg_param + GET_OFF(d)]);
+            load_data_pointers();
+
+            Label row_loop;
+            L(row_loop);
+            {
+                for (dim_t v0 = 0; v0 < nv_; v0 += unroll)
+                    apply_chunk(v0, (int)nstl::min<dim_t>(unroll, nv_ - v0));
+                advance_data_pointers();
+                dec(reg_rows);
+                jnz(row_loop, T_NEAR);
+            }
+        }
+
+        postamble();
+
+        for (auto &injector : injectors_)
+            injector->prepare_table();
+    }
+#undef GET_OFF
+};
+
+template <cpu_isa_t isa>
+status_t init_kernel(std::unique_ptr<jit_generator> &kernel,
+        typename jit_gnorm_kernel_t<isa>::kind_t kind, dim_t len,
+        data_type_t src_dt, data_type_t diff_dst_dt, data_type_t dst_dt,
+        const post_ops_t &post_ops = post_ops_t()) {
+    CHECK(safe_ptr_assign(kernel,
+            new jit_gnorm_kernel_t<isa>(
+                    kind, len, src_dt, diff_dst_dt, dst_dt, post_ops)));
+    return kernel->create_kernel();
+}
+
+// Checks that all the tensors have the same channels-last or blocked layout
+// and splits the spatial points in chunks so that there is enough work for
+// all the threads.
+template <cpu_isa_t isa>
+status_t init_conf(jit_gnorm_conf_t &conf, const group_normalization_pd_t *pd,
+        std::initializer_list<const memory_desc_t *> mds) {
+    using namespace format_tag;
+
+    if (pd->has_zero_dim_memory()) return status::unimplemented;
+
+    const int ndims = pd->ndims();
+    const memory_desc_wrapper src_d(pd->src_md());
+    format_tag_t tag = undef;
+    switch (ndims) {
+        case 2: tag = src_d.matches_one_of_tag(nc); break;
+        case 3: tag = src_d.matches_one_of_tag(nwc, nCw8c, nCw16c); break;
+        case 4: tag = src_d.matches_one_of_tag(nhwc, nChw8c, nChw16c); break;
+        case 5:
+            tag = src_d.matches_one_of_tag(ndhwc, nCdhw8c, nCdhw16c);
+            break;
+        default: break;
+    }
+    if (tag == undef) return status::unimplemented;
+    for (auto md : mds)
+        if (!memory_desc_wrapper(md).matches_tag(tag))
+            return status::unimplemented;
+
+    const dim_t C = pd->C();
+    const dim_t blk = src_d.blocking_desc().inner_nblks == 0
+            ? 0
+            : src_d.blocking_desc().inner_blks[0];
+    conf.is_blocked = blk != 0;
+    if (conf.is_blocked && C % blk != 0) return status::unimplemented;
+
+    constexpr dim_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    conf.len = conf.is_blocked ? blk : C;
+    conf.len_pad = utils::rnd_up(conf.len, simd_w);
+    conf.nb = C / conf.len;
+
+    const dim_t MB = pd->MB();
+    const dim_t SP = pd->SP();
+    const dim_t nthr = dnnl_get_max_threads();
+    conf.nb_sp = nstl::min(SP, utils::div_up(nthr, MB * conf.nb));
+    conf.sp_blk = utils::div_up(SP, conf.nb_sp);
+    conf.nb_sp = utils::div_up(SP, conf.sp_blk);
+
+    return status::success;
+}
+
+// Offset of the first row of the block of channels `cb` of the image `n`.
+dim_t row_off(const jit_gnorm_conf_t &conf, const memory_desc_wrapper &mdw,
+        dim_t n, dim_t cb) {
+    return conf.is_blocked ? mdw.blk_off(n, cb) : mdw.blk_off(n);
+}
+
+bool data_types_ok(cpu_isa_t isa, std::initializer_list<data_type_t> dts) {
+    using namespace data_type;
+    for (auto dt : dts) {
+        const bool ok = dt == f32 || (dt == bf16 && isa == avx512_core);
+        if (!ok) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+bool jit_uni_group_normalization_fwd_t<isa>::pd_t::post_ops_ok() const {
+    const auto &p = attr()->post_ops_;
+    for (int i = 0; i < p.len(); ++i)
+        if (!eltwise_injector::is_supported(isa, p.entry_[i].eltwise.alg))
+            return false;
+    return attr_post_ops_ok();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::pd_t::init(
+        engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+    const bool ok = mayiuse(isa) && is_fwd()
+            && data_types_ok(
+                    isa, {src_md()->data_type, dst_md()->data_type})
+            && stat_md()->data_type == data_type::f32
+            && check_scale_shift_data_type()
+            && attr()->has_default_values(skip_mask_t::post_ops)
+            && post_ops_ok() && set_default_formats_common()
+            && attr_.set_default_formats(dst_md(0)) == status::success;
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf<isa>(conf_, this, {dst_md()}));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_normalization_fwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t vec_sz = MB() * conf_.nb * conf_.len_pad;
+    if (!stats_are_src()) {
+        scratchpad.template book<float>(
+                key_gnorm_reduction, vec_sz * conf_.nb_sp);
+        if (stats_are_tmp()) {
+            scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G());
+            scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G());
+        }
+    }
+    // The mean, a and b vectors.
+    scratchpad.template book<float>(key_gnorm_coef, 3 * vec_sz);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::init(engine_t *engine) {
+    using kernel_t = jit_gnorm_kernel_t<isa>;
+    const auto &conf = pd()->conf_;
+    const auto src_dt = pd()->src_md()->data_type;
+    const auto dst_dt = pd()->dst_md()->data_type;
+    if (!pd()->stats_are_src()) {
+        CHECK(init_kernel<isa>(mean_kernel_, kernel_t::fwd_mean, conf.len,
+                src_dt, data_type::undef, data_type::undef));
+        CHECK(init_kernel<isa>(var_kernel_, kernel_t::fwd_var, conf.len,
+                src_dt, data_type::undef, data_type::undef));
+    }
+    return init_kernel<isa>(apply_kernel_, kernel_t::fwd_apply, conf.len,
+            src_dt, data_type::undef, dst_dt, pd()->attr()->post_ops_);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    auto scale = pd()->use_scale() ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                                   : nullptr;
+    auto shift = pd()->use_shift() ? CTX_IN_MEM(const float *, DNNL_ARG_SHIFT)
+                                   : nullptr;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *mean = nullptr, *variance = nullptr;
+    if (pd()->stats_are_src()) {
+        mean = const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN));
+        variance = const_cast<float *>(
+                CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE));
+    } else if (pd()->stats_are_tmp()) {
+        mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
+        variance = scratchpad.template get<float>(key_gnorm_tmp_var);
+    } else {
+        mean = CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+        variance = CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+    }
+
+    const dim_t MB = pd()->MB();
+    const dim_t G = pd()->G();
+    const dim_t CG = pd()->C_per_group();
+    const dim_t SP = pd()->SP();
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const dim_t len = conf.len, len_pad = conf.len_pad, nb = conf.nb;
+    const size_t src_dt_sz = src_d.data_type_size();
+    const size_t dst_dt_sz = dst_d.data_type_size();
+
+    const dim_t vec_sz = MB * nb * len_pad;
+    float *coef = scratchpad.template get<float>(key_gnorm_coef);
+    float *mean_vec = coef, *a_vec = coef + vec_sz, *b_vec = coef + 2 * vec_sz;
+    const auto vec_off = [&](dim_t n, dim_t cb) {
+        return (n * nb + cb) * len_pad;
+    };
+
+    if (!pd()->stats_are_src()) {
+        float *partial = scratchpad.template get<float>(key_gnorm_reduction);
+        const auto reduce = [&](const jit_generator *kernel) {
+            parallel_nd(MB, nb, conf.nb_sp, [&](dim_t n, dim_t cb, dim_t spb) {
+                const dim_t sp = spb * conf.sp_blk;
+                jit_gnorm_call_params_t p;
+                p.src = src + (row_off(conf, src_d, n, cb) + sp * len)
+                                * src_dt_sz;
+                p.mean = mean_vec + vec_off(n, cb);
+                p.acc1 = partial + vec_off(n, cb) * conf.nb_sp + spb * len_pad;
+                p.nrows = nstl::min(conf.sp_blk, SP - sp);
+                (*kernel)(&p);
+            });
+        };
+        // Sum of the per-channel partial sums of the group `g`.
+        const auto group_sum = [&](dim_t n, dim_t g) {
+            double sum = 0;
+            for_(dim_t c = g * CG; c < (g + 1) * CG; ++c)
+            for (dim_t spb = 0; spb < conf.nb_sp; ++spb)
+                sum += partial[vec_off(n, c / len) * conf.nb_sp
+                        + spb * len_pad + c % len];
+            return (float)(sum / (CG * SP));
+        };
+
+        reduce(mean_kernel_.get());
+        parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+            mean[stat_d.off(n, g)] = group_sum(n, g);
+        });
+        parallel_nd(MB, nb, [&](dim_t n, dim_t cb) {
+            for (dim_t j = 0; j < len_pad; ++j) {
+                const dim_t g = (cb * len + j) / CG;
+                mean_vec[vec_off(n, cb) + j]
+                        = j < len ? mean[stat_d.off(n, g)] : 0.f;
+            }
+        });
+        reduce(var_kernel_.get());
+        parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+            variance[stat_d.off(n, g)] = group_sum(n, g);
+        });
+    }
+
+    parallel_nd(MB, nb, [&](dim_t n, dim_t cb) {
+        for (dim_t j = 0; j < len_pad; ++j) {
+            const dim_t off = vec_off(n, cb) + j;
+            if (j >= len) {
+                a_vec[off] = b_vec[off] = 0.f;
+                continue;
+            }
+            const dim_t c = cb * len + j;
+            const dim_t s_off = stat_d.off(n, c / CG);
+            const float inv_sqrtvar = 1.f / sqrtf(variance[s_off] + eps);
+            const float sm = (scale ? scale[ss_d.off(c)] : 1.f) * inv_sqrtvar;
+            const float sv = shift ? shift[ss_d.off(c)] : 0.f;
+            a_vec[off] = sm;
+            b_vec[off] = sv - mean[s_off] * sm;
+        }
+    });
+
+    parallel_nd(MB, nb, conf.nb_sp, [&](dim_t n, dim_t cb, dim_t spb) {
+        const dim_t sp = spb * conf.sp_blk;
+        jit_gnorm_call_params_t p;
+        p.src = src + (row_off(conf, src_d, n, cb) + sp * len) * src_dt_sz;
+        p.dst = dst + (row_off(conf, dst_d, n, cb) + sp * len) * dst_dt_sz;
+        p.a = a_vec + vec_off(n, cb);
+        p.b = b_vec + vec_off(n, cb);
+        p.nrows = nstl::min(conf.sp_blk, SP - sp);
+        (*apply_kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_bwd_t<isa>::pd_t::init(
+        engine_t *engine) {
+    const bool ok = mayiuse(isa) && is_bwd() && set_default_formats_common()
+            && data_types_ok(isa,
+                    {src_md()->data_type, diff_src_md()->data_type,
+                            diff_dst_md()->data_type})
+            && stat_md()->data_type == data_type::f32
+            && check_scale_shift_data_type() && attr()->has_default_values();
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf<isa>(conf_, this, {diff_src_md(), diff_dst_md()}));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_normalization_bwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t vec_sz = MB() * conf_.nb * conf_.len_pad;
+    scratchpad.template book<float>(
+            key_gnorm_reduction, 2 * vec_sz * conf_.nb_sp);
+    // The mean, a, b, d, sum(diff_dst) and sum(diff_dst * (src - mean))
+    // vectors and the two per-group sums.
+    scratchpad.template book<float>(
+            key_gnorm_coef, 6 * vec_sz + 2 * MB() * G());
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_bwd_t<isa>::init(engine_t *engine) {
+    using kernel_t = jit_gnorm_kernel_t<isa>;
+    const auto &conf = pd()->conf_;
+    const auto src_dt = pd()->src_md()->data_type;
+    const auto diff_src_dt = pd()->diff_src_md()->data_type;
+    const auto diff_dst_dt = pd()->diff_dst_md()->data_type;
+    CHECK(init_kernel<isa>(stats_kernel_, kernel_t::bwd_stats, conf.len,
+            src_dt, diff_dst_dt, data_type::undef));
+    return init_kernel<isa>(apply_kernel_, kernel_t::bwd_apply, conf.len,
+            src_dt, diff_dst_dt, diff_src_dt);
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_bwd_t<isa>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const auto &conf = pd()->conf_;
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+    const memory_desc_wrapper diff_ss_d(pd()->diff_weights_md());
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    auto diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
+    auto scale = pd()->use_scale() ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                                   : nullptr;
+    auto diff_src = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+    auto diff_scale = pd()->use_scale()
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status)
+            : nullptr;
+    CHECK(status);
+    auto diff_shift = pd()->use_shift()
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status)
+            : nullptr;
+    CHECK(status);
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t CG = pd()->C_per_group();
+    const dim_t SP = pd()->SP();
+    const float M = CG * SP;
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_diff_stats = !pd()->use_global_stats();
+    const dim_t len = conf.len, len_pad = conf.len_pad, nb = conf.nb;
+    const size_t src_dt_sz = src_d.data_type_size();
+    const size_t diff_src_dt_sz = diff_src_d.data_type_size();
+    const size_t diff_dst_dt_sz = diff_dst_d.data_type_size();
+
+    const dim_t vec_sz = MB * nb * len_pad;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *partial = scratchpad.template get<float>(key_gnorm_reduction);
+    float *coef = scratchpad.template get<float>(key_gnorm_coef);
+    float *mean_vec = coef, *a_vec = coef + vec_sz, *b_vec = coef + 2 * vec_sz,
+          *d_vec = coef + 3 * vec_sz, *s1_vec = coef + 4 * vec_sz,
+          *s2_vec = coef + 5 * vec_sz;
+    float *sum_dd_gamma = coef + 6 * vec_sz;
+    float *sum_dd_gamma_x = sum_dd_gamma + MB * G;
+    const auto vec_off = [&](dim_t n, dim_t cb) {
+        return (n * nb + cb) * len_pad;
+    };
+    const auto inv_sqrtvar = [&](dim_t n, dim_t g) {
+        return 1.f / sqrtf(variance[stat_d.off(n, g)] + eps);
+    };
+
+    parallel_nd(MB, nb, [&](dim_t n, dim_t cb) {
+        for (dim_t j = 0; j < len_pad; ++j) {
+            const dim_t g = (cb * len + j) / CG;
+            mean_vec[vec_off(n, cb) + j]
+                    = j < len ? mean[stat_d.off(n, g)] : 0.f;
+        }
+    });
+
+    // Per-channel sums of diff_dst and diff_dst * (src - mean) of an image.
+    float *partial1 = partial, *partial2 = partial + vec_sz * conf.nb_sp;
+    parallel_nd(MB, nb, conf.nb_sp, [&](dim_t n, dim_t cb, dim_t spb) {
+        const dim_t sp = spb * conf.sp_blk;
+        const dim_t acc_off = vec_off(n, cb) * conf.nb_sp + spb * len_pad;
+        jit_gnorm_call_params_t p;
+        p.src = src + (row_off(conf, src_d, n, cb) + sp * len) * src_dt_sz;
+        p.diff_dst = diff_dst
+                + (row_off(conf, diff_dst_d, n, cb) + sp * len)
+                        * diff_dst_dt_sz;
+        p.mean = mean_vec + vec_off(n, cb);
+        p.acc1 = partial1 + acc_off;
+        p.acc2 = partial2 + acc_off;
+        p.nrows = nstl::min(conf.sp_blk, SP - sp);
+        (*stats_kernel_)(&p);
+    });
+    parallel_nd(MB, nb, [&](dim_t n, dim_t cb) {
+        for (dim_t j = 0; j < len_pad; ++j) {
+            float s1 = 0, s2 = 0;
+            for (dim_t spb = 0; spb < conf.nb_sp; ++spb) {
+                const dim_t off
+                        = vec_off(n, cb) * conf.nb_sp + spb * len_pad + j;
+                s1 += partial1[off];
+                s2 += partial2[off];
+            }
+            s1_vec[vec_off(n, cb) + j] = s1;
+            s2_vec[vec_off(n, cb) + j] = s2;
+        }
+    });
+
+    const auto ch_off = [&](dim_t n, dim_t c) {
+        return vec_off(n, c / len) + c % len;
+    };
+
+    if (diff_scale || diff_shift) {
+        parallel_nd(C, [&](dim_t c) {
+            const dim_t g = c / CG;
+            float diff_gamma = 0, diff_beta = 0;
+            for (dim_t n = 0; n < MB; ++n) {
+                diff_gamma += s2_vec[ch_off(n, c)] * inv_sqrtvar(n, g);
+                diff_beta += s1_vec[ch_off(n, c)];
+            }
+            if (diff_scale) diff_scale[diff_ss_d.off(c)] = diff_gamma;
+            if (diff_shift) diff_shift[diff_ss_d.off(c)] = diff_beta;
+        });
+    }
+
+    parallel_nd(MB, G, [&](dim_t n, dim_t g) {
+        float dd_gamma = 0, dd_gamma_x = 0;
+        if (calculate_diff_stats) {
+            for (dim_t c = g * CG; c < (g + 1) * CG; ++c) {
+                const float gamma = scale ? scale[ss_d.off(c)] : 1.f;
+                dd_gamma += gamma * s1_vec[ch_off(n, c)];
+                dd_gamma_x += gamma * s2_vec[ch_off(n, c)];
+            }
+            dd_gamma_x *= inv_sqrtvar(n, g);
+        }
+        sum_dd_gamma[n * G + g] = dd_gamma;
+        sum_dd_gamma_x[n * G + g] = dd_gamma_x;
+    });
+
+    // diff_src = r * (gamma * diff_dst - A / M - (src - mean) * B * r / M)
+    // with r = 1 / sqrt(variance + eps), A = sum(gamma * diff_dst) and
+    // B = r * sum(gamma * diff_dst * (src - mean)) over the group.
+    parallel_nd(MB, nb, [&](dim_t n, dim_t cb) {
+        for (dim_t j = 0; j < len_pad; ++j) {
+            const dim_t off = vec_off(n, cb) + j;
+            if (j >= len) {
+                a_vec[off] = b_vec[off] = d_vec[off] = 0.f;
+                continue;
+            }
+            const dim_t c = cb * len + j;
+            const dim_t g = c / CG;
+            const float r = inv_sqrtvar(n, g);
+            const float gamma = scale ? scale[ss_d.off(c)] : 1.f;
+            const float A = sum_dd_gamma[n * G + g];
+            const float B = sum_dd_gamma_x[n * G + g];
+            a_vec[off] = r * gamma;
+            b_vec[off] = -r * r * B / M;
+            d_vec[off] = -r * A / M + r * r * B * mean[stat_d.off(n, g)] / M;
+        }
+    });
+
+    parallel_nd(MB, nb, conf.nb_sp, [&](dim_t n, dim_t cb, dim_t spb) {
+        const dim_t sp = spb * conf.sp_blk;
+        jit_gnorm_call_params_t p;
+        p.src = src + (row_off(conf, src_d, n, cb) + sp * len) * src_dt_sz;
+        p.diff_dst = diff_dst
+                + (row_off(conf, diff_dst_d, n, cb) + sp * len)
+                        * diff_dst_dt_sz;
+        p.dst = diff_src
+                + (row_off(conf, diff_src_d, n, cb) + sp * len)
+                        * diff_src_dt_sz;
+        p.a = a_vec + vec_off(n, cb);
+        p.b = b_vec + vec_off(n, cb);
+        p.d = d_vec + vec_off(n, cb);
+        p.nrows = nstl::min(conf.sp_blk, SP - sp);
+        (*apply_kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_group_normalization_fwd_t<avx512_core>;
+template struct jit_uni_group_normalization_fwd_t<avx2>;
+template struct jit_uni_group_normalization_bwd_t<avx512_core>;
+template struct jit_uni_group_normalization_bwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
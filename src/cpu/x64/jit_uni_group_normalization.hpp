@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The data of an image are processed as rows of `len` contiguous elements, a
+// row holding `len` consecutive channels of a spatial point: all the channels
+// for the channels-last layouts, a block of channels for the blocked ones.
+// The work is split between the threads by images, blocks of channels and
+// chunks of spatial points.
+struct jit_gnorm_conf_t {
+    bool is_blocked = false;
+    // Number of elements of a row, the same rounded up to the vector length
+    // and number of blocks of channels.
+    dim_t len = 0, len_pad = 0, nb = 0;
+    // Number of spatial points of a chunk and number of chunks.
+    dim_t sp_blk = 0, nb_sp = 0;
+};
+
+// Group normalization forward propagation.
+//
+// The per-channel sums over the chunks of spatial points are computed by a
+// JIT kernel and reduced to the statistics of the groups, first the mean,
+// then the variance around it. The normalization, the scale and the shift
+// are folded into y = a * x + b with per-channel a and b, which are applied
+// with the eltwise post-ops (e.g. SiLU) by a second kernel in one pass.
+template <cpu_isa_t isa>
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_gnorm_conf_t conf_;
+
+    private:
+        bool post_ops_ok() const;
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_generator> mean_kernel_;
+    std::unique_ptr<jit_generator> var_kernel_;
+    std::unique_ptr<jit_generator> apply_kernel_;
+};
+
+// Group normalization backward propagation.
+//
+// The per-channel sums of diff_dst and of diff_dst * (src - mean) are
+// computed by a JIT kernel. They give the diff of the scale and the shift
+// and fold the diff of the source into
+// diff_src = a * diff_dst + b * src + d with per-channel a, b and d, which
+// a second kernel applies in one pass.
+template <cpu_isa_t isa>
+struct jit_uni_group_normalization_bwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_gnorm_conf_t conf_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_generator> stats_kernel_;
+    std::unique_ptr<jit_generator> apply_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
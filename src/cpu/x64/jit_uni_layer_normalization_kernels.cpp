@@ -17,8 +17,10 @@
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
 #include "common/bfloat16.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -171,9 +173,10 @@ struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
     jit_stat_and_data_kernel_t(const layer_normalization_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, data_t *dst, const float *scale,
-            const float *shift, float *mean, float *var,
-            const size_t block_size) const override;
+    void operator()(const data_t *src, void *dst, const float *scale,
+            const float *shift, float *mean, float *var, const float *oscale,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+            const exec_ctx_t &ctx, const size_t block_size) const override;
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
@@ -181,6 +184,7 @@ private:
     jit_transfer_t<data_type> jit_transfer_;
     static constexpr int unroll_factor_ = 8;
     static constexpr int simd_w = data_type == bf16 ? 16 : 8;
+    static constexpr cpu_isa_t isa = data_type == bf16 ? avx512_core : avx2;
     using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
             Xbyak::Ymm>::type;
     using stat_and_data_kernel_t<data_type>::C_;
@@ -190,20 +194,30 @@ private:
     using stat_and_data_kernel_t<data_type>::save_stats_;
     using stat_and_data_kernel_t<data_type>::calculate_stats_;
     using stat_and_data_kernel_t<data_type>::eps_;
+    using stat_and_data_kernel_t<data_type>::dst_dt_;
+    using stat_and_data_kernel_t<data_type>::with_oscale_;
+    using stat_and_data_kernel_t<data_type>::with_postops_;
 
     struct ker_args_t {
         const data_t *src;
-        data_t *dst;
+        void *dst;
         const float *scale;
         const float *shift;
         const float *mean;
         const float *var;
         size_t block_size;
         float eps;
+        const float *oscale;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig;
     };
 
     void generate() override;
 
+    void init_post_ops_injector(const layer_normalization_pd_t *pd);
+    void apply_post_ops(int nelems, size_t offt_elems);
+    void store_dst(int nelems, size_t offt_elems);
+
     template <typename F>
     void compute(F op);
 
@@ -219,7 +233,15 @@ private:
     const Xbyak::Reg64 reg_eps = r10;
     const Xbyak::Reg64 reg_tmp = r11;
     const Xbyak::Reg64 reg_shift = r12;
-
+    const Xbyak::Reg64 reg_po_helper_1 = r13;
+    const Xbyak::Reg64 reg_po_helper_2 = r14;
+
+    // Vmm(0) to Vmm(7) are the accumulators of the statistics, the ones
+    // below only live while the destination is computed.
+    Vmm vmm_po_helper = Vmm(4);
+    Vmm vmm_saturation_lbound = Vmm(5);
+    Vmm vmm_saturation_ubound = Vmm(6);
+    Vmm vmm_oscale = Vmm(7);
     Vmm vmm_ones = Vmm(8);
     Vmm vmm_eps = Vmm(9);
     Vmm vmm_inv_sqrtvar = Vmm(10);
@@ -232,8 +254,20 @@ private:
 
     Xmm xmm_return_value = Xmm(0);
     Xmm xmm_tmp = Xmm(14);
+
+    // The channels tail is processed element by element.
+    const Opmask k_tail_mask = Opmask(2);
+    const Opmask k_eltwise_mask = Opmask(1);
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa, Vmm>>
+            postops_injector_;
+    std::unique_ptr<io::jit_io_helper_t<Vmm>> io_store_;
 };
 
+// The isa is bound to a reference by the io helper.
+template <data_type_t data_type>
+constexpr cpu_isa_t jit_stat_and_data_kernel_t<data_type>::isa;
+
 template <data_type_t data_type>
 jit_stat_and_data_kernel_t<data_type>::jit_stat_and_data_kernel_t(
         const layer_normalization_pd_t *pd)
@@ -241,12 +275,23 @@ jit_stat_and_data_kernel_t<data_type>::jit_stat_and_data_kernel_t(
     , jit_generator(jit_name())
     , jit_transfer_ {*this} {
     assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+    if (utils::one_of(dst_dt_, s8, u8))
+        io_store_ = utils::make_unique<io::jit_io_helper_t<Vmm>>(this, isa,
+                dst_dt_, io::io_conf_t {},
+                io::io_tail_conf_t {simd_w, 1, k_tail_mask,
+                        vmm_po_helper.getIdx(), reg_tmp},
+                utils::nullopt,
+                io::io_saturation_conf_t {vmm_saturation_lbound.getIdx(),
+                        vmm_saturation_ubound.getIdx(), reg_tmp});
+    if (with_postops_) init_post_ops_injector(pd);
 }
 
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
-        data_t *dst, const float *scale, const float *shift, float *mean,
-        float *var, const size_t block_size) const {
+        void *dst, const float *scale, const float *shift, float *mean,
+        float *var, const float *oscale,
+        const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+        const exec_ctx_t &ctx, const size_t block_size) const {
     ker_args_t args;
     args.src = src;
     args.dst = dst;
@@ -256,16 +301,71 @@ void jit_stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
     args.block_size = block_size * C_ * types::data_type_size(data_type);
     args.eps = eps_;
     args.var = var;
+    args.oscale = oscale;
+    args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+    args.dst_orig = dst_orig;
     jit_generator::operator()(&args);
 }
 
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::init_post_ops_injector(
+        const layer_normalization_pd_t *pd) {
+    const memory_desc_wrapper dst_d(pd->dst_md());
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::no_broadcast};
+
+    const eltwise_injector::static_params_t esp(true /*save_state*/, reg_tmp,
+            k_eltwise_mask, true /*is_fwd*/, false /*use_dst*/);
+    const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+            static_cast<size_t>(vmm_po_helper.getIdx()), reg_po_helper_1,
+            reg_po_helper_2, false /*preserve gpr*/, false /*preserve vmm*/,
+            offsetof(ker_args_t, post_ops_binary_rhs_arg_vec),
+            offsetof(ker_args_t, dst_orig), dst_d, 1 /*tail_size*/,
+            k_tail_mask, false /*use_exact_tail_scalar_bcast*/};
+    const binary_injector::static_params_t bsp(
+            reg_param, supported_strategies, rhs_arg_bsp);
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<isa, Vmm>>(
+            this, pd->attr()->post_ops_, bsp, esp);
+}
+
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::apply_post_ops(
+        int nelems, size_t offt_elems) {
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+    rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_dst.getIdx(), reg_dst);
+    rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+            vmm_dst.getIdx(), offt_elems);
+    if (nelems < simd_w) rhs_arg_params.vmm_tail_idx_.emplace(vmm_dst.getIdx());
+    postops_injector_->compute_vector(vmm_dst.getIdx(), rhs_arg_params);
+}
+
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::store_dst(
+        int nelems, size_t offt_elems) {
+    if (io_store_) {
+        const auto dst_addr
+                = ptr[reg_dst + offt_elems * types::data_type_size(dst_dt_)];
+        io_store_->store(vmm_dst, dst_addr, nelems < simd_w);
+    } else
+        jit_transfer_.template store<data_type>(
+                vmm_dst, reg_dst, nelems, offt_elems);
+}
+
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::generate() {
     const auto c_size = C_ * types::data_type_size(data_type);
+    const auto dst_c_size = C_ * types::data_type_size(dst_dt_);
     static const auto float_size = types::data_type_size(f32);
 
     preamble();
     if (jit_transfer_.bf16_emu_) jit_transfer_.bf16_emu_->init_vcvtneps2bf16();
+    if (is_superset(isa, avx512_core) && (io_store_ || with_postops_)) {
+        mov(reg_tmp, 1);
+        kmovw(k_tail_mask, reg_tmp.cvt32());
+    }
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
     mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
@@ -299,8 +399,9 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             if (use_scale_) vmulps(vmm_data, vmm_data, vmm_gamma);
             if (use_shift_) vaddps(vmm_data, vmm_data, vmm_beta);
         }
-        jit_transfer_.template store<data_type>(
-                vmm_data, reg_dst, nelems, offt_elems);
+        if (with_oscale_) vmulps(vmm_data, vmm_data, vmm_oscale);
+        if (with_postops_) apply_post_ops(nelems, offt_elems);
+        store_dst(nelems, offt_elems);
     };
 
     // add block_start to block_size to define block_end
@@ -345,6 +446,13 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         vsqrtps(vmm_inv_sqrtvar, vmm_inv_sqrtvar);
         vdivps(vmm_inv_sqrtvar, vmm_ones, vmm_inv_sqrtvar);
 
+        // the registers below are clobbered by the statistics computation
+        if (with_oscale_) {
+            mov(reg_tmp, ptr[reg_param + offsetof(ker_args_t, oscale)]);
+            vbroadcastss(vmm_oscale, dword[reg_tmp]);
+        }
+        if (io_store_) io_store_->init_saturate_f32();
+
         // calculate dst
         for (int i = 0; i < C_vecs; i++)
             calculate_dst(simd_w, i * simd_w);
@@ -353,7 +461,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             calculate_dst(1, i);
 
         add(reg_src, c_size);
-        add(reg_dst, c_size);
+        add(reg_dst, dst_c_size);
         add(reg_mean, float_size);
         add(reg_var, float_size);
         jmp(unroll_loop);
@@ -361,6 +469,8 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     L(end);
 
     postamble();
+
+    if (postops_injector_) postops_injector_->prepare_table();
 }
 
 template <data_type_t data_type>
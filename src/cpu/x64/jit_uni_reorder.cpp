@@ -83,6 +83,7 @@ const size_t ker_prb_size_min = 64;
 /* kernel */
 struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_kernel_f32)
+    bool is_relocatable() const override { return true; }
 
     void operator()(const call_param_t *c) const override {
         jit_generator::operator()(c);
@@ -1484,6 +1485,7 @@ private:
 // Seperate class for no unroll/threading burden
 struct jit_single_blk_kernel_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_single_blk_kernel)
+    bool is_relocatable() const override { return true; }
     static bool applicable(const prb_t &p) {
         using namespace data_type;
 
@@ -1852,9 +1854,7 @@ kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
     return nullptr;
 }
 
-} // namespace tr
-
-static void prb_block_for_cache(tr::prb_t &prb) {
+void prb_block_for_cache(tr::prb_t &prb) {
     /* If strides for 0th and 1st nodes are cache friendly
      * then one can altogether do away with blocking ! */
     static constexpr int num_elems_thr = 16;
@@ -1933,8 +1933,7 @@ static void prb_block_for_cache(tr::prb_t &prb) {
 /** finds the maximum number of dimension the kernel should process and
  * optionally splits one of the dimension to achieve better balance between
  * parallel driver and the kernel. */
-static void prb_thread_kernel_balance(
-        tr::prb_t &prb, int &ndims_ker_max, int nthr) {
+void prb_thread_kernel_balance(tr::prb_t &prb, int &ndims_ker_max, int nthr) {
     size_t size_total = 1;
     for (int d = 0; d < prb.ndims; ++d)
         size_total *= prb.nodes[d].n;
@@ -2018,6 +2017,8 @@ static void prb_thread_kernel_balance(
     }
 }
 
+} // namespace tr
+
 status_t jit_uni_reorder_t::pd_t::init(
         engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
     CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
@@ -2054,7 +2055,7 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
     status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
     if (prb_init_status != status::success) return prb_init_status;
 
-    prb_block_for_cache(prb);
+    tr::prb_block_for_cache(prb);
     DEBUG({
         printf("cache: ");
         prb_dump(prb);
@@ -2062,7 +2063,7 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     int ndims_ker_max {};
     int nthr = dnnl_get_max_threads();
-    prb_thread_kernel_balance(prb, ndims_ker_max, nthr);
+    tr::prb_thread_kernel_balance(prb, ndims_ker_max, nthr);
 
     if (prb.is_tail_present) prb_node_dependency(prb);
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2021 Intel Corporation
+* Copyright 2018-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -149,6 +149,14 @@ void prb_node_move(prb_t &p, int d0, int d1);
 /** dumps the problem to stdout */
 void prb_dump(const prb_t &p);
 
+/** reorders the problem nodes for a better cache reuse */
+void prb_block_for_cache(prb_t &prb);
+
+/** finds the maximum number of dimension the kernel should process and
+ * optionally splits one of the dimension to achieve better balance between
+ * parallel driver and the kernel */
+void prb_thread_kernel_balance(prb_t &prb, int &ndims_ker_max, int nthr);
+
 struct call_param_t {
     const void *in = nullptr;
     void *out = nullptr;
@@ -24,9 +24,11 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/binary_injector_utils.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_uni_softmax.hpp"
 
 #if defined(__INTEL_COMPILER) && (__INTEL_COMPILER < 1900)
@@ -52,6 +54,8 @@ struct jit_softmax_base_t : public jit_generator {
         const void *interim; // scratch memory for intermediate storage
         const void *oscale; // oscale defined for all data type cases
         size_t process_n_elems;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig; // dst pointer of the whole tensor for post-ops
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
 
@@ -67,6 +71,8 @@ struct jit_softmax_base_t : public jit_generator {
     virtual void operator()(const call_params_t *p) = 0;
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> log_injector_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
+            postops_injector_;
 
     Reg64 reg_param = abi_param1;
 
@@ -85,8 +91,11 @@ struct jit_softmax_base_t : public jit_generator {
     Reg64 reg_interim = reg_diff_dst;
     Reg64 reg_interim_spat_offt = abi_not_param1;
     Reg64 reg_output_scale = rsi;
+    Reg64 reg_po_helper_1 = rdx;
+    Reg64 reg_po_helper_2 = rbp;
 
     Opmask injector_mask = Opmask(1);
+    Opmask tail_opmask = Opmask(2);
 
     Vmm vtmp; // assigned at placed where used
     Vmm tail_vmask = Vmm(0);
@@ -99,12 +108,14 @@ struct jit_softmax_base_t : public jit_generator {
     Vmm vsbr = vsum; // must be not equal to vmax
     Vmm vzero = Vmm(isa == avx512_core ? 21 : 11);
     Vmm vsaturation_ubound = vneg_flt_max;
+    Vmm vpo_helper = Vmm(isa == avx512_core ? 20 : 10);
 
     bool is_bf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
     bool axis_is_blocked_;
     bool need_scratchpad_;
+    bool with_postops_ = false;
 
     size_t simd_w_ = 0;
     size_t unroll_regs_ = 4;
@@ -249,6 +260,36 @@ struct jit_softmax_base_t : public jit_generator {
         }
     }
 
+    void init_post_ops_injector() {
+        static const bcast_set_t supported_strategies
+                = {broadcasting_strategy_t::scalar,
+                        broadcasting_strategy_t::no_broadcast};
+
+        const eltwise_injector::static_params_t esp(true /*save_state*/,
+                reg_tmp, injector_mask, true /*is_fwd*/, false /*use_dst*/);
+        const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+                static_cast<size_t>(vpo_helper.getIdx()), reg_po_helper_1,
+                reg_po_helper_2, false /*preserve gpr*/,
+                false /*preserve vmm*/,
+                offsetof(call_params_t, post_ops_binary_rhs_arg_vec),
+                offsetof(call_params_t, dst_orig), dst_d_, axis_simd_tail_,
+                tail_opmask, false /*use_exact_tail_scalar_bcast*/};
+        const binary_injector::static_params_t bsp(
+                reg_param, supported_strategies, rhs_arg_bsp);
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<isa>>(
+                this, pd_->attr()->post_ops_, bsp, esp);
+    }
+
+    // `vmm` holds the values to be stored at `dst_addr`.
+    void apply_post_ops(const Vmm &vmm, const Address &dst_addr, bool tail) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        rhs_arg_params.vmm_idx_to_out_addr.emplace(vmm.getIdx(), dst_addr);
+        if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm.getIdx());
+        postops_injector_->compute_vector(vmm.getIdx(), rhs_arg_params);
+    }
+
     virtual void prepare_tail_mask() = 0;
     virtual void get_horizontal_op(const Vmm &v, const Vmm &vtmp, op_t op) = 0;
     virtual void accumulate_vmax() = 0;
@@ -284,6 +325,7 @@ struct jit_softmax_base_t : public jit_generator {
         }
 
         compute_predefined_variables();
+        if (with_postops_) init_post_ops_injector();
         preamble();
         initialization_hook();
         if (exp_injector_) exp_injector_->load_table_addr();
@@ -297,6 +339,7 @@ struct jit_softmax_base_t : public jit_generator {
         postamble();
         if (exp_injector_) exp_injector_->prepare_table();
         if (log_injector_) log_injector_->prepare_table();
+        if (postops_injector_) postops_injector_->prepare_table();
     }
 
     jit_softmax_base_t(const softmax_pd_t *pd)
@@ -310,6 +353,7 @@ struct jit_softmax_base_t : public jit_generator {
         simd_w_ = vlen / sizeof(float); // bf16 works on ymms
         need_scratchpad_ = utils::one_of(
                 dst_d_.data_type(), data_type::u8, data_type::s8);
+        with_postops_ = pd_->is_fwd() && pd_->attr()->post_ops_.len() > 0;
     }
 };
 
@@ -327,8 +371,6 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
     Zmm bf16_emu_zmm_5 = Zmm(27);
     Reg64 bf16_emu_gpr = reg_tmp;
 
-    Opmask tail_opmask = Opmask(2);
-
     void store(const Address &addr, const Vmm &vmm, data_type_t dt,
             bool tail = false) {
         auto effective_addr = addr;
@@ -508,6 +550,9 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
                 Vmm vscale = vmax;
                 uni_vmovups(vscale, ptr[reg_output_scale]);
                 uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
+                if (with_postops_)
+                    apply_post_ops(
+                            vreg_tmp_src, dst_ptr(dst_axis_stride_ * i), tail);
                 store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
                         dst_d_.data_type(), tail);
             }
@@ -854,6 +899,9 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto scratchpad_ptr = ctx.get_scratchpad_grantor().template get<char>(
             memory_tracking::names::key_softmax_interim_store);
     const float *oscales = pd()->attr()->output_scales_.scales_;
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector_utils::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -882,6 +930,7 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                                                    : nullptr;
                 const auto *oscale_ptr = oscales;
                 softmax_driver_->exec(src_ptr, dst_ptr, interim_ptr, oscale_ptr,
+                        post_ops_binary_rhs_arg_vec.data(), dst,
                         process_n_elems);
             });
 
@@ -945,6 +994,7 @@ struct driver_t : public c_compatible {
     driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
 
     void exec(const void *src, void *dst, void *interim, const void *oscale,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
             const dim_t process_n_elems) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.process_n_elems = process_n_elems;
@@ -952,6 +1002,8 @@ struct driver_t : public c_compatible {
         p.dst = dst;
         p.interim = interim;
         p.oscale = oscale;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+        p.dst_orig = dst_orig;
         ker_(&p);
     }
 
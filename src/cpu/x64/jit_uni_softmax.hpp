@@ -27,6 +27,7 @@
 
 #include "cpu/cpu_softmax_pd.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 
 namespace dnnl {
@@ -82,9 +83,12 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                                     || utils::one_of(s8, src_dt, dst_dt)
                                     || utils::one_of(u8, src_dt, dst_dt)),
                             is_superset(isa, avx512_core))
-                    && attr()->has_default_values(skip_mask_t::oscale)
+                    && attr()->has_default_values(
+                            skip_mask_t::oscale | skip_mask_t::post_ops)
                     && attr_oscale_ok()
-                    && set_default_formats() == status::success;
+                    && set_default_formats() == status::success
+                    && attr_.set_default_formats(dst_md(0)) == status::success
+                    && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             ok = memory_desc_wrapper(src_md()).similar_to(
@@ -101,6 +105,24 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         int nthr_; // To not exceed the limit in execute used for set up.
 
     private:
+        bool post_ops_ok() const {
+            const auto &post_ops = attr()->post_ops_;
+            if (post_ops.len() == 0) return true;
+            // Only the avx512_core kernel applies post-ops.
+            if (!is_superset(isa, avx512_core)) return false;
+
+            const memory_desc_wrapper dst_d(dst_md());
+            static const bcast_set_t supported_strategies
+                    = {broadcasting_strategy_t::scalar,
+                            broadcasting_strategy_t::no_broadcast};
+            return injector::post_ops_ok(
+                    {isa, {injector::binary, injector::eltwise}, post_ops,
+                            &dst_d, false /*sum_at_pos_0_only*/,
+                            false /*sum_requires_scale_one*/,
+                            true /*sum_requires_zp_zero*/,
+                            supported_strategies});
+        }
+
         void init_scratchpad() {
             if (utils::one_of(
                         dst_md()->data_type, data_type::u8, data_type::s8)) {
@@ -17,6 +17,9 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <mutex>
+#include <unordered_map>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -78,6 +81,11 @@ struct brgemm_matmul_t : public primitive_t {
             return get_brg_kernel_index(bgmmc_, is_bs_tail, do_initialization,
                     is_M_tail, is_N_tail, is_K_tail, bs);
         }
+        // Initializes the descriptor of the kernel of the blocking of `bgmmc`
+        // for the tails given by the flags.
+        status_t init_brg_desc(brgemm_t &brg, const brgemm_matmul_conf_t &bgmmc,
+                bool is_bs_tail, bool do_initialization, bool is_M_tail,
+                bool is_N_tail, bool is_K_tail) const;
         const brgemm_t &get_brg_desc(int idx) const { return brg_descs_[idx]; }
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
@@ -98,11 +106,29 @@ struct brgemm_matmul_t : public primitive_t {
         return status::success;
     }
 
+    size_t get_resident_size() const override {
+        // The kernel descriptors and the AMX palettes are kept alongside the
+        // generated code.
+        return sizeof(*this) + sizeof(*pd()) + host_binaries_.code_size();
+    }
+
 private:
     struct brg_matmul_exec_ctx_t;
 
+    // The kernels for the tail of a runtime M, indexed as the kernels of the
+    // primitive.
+    struct m_tail_kernels_t {
+        std::unique_ptr<brgemm_kernel_t> kernels[max_num_brg_kernels_matmul];
+        char palettes[max_num_brg_kernels_matmul][64];
+    };
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
+    // Returns the kernels for the tail of the runtime M of `bgmmc`. They are
+    // generated on first use of every value of the tail and kept for the
+    // lifetime of the primitive.
+    status_t get_m_tail_kernels(const brgemm_matmul_conf_t &bgmmc,
+            const m_tail_kernels_t **m_tail_kernels) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
             int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
             bool do_init) const;
@@ -121,6 +147,10 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+
+    mutable std::mutex m_tail_kernels_mutex_;
+    mutable std::unordered_map<dim_t, std::unique_ptr<m_tail_kernels_t>>
+            m_tail_kernels_;
 };
 
 } // namespace matmul
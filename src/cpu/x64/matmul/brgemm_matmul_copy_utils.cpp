@@ -37,6 +37,7 @@ using namespace Xbyak;
 struct jit_brgemm_matmul_copy_a_impl_t : public jit_brgemm_matmul_copy_a_t,
                                          public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_impl_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_a_impl_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_a_t(conf)
@@ -419,6 +420,7 @@ struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
       public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_transposed_impl_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_a_transposed_impl_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_a_t(conf)
@@ -828,12 +830,12 @@ void jit_brgemm_matmul_copy_a_transposed_impl_t::generate() {
     }
 
     auto vmovdqa64 = [=](Zmm z, const int64_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
     auto vmovdqa32 = [=](Zmm z, const int32_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa32(z, ptr[imm_addr64]);
     };
 
@@ -950,6 +952,7 @@ void jit_brgemm_matmul_copy_a_transposed_impl_t::generate() {
 struct jit_brgemm_matmul_copy_b_int8_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_int8_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_b_int8_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf), jit_generator(jit_name()) {}
@@ -1223,7 +1226,7 @@ void jit_brgemm_matmul_copy_b_int8_t::generate() {
     mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
 
     auto vmovdqa64 = [=](Zmm z, const void *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
@@ -1430,6 +1433,7 @@ void jit_brgemm_matmul_copy_b_int8_t::generate() {
 struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_bf16_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_b_bf16_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
@@ -1565,7 +1569,7 @@ void jit_brgemm_matmul_copy_b_bf16_t::generate() {
 
     kxnorw(kFFFF, kFFFF, kFFFF); // 1111 1111 1111 1111
     auto vmovdqa64 = [=](Zmm z, const int64_t *addr) {
-        mov(imm_addr64, reinterpret_cast<size_t>(addr));
+        mov_host_addr(imm_addr64, reinterpret_cast<uintptr_t>(addr));
         jit_generator::vmovdqa64(z, ptr[imm_addr64]);
     };
 
@@ -1633,6 +1637,7 @@ void jit_brgemm_matmul_copy_b_bf16_t::generate() {
 struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
                                         public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_f32_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
@@ -1769,10 +1774,347 @@ void jit_brgemm_matmul_copy_b_f32_t::generate() {
     postamble();
 }
 
+// Ymm flavor of jit_brgemm_matmul_copy_b_f32_t. There are no opmasks on avx2,
+// so the N tail is loaded with load_bytes() into a zeroed register.
+struct jit_avx2_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
+                                             public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_brgemm_matmul_copy_b_f32_t)
+    bool is_relocatable() const override { return true; }
+
+    jit_avx2_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_b_t(conf)
+        , jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx2)
+        , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
+                                             : conf_->N * typesize)
+        , tr_src_stride_(conf_->LDB * typesize) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using ymm = const Xbyak::Ymm;
+
+    enum { typesize = sizeof(float), n_blk_step = 8, max_regs_available = 15 };
+    dim_t src_stride_, tr_src_stride_;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+
+    reg64_t reg_K_iters = r8;
+    reg64_t reg_N_blk = r9;
+
+    ymm ymm_zero = ymm15;
+
+    void copy_n_x_8_block(int nrows, int ncolumns);
+    void compute_k_loop(int ncolumns);
+    void generate() override;
+};
+
+void jit_avx2_brgemm_matmul_copy_b_f32_t::copy_n_x_8_block(
+        int nrows, int ncolumns) {
+    int iter = 0;
+    for_(int k = 0; k < nrows; k++)
+    for (int n = 0; n < conf_->wei_n_blk; n += n_blk_step) {
+        const dim_t tr_src_off = k * tr_src_stride_ + n * typesize;
+        const auto store_addr = ptr[reg_tr_src + tr_src_off];
+
+        const int zero_padding = ncolumns - n;
+        if (zero_padding <= 0) {
+            vmovups(store_addr, ymm_zero);
+            continue;
+        }
+
+        const auto src_ymm = ymm(iter % max_regs_available);
+        const dim_t src_off = k * src_stride_ + n * typesize;
+        if (zero_padding < n_blk_step) {
+            uni_vpxor(src_ymm, src_ymm, src_ymm);
+            load_bytes(src_ymm, reg_src, src_off, zero_padding * typesize);
+        } else
+            vmovups(src_ymm, ptr[reg_src + src_off]);
+
+        vmovups(store_addr, src_ymm);
+        iter++;
+    }
+}
+
+void jit_avx2_brgemm_matmul_copy_b_f32_t::compute_k_loop(int ncolumns) {
+
+    auto compute_uni_k_loop = [&](int unroll) {
+        Label K_start_label, K_end_label;
+
+        L(K_start_label);
+        cmp(reg_K_iters, unroll);
+        jl(K_end_label, T_NEAR);
+
+        copy_n_x_8_block(unroll, ncolumns);
+        add(reg_src, unroll * src_stride_);
+        add(reg_tr_src, unroll * tr_src_stride_);
+
+        sub(reg_K_iters, unroll);
+        jmp(K_start_label, T_NEAR);
+
+        L(K_end_label);
+    };
+
+    constexpr int k_unroll = 8;
+    compute_uni_k_loop(k_unroll);
+    compute_uni_k_loop(1);
+}
+
+void jit_avx2_brgemm_matmul_copy_b_f32_t::generate() {
+    preamble();
+    uni_vpxor(ymm_zero, ymm_zero, ymm_zero);
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_K_iters, ptr[param1 + GET_OFF(current_K_iters)]);
+    mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
+
+    Label done;
+    if (conf_->N_tail > 0) {
+        Label not_N_tail;
+        cmp(reg_N_blk, conf_->N_tail);
+        jne(not_N_tail, T_NEAR);
+        compute_k_loop(conf_->N_tail);
+        jmp(done, T_NEAR);
+
+        L(not_N_tail);
+    }
+
+    compute_k_loop(conf_->N_blk);
+    L(done);
+
+    postamble();
+}
+
+// Ymm flavor of jit_brgemm_matmul_copy_b_int8_t. Every 4 rows x 8 columns of B
+// are interleaved into one Ymm with unpack instructions, and the compensation
+// is accumulated with the VEX encoded vpdpbusd.
+struct jit_avx2_vnni_brgemm_matmul_copy_b_int8_t
+    : public jit_brgemm_matmul_copy_b_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_vnni_brgemm_matmul_copy_b_int8_t)
+    bool is_relocatable() const override { return true; }
+
+    jit_avx2_vnni_brgemm_matmul_copy_b_int8_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_b_t(conf)
+        , jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx2_vnni)
+        , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
+                                             : conf_->N * typesize)
+        , tr_src_stride_(conf_->LDB * k_blk_step * typesize)
+        , do_compute_compensation_(conf_->s8s8_compensation_required
+                  || conf_->has_zero_point_a) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using xmm = const Xbyak::Xmm;
+    using ymm = const Xbyak::Ymm;
+
+    enum {
+        typesize = sizeof(int8_t),
+        k_blk_step = 4,
+        n_blk_step = 8,
+        max_comp_accs = 8
+    };
+    dim_t src_stride_, tr_src_stride_;
+    bool do_compute_compensation_;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_comp_ptr = rdx;
+    reg64_t reg_zp_comp_ptr = r11;
+    reg64_t reg_zp_a_neg_val_ptr = r12;
+
+    reg64_t reg_K_iters = r8;
+    reg64_t reg_N_blk = r9;
+    reg64_t reg_K_start = r10;
+    reg64_t imm_addr64 = r15;
+
+    ymm ymm_comp_mul = ymm14;
+    ymm ymm_zero = ymm15;
+
+    // Ymm(0) - Ymm(5) hold the rows being interleaved.
+    Xbyak::Ymm get_comp_acc(int i) {
+        assert(i >= 0 && i < max_comp_accs);
+        return Xbyak::Ymm(6 + i);
+    }
+    void copy_4x8_vnni(
+            int nrows, int ncolumns, dim_t src_off, dim_t tr_src_off);
+    void copy_4_x_n_block(int nrows, int ncolumns);
+    void generate() override;
+};
+
+void jit_avx2_vnni_brgemm_matmul_copy_b_int8_t::copy_4x8_vnni(
+        int nrows, int ncolumns, dim_t src_off, dim_t tr_src_off) {
+    assert(nrows > 0 && nrows <= k_blk_step);
+    assert(ncolumns > 0 && ncolumns <= n_blk_step);
+
+    for (int i = 0; i < k_blk_step; i++) {
+        const auto row = xmm(i);
+        uni_vpxor(row, row, row);
+        if (i < nrows)
+            load_bytes(row, reg_src, i * src_stride_ + src_off,
+                    ncolumns * typesize);
+    }
+
+    // b0 b1 b2 b3 of every column are stored contiguously
+    vpunpcklbw(xmm(4), xmm(0), xmm(1));
+    vpunpcklbw(xmm(5), xmm(2), xmm(3));
+    vpunpcklwd(xmm(0), xmm(4), xmm(5));
+    vpunpckhwd(xmm(1), xmm(4), xmm(5));
+    vinserti128(ymm(0), ymm(0), xmm(1), 1);
+
+    vmovups(ptr[reg_tr_src + tr_src_off], ymm(0));
+}
+
+void jit_avx2_vnni_brgemm_matmul_copy_b_int8_t::copy_4_x_n_block(
+        int nrows, int ncolumns) {
+    for (int n = 0; n < conf_->wei_n_blk; n += n_blk_step) {
+        const dim_t tr_src_off = n * k_blk_step * typesize;
+        const int columns = nstl::min(ncolumns - n, (int)n_blk_step);
+        if (columns <= 0) {
+            vmovups(ptr[reg_tr_src + tr_src_off], ymm_zero);
+            continue;
+        }
+
+        copy_4x8_vnni(nrows, columns, n * typesize, tr_src_off);
+        if (do_compute_compensation_)
+            vpdpbusd(get_comp_acc(n / n_blk_step), ymm_comp_mul, ymm(0),
+                    Xbyak::VexEncoding);
+    }
+}
+
+void jit_avx2_vnni_brgemm_matmul_copy_b_int8_t::generate() {
+    preamble();
+    uni_vpxor(ymm_zero, ymm_zero, ymm_zero);
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_K_iters, ptr[param1 + GET_OFF(current_K_iters)]);
+    mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
+
+    const int n_iters = div_up(conf_->wei_n_blk, n_blk_step);
+    assert(n_iters <= max_comp_accs);
+    if (do_compute_compensation_) {
+        for (int i = 0; i < n_iters; i++)
+            uni_vpxor(get_comp_acc(i), get_comp_acc(i), get_comp_acc(i));
+        mov(imm_addr64, 1);
+        vmovd(Xbyak::Xmm(ymm_comp_mul.getIdx()), imm_addr64.cvt32());
+        vpbroadcastb(ymm_comp_mul, Xbyak::Xmm(ymm_comp_mul.getIdx()));
+    }
+
+    auto compute_K_loop = [=](bool is_N_tail) {
+        const int ncolumns = is_N_tail ? conf_->N_tail : conf_->N_blk;
+
+        Label K_loop, K_loop_tail_or_done;
+        L(K_loop);
+        cmp(reg_K_iters, k_blk_step);
+        jl(K_loop_tail_or_done, T_NEAR);
+
+        copy_4_x_n_block(k_blk_step, ncolumns);
+        add(reg_src, k_blk_step * src_stride_);
+        add(reg_tr_src, tr_src_stride_);
+
+        sub(reg_K_iters, k_blk_step);
+        jmp(K_loop, T_NEAR);
+
+        L(K_loop_tail_or_done);
+
+        const int k_blk_tail = conf_->K % k_blk_step;
+        if (k_blk_tail > 0) {
+            Label K_loop_done;
+            cmp(reg_K_iters, 0);
+            jle(K_loop_done, T_NEAR);
+
+            copy_4_x_n_block(k_blk_tail, ncolumns);
+            sub(reg_K_iters, k_blk_tail);
+            L(K_loop_done);
+        }
+    };
+
+    Label done;
+    if (conf_->N_tail > 0) {
+        Label not_N_tail;
+        cmp(reg_N_blk, conf_->N_tail);
+        jne(not_N_tail, T_NEAR);
+        compute_K_loop(true);
+        jmp(done, T_NEAR);
+
+        L(not_N_tail);
+    }
+
+    compute_K_loop(false);
+    L(done);
+
+    if (do_compute_compensation_) {
+        const bool req_s8s8_comp = conf_->s8s8_compensation_required;
+        const bool req_zp_comp = conf_->has_zero_point_a;
+        assert(IMPLICATION(req_zp_comp,
+                conf_->src_zp_type == brgemm_broadcast_t::per_tensor));
+
+        const auto ymm_s8s8_res = ymm(0);
+        const auto ymm_zp_res = ymm(1);
+        const auto ymm_zp_a_neg_val = ymm(2);
+
+        if (req_s8s8_comp)
+            mov(reg_comp_ptr, ptr[param1 + GET_OFF(compensation_ptr)]);
+        if (req_zp_comp) {
+            mov(reg_zp_comp_ptr, ptr[param1 + GET_OFF(zp_a_compensation_ptr)]);
+            mov(reg_zp_a_neg_val_ptr,
+                    ptr[param1 + GET_OFF(zp_a_neg_value_ptr)]);
+            vbroadcastss(ymm_zp_a_neg_val, ptr[reg_zp_a_neg_val_ptr]);
+        }
+        mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
+
+        // Unlike the avx512 kernel there are not enough registers to keep
+        // all the results, so finalize the accumulators one at a time.
+        for (int i = 0; i < n_iters; i++) {
+            const auto ymm_acc = get_comp_acc(i);
+            const dim_t comp_off = i * n_blk_step * sizeof(int32_t);
+            Label skip_acc, store;
+
+            if (req_s8s8_comp) vmovups(ymm_s8s8_res, ymm_acc);
+            if (req_zp_comp) vmovups(ymm_zp_res, ymm_acc);
+
+            cmp(reg_K_start, 0);
+            je(skip_acc, T_NEAR);
+            if (req_s8s8_comp)
+                vpaddd(ymm_s8s8_res, ymm_s8s8_res,
+                        ptr[reg_comp_ptr + comp_off]);
+            if (req_zp_comp)
+                vpaddd(ymm_zp_res, ymm_zp_res, ptr[reg_zp_comp_ptr + comp_off]);
+
+            L(skip_acc);
+            cmp(reg_K_start, rnd_up(conf_->K, conf_->K_blk) - conf_->K_blk);
+            jl(store, T_NEAR);
+
+            if (req_s8s8_comp) {
+                // multiply by 128 and change sign
+                vpslld(ymm_s8s8_res, ymm_s8s8_res, 7);
+                vpsubd(ymm_s8s8_res, ymm_zero, ymm_s8s8_res);
+            }
+            if (req_zp_comp) vpmulld(ymm_zp_res, ymm_zp_res, ymm_zp_a_neg_val);
+
+            L(store);
+            if (req_s8s8_comp)
+                vmovups(ptr[reg_comp_ptr + comp_off], ymm_s8s8_res);
+            if (req_zp_comp)
+                vmovups(ptr[reg_zp_comp_ptr + comp_off], ymm_zp_res);
+        }
+    }
+
+    postamble();
+}
+
 struct jit_brgemm_matmul_copy_b_transposed_t
     : public jit_brgemm_matmul_copy_b_t,
       public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_transposed_t)
+    bool is_relocatable() const override { return true; }
 
     jit_brgemm_matmul_copy_b_transposed_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
@@ -2277,11 +2619,19 @@ status_t create_brgemm_matmul_copy_b(
             CHECK(safe_ptr_assign(
                     copy_ker, new jit_brgemm_matmul_copy_b_bf16_t(conf)));
         } else if (is_f32) {
-            CHECK(safe_ptr_assign(
-                    copy_ker, new jit_brgemm_matmul_copy_b_f32_t(conf)));
+            if (conf->isa == avx2)
+                CHECK(safe_ptr_assign(copy_ker,
+                        new jit_avx2_brgemm_matmul_copy_b_f32_t(conf)));
+            else
+                CHECK(safe_ptr_assign(
+                        copy_ker, new jit_brgemm_matmul_copy_b_f32_t(conf)));
         } else {
-            CHECK(safe_ptr_assign(
-                    copy_ker, new jit_brgemm_matmul_copy_b_int8_t(conf)));
+            if (conf->isa == avx2_vnni)
+                CHECK(safe_ptr_assign(copy_ker,
+                        new jit_avx2_vnni_brgemm_matmul_copy_b_int8_t(conf)));
+            else
+                CHECK(safe_ptr_assign(
+                        copy_ker, new jit_brgemm_matmul_copy_b_int8_t(conf)));
         }
     }
 
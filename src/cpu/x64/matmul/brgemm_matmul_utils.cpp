@@ -65,6 +65,10 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
 
     const auto &post_ops = attr.post_ops_;
     const auto ndims = dst_d.ndims();
+    // The binary post-ops locate the elements of the destination by their
+    // offset from its origin, which does not match the logical offset if the
+    // rows of the destination are further apart than N.
+    const bool is_dst_strided = dst_d.is_blocking_desc() && !dst_d.is_dense();
 
     bool is_binary_po_per_oc_sp_bcast {};
     bool is_binary_po_channel_bcast {};
@@ -87,30 +91,37 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
             && IMPLICATION(
                     is_binary_po_per_w_bcast, utils::one_of(ndims, 3, 4));
     return supported_binary_bcast
-            && injector::post_ops_ok(post_ops_ok_args_t(get_max_cpu_isa(),
+            && injector::post_ops_ok(post_ops_ok_args_t(
+                    is_superset(bgmmc.isa, avx512_core) ? get_max_cpu_isa()
+                                                        : avx2,
                     {sum, eltwise, binary}, post_ops, &dst_d,
                     false /*sum_at_pos_0_only*/,
                     false /*sum_requires_scale_one*/,
                     false /*sum_requires_zp_zero*/,
-                    {broadcasting_strategy_t::per_oc,
-                            broadcasting_strategy_t::per_oc_spatial,
-                            broadcasting_strategy_t::scalar,
-                            broadcasting_strategy_t::per_mb_spatial,
-                            broadcasting_strategy_t::per_mb_w,
-                            broadcasting_strategy_t::per_w,
-                            broadcasting_strategy_t::no_broadcast}));
+                    is_dst_strided
+                            ? bcast_set_t {broadcasting_strategy_t::per_oc,
+                                    broadcasting_strategy_t::scalar}
+                            : bcast_set_t {broadcasting_strategy_t::per_oc,
+                                    broadcasting_strategy_t::per_oc_spatial,
+                                    broadcasting_strategy_t::scalar,
+                                    broadcasting_strategy_t::per_mb_spatial,
+                                    broadcasting_strategy_t::per_mb_w,
+                                    broadcasting_strategy_t::per_w,
+                                    broadcasting_strategy_t::no_broadcast}));
 }
 
 status_t check_isa_with_datatype(
         const cpu_isa_t isa, const brgemm_matmul_conf_utils_t &bm_conf_utils) {
     const bool ok = IMPLICATION(bm_conf_utils.is_f32(),
-                            isa == avx512_core || bm_conf_utils.is_bf32())
+                            one_of(isa, avx512_core, avx2)
+                                    || bm_conf_utils.is_bf32())
             && IMPLICATION(bm_conf_utils.is_int8(),
-                    one_of(isa, avx512_core_bf16_amx_int8, avx512_core_vnni))
+                    one_of(isa, avx512_core_bf16_amx_int8, avx512_core_vnni,
+                            avx2_vnni))
             && IMPLICATION(bm_conf_utils.is_bf16(),
                     one_of(isa, avx512_core_bf16_amx_bf16, avx512_core_bf16))
             && IMPLICATION(bm_conf_utils.is_int8_with_bf16_dst(),
-                    mayiuse(avx512_core_vnni));
+                    isa != avx2_vnni && mayiuse(avx512_core_vnni));
     return ok ? status::success : status::unimplemented;
 }
 
@@ -192,6 +203,22 @@ status_t brgemm_matmul_conf_utils_t::update_and_check_B_tag(
     return set_or_check_B_tag(B_md, false);
 }
 
+// Returns true for a plain tensor with dense batch dimensions and rows, the
+// rows being possibly further apart than the length of a row.
+bool is_plain_with_strided_rows(const memory_desc_t &md) {
+    const memory_desc_wrapper mdw(md);
+    if (!mdw.is_plain() || mdw.has_runtime_dims_or_strides()) return false;
+
+    const int ndims = mdw.ndims();
+    const auto &dims = mdw.dims();
+    const auto &strides = mdw.blocking_desc().strides;
+    if (strides[ndims - 1] != 1 || strides[ndims - 2] < dims[ndims - 1])
+        return false;
+    for (int d = ndims - 3; d >= 0; --d)
+        if (strides[d] != strides[d + 1] * dims[d + 1]) return false;
+    return true;
+}
+
 status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
         memory_desc_t &C_md, memory_desc_t &bias_md) const {
     if (A_any_layout) {
@@ -213,6 +240,11 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
     } else {
         bgmmc.dst_tag = memory_desc_matches_one_of_tag(
                 C_md, plain_tensor_layout_tag, acbd);
+        // The rows of a plain destination may be further apart than N, e.g.
+        // if the destination is the image of a source in a concat along N.
+        if (bgmmc.dst_tag == format_tag::undef
+                && is_plain_with_strided_rows(C_md))
+            bgmmc.dst_tag = plain_tensor_layout_tag;
     }
 
     if (one_of(format_tag::undef, bgmmc.src_tag, bgmmc.dst_tag))
@@ -513,7 +545,9 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
             = div_up(static_cast<int>(bgmmc.K), min_k_per_thread);
     const bool is_amx_bf16
             = bgmmc.isa == avx512_core_bf16_amx_bf16; // note: also bf32
-    const int max_nthr_k = is_amx_bf16 && bgmmc.batch == 1
+    // Note: the reduction buffers of parallel K depend on M
+    const int max_nthr_k
+            = is_amx_bf16 && bgmmc.batch == 1 && !bgmmc.is_runtime_M
             ? nstl::min(saturate(1, 7, bgmmc.nthr / 8), max_k_parallel_work)
             : 1;
     int iter = 0;
@@ -760,6 +794,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.isa = isa;
     bgmmc.nthr = dnnl_get_max_threads();
     bgmmc.brg_type = brgemm_addr;
+    bgmmc.is_runtime_M = memory_desc_wrapper(&mmd.dst_desc).has_runtime_dims();
 
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
@@ -768,7 +803,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
     bgmmc.s8s8_compensation_required
-            = isa == avx512_core_vnni && bgmmc.src_dt == s8;
+            = one_of(isa, avx512_core_vnni, avx2_vnni) && bgmmc.src_dt == s8;
     bgmmc.ndims = dst_d.ndims();
 
     brgemm_matmul_conf_utils_t bm_conf_utils(bgmmc, isa, attr,
@@ -877,6 +912,16 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             || bgmmc.transposed_A || lda_is_big_2pow;
     bgmmc.use_buffer_a = is_copy_a_required;
 
+    // The copy routines for A and for transposed B are implemented for Zmm
+    // only.
+    if (one_of(isa, avx2, avx2_vnni)
+            && (bgmmc.use_buffer_a
+                    || (bgmmc.use_buffer_b
+                            && (bm_conf_utils.check_is_transposed(
+                                        bgmmc.wei_tag)
+                                    || bgmmc.wei_tag == adbc))))
+        return status::unimplemented;
+
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
     // show worse performance for it in comparison with copy whole A approach
@@ -919,15 +964,17 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     CHECK(bm_conf_utils.set_B_flags(weights_md));
 
-    bgmmc.M_tail = bgmmc.M % bgmmc.M_blk;
+    // The tail of a runtime M is known at execution only
+    bgmmc.M_tail = bgmmc.is_runtime_M ? 0 : bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.N % bgmmc.N_blk;
     bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
             ? rnd_up(bgmmc.K % bgmmc.K_blk, bgmmc.required_k_granularity)
             : 0;
 
     bgmmc.LDB = bm_conf_utils.get_actual_LDB();
-    bgmmc.LDD = bgmmc.dst_tag == acbd ? dst_d.blocking_desc().strides[2]
-                                      : bgmmc.N;
+    bgmmc.LDD = bgmmc.dst_tag == acbd
+            ? dst_d.blocking_desc().strides[2]
+            : dst_d.blocking_desc().strides[bgmmc.ndims - 2];
     bgmmc.LDC
             = bgmmc.use_buffer_c && bgmmc.nthr_k <= 1 ? bgmmc.N_blk : bgmmc.LDD;
 
@@ -1085,6 +1132,68 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 default_data_align);
 }
 
+format_tag_t get_plain_tag(int ndims) {
+    return utils::pick(ndims - 2, ab, abc, abcd, abcde, abcdef, abcdefg,
+            abcdefgh, abcdefghi, abcdefghij, abcdefghijk, abcdefghijkl);
+}
+
+bool runtime_M_ok(const memory_desc_t &src_md, const memory_desc_t &weights_md,
+        const memory_desc_t &dst_md, const memory_desc_t &bias_md) {
+    const int ndims = dst_md.ndims;
+    auto is_plain_with_runtime_M = [&](const memory_desc_t &md) -> bool {
+        if (md.ndims != ndims || md.format_kind != format_kind::blocked)
+            return false;
+        for (int d = 0; d < ndims; d++)
+            if (is_runtime_value(md.dims[d]) != (d == ndims - 2)) return false;
+        memory_desc_t plain_md = md;
+        return memory_desc_init_by_tag(plain_md, get_plain_tag(ndims))
+                == status::success
+                && plain_md == md;
+    };
+
+    return is_plain_with_runtime_M(src_md) && is_plain_with_runtime_M(dst_md)
+            && !memory_desc_wrapper(weights_md).has_runtime_dims_or_strides()
+            && !memory_desc_wrapper(bias_md).has_runtime_dims_or_strides();
+}
+
+status_t init_nominal_M_md(memory_desc_t &md) {
+    // Big enough for the heuristics to not shrink the M block: small values
+    // of M at execution are computed by a single tail block.
+    const dim_t nominal_M = 1024;
+    md.dims[md.ndims - 2] = nominal_M;
+    return memory_desc_init_by_tag(md, get_plain_tag(md.ndims));
+}
+
+status_t update_runtime_M_values(brgemm_matmul_conf_t &bgmmc,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d) {
+    const int m_idx = bgmmc.ndims - 2;
+    if (src_d.ndims() != bgmmc.ndims || dst_d.ndims() != bgmmc.ndims)
+        return status::invalid_arguments;
+
+    const dim_t M = dst_d.dims()[m_idx];
+    const bool shapes_ok = src_d.dims()[m_idx] == M
+            && src_d.dims()[m_idx + 1] == bgmmc.K
+            && dst_d.dims()[m_idx + 1] == bgmmc.N
+            && utils::array_product(dst_d.dims(), m_idx) == bgmmc.batch
+            && src_d.matches_tag(bgmmc.src_tag)
+            && dst_d.matches_tag(bgmmc.dst_tag);
+    if (!shapes_ok) return status::invalid_arguments;
+
+    bgmmc.M = M;
+    bgmmc.M_tail = bgmmc.M % bgmmc.M_blk;
+    bgmmc.M_chunks = div_up(bgmmc.M, bgmmc.M_chunk_elems);
+    bgmmc.num_M_blocks = div_up(bgmmc.M, bgmmc.M_blk);
+
+    const int dmax = nstl::min(bgmmc.ndims, 3);
+    for (int d = 0; d < dmax; d++) {
+        int dim = bgmmc.ndims - 1 - d;
+        bgmmc.A_strides[d] = bgmmc.a_dt_sz * src_d.blocking_desc().strides[dim];
+        bgmmc.C_strides[d] = bgmmc.c_dt_sz * dst_d.blocking_desc().strides[dim];
+    }
+
+    return status::success;
+}
+
 void matmul_amx_blocking_params_t::update_k_blocking_dependent_params() {
     k_chunk_elems_ = k_blk_ * k_chunk_size_;
     current_lda_ = get_actual_lda();
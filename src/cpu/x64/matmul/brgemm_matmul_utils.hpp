@@ -79,6 +79,10 @@ struct brgemm_matmul_bcast_desc_t {
 struct brgemm_matmul_conf_t {
     int ndims, batch_ndims;
     dim_t M, N, K, batch, batch_without_first_dim;
+    // M is defined at execution: the configuration is initialized for a
+    // nominal M and the values depending on M are updated at execution by
+    // update_runtime_M_values().
+    bool is_runtime_M;
     dim_t M_blk, N_blk, K_blk, M_tail, N_tail, K_tail;
     int M_chunk_size, N_chunk_size;
     dim_t LDA, LDB, LDC, LDD;
@@ -289,6 +293,20 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc);
 
+// Checks that M is the only dimension of the problem defined at execution
+// and that the source and destination are plain row-major.
+bool runtime_M_ok(const memory_desc_t &src_md, const memory_desc_t &weights_md,
+        const memory_desc_t &dst_md, const memory_desc_t &bias_md);
+
+// Replaces a runtime M of a plain source or destination by the nominal value
+// the blocking is chosen for.
+status_t init_nominal_M_md(memory_desc_t &md);
+
+// Updates the values depending on a runtime M for the source and destination
+// given at execution.
+status_t update_runtime_M_values(brgemm_matmul_conf_t &bgmmc,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d);
+
 } // namespace matmul
 } // namespace x64
 } // namespace cpu
@@ -269,6 +269,17 @@ x64::cpu_isa_t adjust_isa_by_m_block(
 
 } // namespace
 
+dim_t rnn_brgemm_base_t::amx_buffer_per_thr(
+        const cpu::rnn_utils::rnn_conf_t &rnn) {
+    return rnn.m_block * rnn.n_block;
+}
+
+dim_t rnn_brgemm_base_t::batch_per_thr(const cpu::rnn_utils::rnn_conf_t &rnn) {
+    return nstl::max(rnn.KB1_blocks + 1,
+                   nstl::max(rnn.KBproj_blocks + 1, rnn.KB2_blocks + 1))
+            * (rnn.brgemm_fwd_iter_layer_fuse_possible ? 2 : 1);
+}
+
 void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
         memory_tracking::registrar_t &scratchpad, dim_t gemm_acc_type_size,
         dim_t gemm_acc_align) {
@@ -276,17 +287,13 @@ void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
     using namespace memory_tracking::names;
 
     if (rnn.is_int8_amx() || rnn.is_bf16_amx()) {
-        size_t n_elements = rnn.m_block * rnn.n_block;
-        scratchpad.book(key_brgemm_primitive_buffer, rnn.nthr * n_elements,
-                gemm_acc_type_size, gemm_acc_align);
+        scratchpad.book(key_brgemm_primitive_buffer,
+                rnn.nthr * amx_buffer_per_thr(rnn), gemm_acc_type_size,
+                gemm_acc_align);
     }
 
-    const int max_K_Block
-            = nstl::max(rnn.KB1_blocks + 1,
-                      nstl::max(rnn.KBproj_blocks + 1, rnn.KB2_blocks + 1))
-            * (rnn.brgemm_fwd_iter_layer_fuse_possible ? 2 : 1);
     scratchpad.template book<x64::brgemm_batch_element_t>(
-            key_brgemm_primitive_batch, max_K_Block * rnn.nthr);
+            key_brgemm_primitive_batch, batch_per_thr(rnn) * rnn.nthr);
 }
 
 status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
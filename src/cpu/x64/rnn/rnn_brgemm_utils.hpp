@@ -50,6 +50,10 @@ struct rnn_brgemm_base_t {
     static void init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
             memory_tracking::registrar_t &scratchpad, dim_t gemm_acc_type_size,
             dim_t gemm_acc_align);
+    // Number of elements of the per-thread parts of the AMX accumulators
+    // buffer and of the batch buffer.
+    static dim_t amx_buffer_per_thr(const cpu::rnn_utils::rnn_conf_t &rnn);
+    static dim_t batch_per_thr(const cpu::rnn_utils::rnn_conf_t &rnn);
     static constexpr dim_t num_base_kernels_ = 3;
     static constexpr dim_t num_proj_kernels_ = 4;
     static constexpr dim_t num_vanilla_gru_iter_part2_kernels_ = 4;
@@ -1194,6 +1194,17 @@ public:
 	}
 	bool isAutoGrow() const { return type_ == AUTO_GROW; }
 	bool isCalledCalcJmpAddress() const { return isCalledCalcJmpAddress_; }
+	/*
+		call f(codeOffset, offsetFromTop, size) for each absolute address of
+		the code itself written by calcJmpAddress (AutoGrow mode only)
+	*/
+	template<class F>
+	void forEachAddTopAddr(F f) const
+	{
+		for (AddrInfoList::const_iterator i = addrInfoList_.begin(), ie = addrInfoList_.end(); i != ie; ++i) {
+			if (i->mode == inner::LaddTop) f(i->codeOffset, i->jmpAddr, i->jmpSize);
+		}
+	}
 	/**
 		change exec permission of memory
 		@param addr [in] buffer address
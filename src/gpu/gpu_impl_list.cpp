@@ -36,7 +36,8 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(eltwise);
             CASE(gemm);
             CASE(inner_product);
-            CASE(layer_normalization);
+            case primitive_kind::layer_normalization:
+            CASE(layer_normalization_v2);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
@@ -50,6 +51,8 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             case primitive_kind::softmax:
             CASE(softmax_v2);
             CASE(zero_pad);
+            case primitive_kind::group_normalization:
+            case primitive_kind::sdpa: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021 Intel Corporation
+* Copyright 2021-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -40,8 +40,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>>
 // clang-format on
 } // namespace
 
-const impl_list_item_t *get_layer_normalization_impl_list(
-        const layer_normalization_desc_t *desc) {
+const impl_list_item_t *get_layer_normalization_v2_impl_list(
+        const layer_normalization_v2_desc_t *desc) {
     static const impl_list_item_t empty_list[] = {nullptr};
 
     const bool is_fwd = utils::one_of(
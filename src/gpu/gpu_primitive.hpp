@@ -105,6 +105,15 @@ struct gpu_primitive_t : public primitive_t {
     }
 #endif
 
+    size_t get_resident_size() const override {
+        // Kernels that have already been handed over to the runtime do not
+        // report a binary size and are not accounted for.
+        size_t binaries_size = 0;
+        if (get_cache_blob_size(&binaries_size) != status::success)
+            binaries_size = 0;
+        return primitive_t::get_resident_size() + binaries_size;
+    }
+
     status_t get_cache_blob_size(size_t *size) const override {
         if (!size) return status::invalid_arguments;
         // Query binary size for each created kernel.
@@ -46,6 +46,7 @@ struct gen9_concat_t : public gpu_primitive_t {
 
         status_t init(engine_t *engine) {
             bool ok = n_inputs() <= 16 && attr()->has_default_values()
+                    && srcs_have_same_data_type()
                     && set_default_params() == status::success
                     && !memory_desc_ndims_ok(dst_md());
             if (!ok) return status::unimplemented;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -38,6 +38,7 @@ struct simple_concat_t : public gpu_primitive_t {
 
         status_t init(engine_t *engine) {
             bool ok = n_inputs() <= 30 && attr()->has_default_values()
+                    && srcs_have_same_data_type()
                     && set_default_params() == status::success;
             if (!ok) return status::unimplemented;
 
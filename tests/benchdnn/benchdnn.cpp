@@ -60,6 +60,8 @@ std::string driver_name;
 double max_ms_per_prb {3e3};
 int min_times_per_prb {5};
 int fix_times_per_prb {0};
+bool cold_cache {false};
+int num_streams {1};
 
 bool fast_ref_gpu {DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE};
 
@@ -118,6 +118,8 @@ bool is_bench_mode(bench_mode_t user_mode);
 extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
+extern bool cold_cache; /** rotate buffer copies to measure with cold caches */
+extern int num_streams; /** number of concurrent streams to measure with */
 
 extern bool fast_ref_gpu;
 extern bool allow_enum_tags_only;
@@ -431,10 +431,13 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         return;
     }
 
-    skip_unimplemented_data_type(
-            {prb->get_dt_conf(SRC).dt, prb->get_dt_conf(WEI).dt,
-                    prb->get_dt_conf(DST).dt},
-            prb->dir, res);
+    if (!is_cpu_f16_compute_supported(prb->get_dt_conf(SRC).dt,
+                prb->get_dt_conf(WEI).dt, prb->get_dt_conf(DST).dt,
+                prb->dir))
+        skip_unimplemented_data_type(
+                {prb->get_dt_conf(SRC).dt, prb->get_dt_conf(WEI).dt,
+                        prb->get_dt_conf(DST).dt},
+                prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res, prb->get_dt_conf(DST).dt);
 
     if (is_cpu()) {
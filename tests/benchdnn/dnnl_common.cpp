@@ -15,14 +15,23 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <atomic>
+#include <cstring>
 #include <functional> // for std::bind and std::placeholders
 #include <list>
 #include <string> // for std::string
+#include <thread>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 #include "oneapi/dnnl/dnnl_ocl.hpp"
@@ -160,8 +169,14 @@ lru_cache_t &get_test_cache() {
 
 int test_persistent_cache_api(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &prim,
         const benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> &pd, res_t *res) {
-    if (!is_gpu() || (is_gpu() && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
-        return OK;
+    if (is_gpu() && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL) return OK;
+
+    // On CPU a cache blob is provided only by implementations with
+    // relocatable JIT kernels.
+    if (is_cpu()) {
+        size_t size = 0;
+        if (dnnl_primitive_get_cache_blob(prim, &size, nullptr) != dnnl_success)
+            return OK;
     }
 
     // Start testing persistent cache API.
@@ -356,11 +371,104 @@ inline bool should_stop(const timer::timer_t &t) {
     return stop;
 }
 
+using dnnl_args_sets_t = std::vector<std::vector<dnnl_exec_arg_t>>;
+
+// Copies of the memories of a problem, in as many sets of execution arguments
+// as requested. A memory passed as several arguments, e.g. an in-place one,
+// is copied once per set.
+struct args_copies_t {
+    int init(const args_t &args, int n_sets) {
+        sets_.assign(n_sets, {});
+        for (auto &set : sets_) {
+            std::vector<const dnn_mem_t *> origs;
+            std::vector<dnnl_memory_t> copies;
+            for (int i = 0; i < args.size(); ++i) {
+                const dnn_mem_t &mem = args.dnn_mem(i);
+                const auto it = std::find(origs.begin(), origs.end(), &mem);
+                if (it != origs.end()) {
+                    set.push_back({args.arg(i), copies[it - origs.begin()]});
+                    continue;
+                }
+                // The descriptors are the same, so are the bytes to copy.
+                dnn_mem_t copy(mem.md_, mem.engine());
+                if (mem.size() > 0) {
+                    if (!mem.is_mapped()) mem.map();
+                    std::memcpy((void *)copy, (void *)mem, mem.size());
+                }
+                copy.unmap();
+                origs.push_back(&mem);
+                copies.push_back(copy.m_);
+                set.push_back({args.arg(i), copy.m_});
+                mems_.push_back(std::move(copy));
+            }
+        }
+        return OK;
+    }
+
+    const dnnl_args_sets_t &sets() const { return sets_; }
+
+private:
+    std::list<dnn_mem_t> mems_;
+    dnnl_args_sets_t sets_;
+};
+
+// Returns the number of copies of the memories of a problem to rotate through
+// so that the memories of an iteration are evicted from the last level cache
+// by the time they are used again.
+static int get_cold_cache_n_sets(const args_t &args) {
+    size_t llc_size = 0;
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    const long l3_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3_size > 0) llc_size = (size_t)l3_size;
+#endif
+    // A reasonable upper bound when the system does not report it.
+    if (llc_size == 0) llc_size = 64 * 1024 * 1024;
+    // The cache of every socket is reported, twice the size of the caches of
+    // two sockets is rotated through.
+    const size_t cold_size = 4 * llc_size;
+
+    size_t args_size = 0;
+    for (int i = 0; i < args.size(); ++i)
+        args_size += args.dnn_mem(i).size();
+    if (args_size == 0) return 1;
+
+    const int64_t max_n_sets = 1024;
+    return (int)MIN2(max_n_sets, div_up(cold_size, args_size) + 1);
+}
+
+// The CPUs the process is allowed to run on.
+static std::vector<int> get_allowed_cpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+#endif
+    if (cpus.empty())
+        for (int cpu = 0; cpu < (int)std::thread::hardware_concurrency(); cpu++)
+            cpus.push_back(cpu);
+    return cpus;
+}
+
+// Binds the calling thread, and the threads it creates afterwards, to the
+// CPUs [first, first + n) of `cpus`.
+static void bind_thread(const std::vector<int> &cpus, int first, int n) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int i = first; i < MIN2(first + n, (int)cpus.size()); i++)
+        CPU_SET(cpus[i], &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
 inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, const dnnl_args_sets_t &dnnl_args) {
     t.reset();
-    while (true) {
-        DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+    for (size_t i = 0;; i = (i + 1) % dnnl_args.size()) {
+        DNN_SAFE(perf_func(stream, dnnl_args[i]), WARN);
         t.stamp();
         if (should_stop(t)) break;
     }
@@ -368,12 +476,12 @@ inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
 }
 
 inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, const dnnl_args_sets_t &dnnl_args) {
     const int max_batch_times = 10000;
 
     // Warm-up run, this is not measured due to possibility the associated
     // kernel has not been built and skews the results.
-    DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+    DNN_SAFE(perf_func(stream, dnnl_args[0]), WARN);
     DNN_SAFE(dnnl_stream_wait(stream), WARN);
 
     int cur_batch_times
@@ -383,9 +491,11 @@ inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
     maybe_reset_profiling();
 
     bool is_first_loop = true;
+    size_t i_set = 0;
     while (true) {
         for (int i = 0; i < cur_batch_times; i++) {
-            DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+            DNN_SAFE(perf_func(stream, dnnl_args[i_set]), WARN);
+            i_set = (i_set + 1) % dnnl_args.size();
         }
         DNN_SAFE(dnnl_stream_wait(stream), WARN);
 
@@ -411,22 +521,97 @@ inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
     return OK;
 }
 
+// Runs `num_streams` streams concurrently, each on its own subset of the
+// CPUs with its own sets of arguments, until each of them meets the stop
+// criterion. The perf timer accumulates the iterations of all the streams,
+// and the wall timer the duration of the whole run.
+static int measure_perf_multi_stream(res_t *res, perf_function_t &perf_func,
+        const dnnl_args_sets_t &dnnl_args) {
+    const auto &engine = get_test_engine();
+    const int n_streams = num_streams;
+    const int n_sets = (int)dnnl_args.size() / n_streams;
+
+    const auto cpus = get_allowed_cpus();
+    const int n_cpus = MAX2(1, (int)cpus.size() / n_streams);
+
+    std::vector<timer::timer_t> timers(n_streams);
+    std::vector<int> rets(n_streams, OK);
+    std::atomic<int> n_ready(0);
+    std::atomic<bool> go(false);
+
+    auto run = [&](int i) {
+        bind_thread(cpus, i * n_cpus, n_cpus);
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+        omp_set_num_threads(n_cpus);
+#endif
+        stream_t stream(engine);
+        const dnnl_args_sets_t stream_args(dnnl_args.begin() + i * n_sets,
+                dnnl_args.begin() + (i + 1) * n_sets);
+
+        // Warm-up run to create the threads of the stream.
+        if (perf_func(stream, stream_args[0]) != dnnl_success) rets[i] = FAIL;
+        n_ready++;
+        while (!go)
+            std::this_thread::yield();
+        if (rets[i] != OK) return;
+        rets[i] = measure_perf_individual(
+                timers[i], stream, perf_func, stream_args);
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n_streams; i++)
+        threads.emplace_back(run, i);
+    while (n_ready < n_streams)
+        std::this_thread::yield();
+
+    auto &wall = res->timer_map.wall_timer();
+    wall.reset();
+    go = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    auto &t = res->timer_map.perf_timer();
+    t.reset();
+    for (int i = 0; i < n_streams; i++) {
+        SAFE(rets[i], WARN);
+        t.merge(timers[i]);
+    }
+    wall.stamp(t.times());
+    return OK;
+}
+
 int measure_perf(res_t *res, perf_function_t &perf_func, args_t &args) {
     int ret = OK;
     if (is_bench_mode(PERF)) {
         const auto &engine = get_test_engine();
+        // For non-DPCPP CPU: measure individual iterations.
+        // For DPCPP CPU and GPU: measure iterations in batches to hide driver
+        // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
+        const bool is_individual = is_cpu() && !is_sycl_engine(engine);
+        const int n_streams = is_individual ? num_streams : 1;
+        const int n_sets = cold_cache ? get_cold_cache_n_sets(args) : 1;
+
+        // Several streams or sets of arguments work on copies of the
+        // memories of the problem.
+        const bool use_copies = n_streams * n_sets > 1;
+        args_copies_t copies;
+        if (use_copies) SAFE(copies.init(args, n_streams * n_sets), WARN);
+
         stream_t stream(engine);
         std::vector<dnnl_exec_arg_t> dnnl_args;
         execute_unmap_args(args, dnnl_args);
+        const dnnl_args_sets_t dnnl_args_sets
+                = use_copies ? copies.sets() : dnnl_args_sets_t {dnnl_args};
 
         auto &t = res->timer_map.perf_timer();
-        // For non-DPCPP CPU: measure individual iterations.
-        // For DPCPP CPU and GPU: measure iterations in batches to hide driver
-        // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
-        if (is_cpu() && !is_sycl_engine(engine))
-            ret = measure_perf_individual(t, stream, perf_func, dnnl_args);
+        if (n_streams > 1)
+            ret = measure_perf_multi_stream(res, perf_func, dnnl_args_sets);
+        else if (is_individual)
+            ret = measure_perf_individual(
+                    t, stream, perf_func, dnnl_args_sets);
         else
-            ret = measure_perf_aggregate(t, stream, perf_func, dnnl_args);
+            ret = measure_perf_aggregate(
+                    t, stream, perf_func, dnnl_args_sets);
 
         if (ret == OK) execute_map_args(args);
     }
@@ -521,6 +706,19 @@ void skip_unimplemented_data_type(
     }
 }
 
+bool is_cpu_f16_compute_supported(dnnl_data_type_t src_dt,
+        dnnl_data_type_t wei_dt, dnnl_data_type_t dst_dt, dir_t dir) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    using namespace dnnl::impl::cpu::platform;
+    // f16 is computed in f32 for inference only.
+    return is_cpu() && src_dt == dnnl_f16 && wei_dt == dnnl_f16
+            && (dst_dt == dnnl_f16 || dst_dt == dnnl_f32) && (dir & FLAG_FWD)
+            && has_f16_compute_support();
+#else
+    return false;
+#endif
+}
+
 void skip_unimplemented_sum_po(
         const attr_t &attr, res_t *res, dnnl_data_type_t dst_dt) {
     const auto &po = attr.post_ops;
@@ -390,6 +390,11 @@ int check_pd_w_and_wo_attr(
 void skip_start(res_t *res);
 void skip_unimplemented_data_type(
         const std::vector<dnnl_data_type_t> &v_dt, dir_t dir, res_t *res);
+// Returns true if the CPU computes the convolution, the inner product and the
+// matmul with f16 source and weights into `dst_dt`. Such problems are not
+// subject to skip_unimplemented_data_type().
+bool is_cpu_f16_compute_supported(dnnl_data_type_t src_dt,
+        dnnl_data_type_t wei_dt, dnnl_data_type_t dst_dt, dir_t dir);
 void skip_unimplemented_sum_po(const attr_t &attr, res_t *res,
         dnnl_data_type_t dst_dt = dnnl_data_type_undef);
 void skip_invalid_inplace(res_t *res, dnnl_data_type_t sdt,
@@ -239,9 +239,11 @@ int fill_dst(
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type(
-            {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt}, prb->dir,
-            res);
+    if (!is_cpu_f16_compute_supported(prb->cfg[SRC].dt, prb->cfg[WEI].dt,
+                prb->cfg[DST].dt, prb->dir))
+        skip_unimplemented_data_type(
+                {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt},
+                prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -57,6 +57,8 @@ struct settings_t : public base_settings_t {
 
     std::vector<dir_t> dir {FWD_D};
     std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    // The destination data type, the same as `dt` if undefined.
+    std::vector<dnnl_data_type_t> ddt {dnnl_data_type_undef};
     std::vector<std::string> tag {tag::abx}, stat_tag {tag::any};
     std::vector<flags_t> flags {NONE};
     check_alg_t check_alg = check_alg_t::ALG_AUTO;
@@ -72,38 +74,46 @@ struct settings_t : public base_settings_t {
 struct prb_t : public prb_dims_t {
     prb_t(const prb_dims_t &prb_dims, const std::string &tag,
             const std::string &stat_tag, dir_t dir, dnnl_data_type_t dt,
-            flags_t flags, const attr_t &attr, bool inplace,
-            check_alg_t check_alg)
+            dnnl_data_type_t ddt, flags_t flags, const attr_t &attr,
+            bool inplace, check_alg_t check_alg)
         : prb_dims_t(prb_dims)
         , check_alg(check_alg)
         , tag(tag)
         , stat_tag(stat_tag)
         , dir(dir)
         , dt(dt)
+        , ddt(ddt == dnnl_data_type_undef ? dt : ddt)
         , flags(flags)
         , inplace(inplace)
-        , attr(attr) {
+        , attr(attr)
+        , scales(NULL) {
         n = 1;
         for (int d = 0; d < ndims - 1; d++)
             n *= dims[d];
         c = dims[ndims - 1];
         eps = 1.f / 16;
+        generate_oscales();
+    }
+    ~prb_t() {
+        if (scales) zfree(scales);
     }
-    ~prb_t() {}
 
     check_alg_t check_alg;
     std::string tag, stat_tag;
     dir_t dir;
-    dnnl_data_type_t dt;
+    dnnl_data_type_t dt, ddt;
     flags_t flags;
     bool inplace;
     attr_t attr;
     int64_t n, c;
     float eps;
+    float *scales;
 
     bool use_ss() const { return flags & USE_SCALESHIFT; }
     bool use_sc() const { return flags & USE_SCALE; }
     bool use_sh() const { return flags & USE_SHIFT; }
+
+    void generate_oscales();
 };
 
 std::ostream &operator<<(std::ostream &s, const prb_t &prb);
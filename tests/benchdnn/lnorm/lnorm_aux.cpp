@@ -26,12 +26,23 @@ flags_t str2flags(const char *str) {
     return flags;
 }
 
+void prb_t::generate_oscales() {
+    if (attr.oscale.is_def()) return;
+
+    assert(attr.oscale.policy == policy_t::COMMON);
+
+    scales = (float *)zmalloc(sizeof(float), 4);
+    SAFE_V(scales != nullptr ? OK : FAIL);
+    scales[0] = attr.oscale.scale;
+}
+
 std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
     dump_global_params(s);
     settings_t def;
 
     if (canonical || prb.dir != def.dir[0]) s << "--dir=" << prb.dir << " ";
     if (canonical || prb.dt != def.dt[0]) s << "--dt=" << prb.dt << " ";
+    if (canonical || prb.ddt != prb.dt) s << "--ddt=" << prb.ddt << " ";
     if (canonical || prb.tag != def.tag[0]) s << "--tag=" << prb.tag << " ";
     if (canonical || prb.stat_tag != def.stat_tag[0])
         s << "--stat_tag=" << prb.stat_tag << " ";
@@ -34,6 +34,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const bool use_ss = prb->use_ss();
     const bool use_sc = prb->use_sc();
     const bool use_sh = prb->use_sh();
+    const auto v_po_masks = prb->attr.post_ops.get_po_masks();
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
         float smean = mean.get_elem(n);
@@ -46,6 +47,10 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
                                 : use_sh ? sh.get_elem(c) : 0;
             auto off = n * prb->c + c;
             float res = gamma * (src.get_elem(off) - smean) + beta;
+            maybe_oscale(prb->attr, res, prb->scales, 0);
+
+            const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, off);
+            maybe_post_ops(prb->attr, res, dst.get_elem(off), v_po_vals);
             dst_ptr[off] = res;
         }
     });
@@ -194,9 +194,11 @@ int fill_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type(
-            {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->bia_dt, prb->cfg[DST].dt},
-            prb->dir, res);
+    if (!is_cpu_f16_compute_supported(prb->cfg[SRC].dt, prb->cfg[WEI].dt,
+                prb->cfg[DST].dt, prb->dir))
+        skip_unimplemented_data_type({prb->cfg[SRC].dt, prb->cfg[WEI].dt,
+                                             prb->bia_dt, prb->cfg[DST].dt},
+                prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res, prb->cfg[DST].dt);
 
     if (is_gpu()) {
@@ -36,6 +36,7 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_axis : s.axis)
     for_(const auto &i_mb : s.mb)
     for_(const auto &i_oscale : s.oscale)
+    for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for (auto i_inplace : s.inplace) {
         if (i_oscale.policy != policy_t::COMMON) {
@@ -48,6 +49,7 @@ void check_correctness(const settings_t &s) {
 
         attr_t attr;
         attr.insert(i_oscale);
+        attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
 
         const prb_t prb(s.prb_dims, i_dir, i_sdt, i_ddt, i_stag, i_dtag, i_alg,
@@ -88,6 +90,7 @@ int bench(int argc, char **argv) {
                 || parse_inplace(s.inplace, def.inplace, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
                 || parse_attr_oscale(s.oscale, argv[0])
+                || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
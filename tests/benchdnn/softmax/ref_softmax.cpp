@@ -29,6 +29,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const auto alg = prb->alg;
     int64_t outer_size {0}, inner_size {0}, axis_size {0};
     get_sizes(prb, outer_size, inner_size, axis_size);
+    const auto v_po_masks = prb->attr.post_ops.get_po_masks();
 
     benchdnn_parallel_nd(outer_size, inner_size, [&](int64_t ou, int64_t in) {
         float space_denom = 0.;
@@ -66,6 +67,9 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
                 dst_ptr[idx] -= space_denom;
             }
             maybe_oscale(prb->attr, dst_ptr[idx], prb->scales, 0);
+
+            const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, idx);
+            maybe_post_ops(prb->attr, dst_ptr[idx], 0.f, v_po_vals);
         }
     });
 }
@@ -28,6 +28,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "softmax/softmax.hpp"
 
 namespace softmax {
@@ -71,6 +72,7 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 
     attr_args_t attr_args;
     attr_args.prepare_output_scales(prb->attr, prb->scales, 1);
+    attr_args.prepare_post_ops_mds(prb->attr, prb->ndims, prb->dims.data());
     auto dnnl_attr = make_benchdnn_dnnl_wrapper(
             create_dnnl_attr(prb->attr, attr_args));
 
@@ -182,9 +184,22 @@ int fill_data_bwd(
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type({prb->sdt, prb->ddt}, prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res);
+    if (res->state == SKIPPED) return;
+
+    // Softmax does not support the sum post-op.
+    if (prb->attr.post_ops.find(attr_t::post_ops_t::kind_t::SUM) >= 0) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    // Post-ops apply to forward propagation only.
+    if ((prb->dir & FLAG_BWD) && !prb->attr.post_ops.is_def()) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
     // See `skip_invalid_inplace` for details.
     if (prb->inplace) {
         skip_invalid_inplace(res, prb->sdt, prb->ddt, prb->stag, prb->dtag);
@@ -266,8 +281,15 @@ int doit(const prb_t *prb, res_t *res) {
 
         SAFE(fill_data_fwd(prb, src_dt, src_fp), WARN);
 
+        std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+        std::vector<int> binary_po_args;
+        SAFE(binary::setup_binary_po(
+                     const_pd, binary_po_args, binary_po_dt, binary_po_fp),
+                WARN);
+
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DST, dst_dt);
+        args.set(binary_po_args, binary_po_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
 
         SAFE(execute_and_wait(prim, args, res), WARN);
@@ -275,6 +297,7 @@ int doit(const prb_t *prb, res_t *res) {
         if (is_bench_mode(CORR)) {
             ref_args.set(DNNL_ARG_SRC, src_fp);
             ref_args.set(DNNL_ARG_DST, dst_fp);
+            ref_args.set(binary_po_args, binary_po_fp);
 
             check_correctness(prb, {DST}, args, ref_args, setup_cmp, res);
         }
@@ -459,6 +459,18 @@ static bool parse_canonical(
             canonical, false, str2bool, str, option_name, help);
 }
 
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to measure "
+              "performance with cold caches.\n    When set to `true`, every "
+              "iteration uses a different copy of the problem memories, so "
+              "that they are evicted from the last level cache by the time "
+              "they are used again.\n";
+    return parse_single_value_option(
+            cold_cache, false, str2bool, str, option_name, help);
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
@@ -628,6 +640,33 @@ static bool parse_mode(
             bench_mode, CORR, str2bench_mode, str, option_name, help);
 }
 
+static bool parse_num_streams(
+        const char *str, const std::string &option_name = "num-streams") {
+    static const std::string help
+            = "UINT    (Default: `1`)\n    Specifies the number `UINT` of "
+              "streams executing the problem concurrently for performance "
+              "benchmarking on CPU.\n    Every stream runs on its own subset "
+              "of the cores with its own copy of the problem memories. The "
+              "aggregate throughput and the latency percentiles are available "
+              "in the performance report.\n";
+    bool parsed = parse_single_value_option(
+            num_streams, 1, atoi, str, option_name, help);
+    if (parsed) {
+        num_streams = MAX2(1, num_streams);
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_OMP \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_SEQ
+        if (num_streams > 1) {
+            fprintf(stderr,
+                    "ERROR: option `--%s` is supported with OpenMP and "
+                    "sequential CPU runtimes only, exiting...\n",
+                    option_name.c_str());
+            exit(2);
+        }
+#endif
+    }
+    return parsed;
+}
+
 static bool parse_skip_impl(
         const char *str, const std::string &option_name = "skip-impl") {
     static const std::string help
@@ -697,11 +736,12 @@ bool parse_bench_settings(const char *str) {
 
     bool parsed = parse_allow_enum_tags_only(str)
             || parse_attr_same_pd_check(str) || parse_canonical(str)
-            || parse_cpu_isa_hints(str) || parse_engine(str)
-            || parse_fast_ref_gpu(str) || parse_fix_times_per_prb(str)
-            || parse_max_ms_per_prb(str) || parse_mem_check(str)
-            || parse_memory_kind(str) || parse_mode(str) || parse_skip_impl(str)
-            || parse_start(str) || parse_verbose(str);
+            || parse_cold_cache(str) || parse_cpu_isa_hints(str)
+            || parse_engine(str) || parse_fast_ref_gpu(str)
+            || parse_fix_times_per_prb(str) || parse_max_ms_per_prb(str)
+            || parse_mem_check(str) || parse_memory_kind(str)
+            || parse_mode(str) || parse_num_streams(str)
+            || parse_skip_impl(str) || parse_start(str) || parse_verbose(str);
 
     // Last condition makes this help message to be triggered once driver_name
     // is already known.
@@ -46,12 +46,18 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         res_t *res, const char *prb_str) const {
     timer::timer_t::mode_t mode = timer::timer_t::min;
     (void)mode;
+    // Percent of the measurements for the percentile modifiers, 0 otherwise.
+    double percentile = 0;
     double unit = 1e0;
     char c = *option;
 
     if (c == '-' || c == '0' || c == '+') {
         mode = modifier2mode(c);
         c = *(++option);
+    } else if (!strncmp("p50", option, 3) || !strncmp("p99", option, 3)) {
+        percentile = atoi(option + 1);
+        option += 3;
+        c = *option;
     }
 
     if (c == 'K' || c == 'M' || c == 'G') {
@@ -59,14 +65,29 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         c = *(++option);
     }
 
+    auto get_ms = [&](const timer::timer_t &t) -> double {
+        return percentile ? t.ms_percentile(percentile) : t.ms(mode);
+    };
+
     auto get_flops = [&](const timer::timer_t &t) -> double {
-        if (!t.sec(mode)) return 0;
-        return ops() / t.sec(mode) / unit;
+        if (!get_ms(t)) return 0;
+        return ops() / (get_ms(t) / 1e3) / unit;
     };
 
     auto get_bw = [&](const timer::timer_t &t) -> double {
-        if (!t.sec(mode)) return 0;
-        return (res->ibytes + res->obytes) / t.sec(mode) / unit;
+        if (!get_ms(t)) return 0;
+        return (res->ibytes + res->obytes) / (get_ms(t) / 1e3) / unit;
+    };
+
+    // Iterations per second of all the streams, measured by the wall timer
+    // in the multi-stream mode.
+    auto get_throughput = [&]() -> double {
+        auto &tm = res->timer_map;
+        const auto &t = tm.timers.count(timer::timer_t::wall_timer)
+                ? tm.wall_timer()
+                : tm.perf_timer();
+        if (!t.sec(timer::timer_t::sum)) return 0;
+        return t.times() / t.sec(timer::timer_t::sum) / unit;
     };
 
     auto get_freq = [&](const timer::timer_t &t) -> double {
@@ -116,7 +137,8 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("prb", s << prb_str);
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
     HANDLE("ops", s << ops() / unit);
-    HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("time", s << get_ms(res->timer_map.perf_timer()) / unit);
+    HANDLE("throughput", s << get_throughput());
     HANDLE("impl", s << res->impl_name);
     HANDLE("ibytes", s << res->ibytes / unit);
     HANDLE("obytes", s << res->obytes / unit);
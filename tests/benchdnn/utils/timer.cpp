@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "common.hpp"
 #include "utils/timer.hpp"
@@ -51,6 +52,7 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_.clear();
 
     start();
 }
@@ -94,6 +96,37 @@ void timer_t::stop(int add_times, unsigned long long add_ticks) {
             = times_ ? std::max(ticks_[mode_t::max], d_ticks) : d_ticks;
 
     times_ += add_times;
+    samples_.push_back(d_ms);
+}
+
+double timer_t::ms_percentile(double p) const {
+    if (samples_.empty()) return 0; // nothing to report
+    std::vector<double> sorted(samples_);
+    std::sort(sorted.begin(), sorted.end());
+    // Nearest-rank method.
+    const size_t rank = (size_t)std::ceil(p / 100. * sorted.size());
+    return sorted[std::min(std::max(rank, (size_t)1), sorted.size()) - 1];
+}
+
+void timer_t::merge(const timer_t &other) {
+    if (other.times_ == 0) return;
+    if (times_ == 0) {
+        *this = other;
+        return;
+    }
+    times_ += other.times_;
+    for (auto mode : {mode_t::avg, mode_t::sum}) {
+        ms_[mode] += other.ms_[mode];
+        ticks_[mode] += other.ticks_[mode];
+    }
+    ms_[mode_t::min] = std::min(ms_[mode_t::min], other.ms_[mode_t::min]);
+    ms_[mode_t::max] = std::max(ms_[mode_t::max], other.ms_[mode_t::max]);
+    ticks_[mode_t::min]
+            = std::min(ticks_[mode_t::min], other.ticks_[mode_t::min]);
+    ticks_[mode_t::max]
+            = std::max(ticks_[mode_t::max], other.ticks_[mode_t::max]);
+    samples_.insert(
+            samples_.end(), other.samples_.begin(), other.samples_.end());
 }
 
 timer_t &timer_t::operator=(const timer_t &rhs) {
@@ -105,6 +138,7 @@ timer_t &timer_t::operator=(const timer_t &rhs) {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = rhs.ms_[i];
     ms_start_ = rhs.ms_start_;
+    samples_ = rhs.samples_;
     return *this;
 }
 
@@ -120,8 +154,13 @@ timer_t &timer_map_t::perf_timer() {
     return get_timer(timer_t::perf_timer);
 }
 
+timer_t &timer_map_t::wall_timer() {
+    return get_timer(timer_t::wall_timer);
+}
+
 // Initializing timers with fixed names.
 const std::string timer_t::perf_timer = "perf_timer";
 const std::string timer_t::ref_timer = "compute_ref_timer";
+const std::string timer_t::wall_timer = "wall_timer";
 
 } // namespace timer
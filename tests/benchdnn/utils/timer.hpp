@@ -19,6 +19,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -65,21 +66,34 @@ struct timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    /** the time of a measurement such that `p` percent of the measurements
+     * are not longer, e.g. `p = 50` returns the median */
+    double ms_percentile(double p) const;
+
+    /** accumulates the measurements of `other` to the current ones */
+    void merge(const timer_t &other);
+
     timer_t &operator=(const timer_t &rhs);
 
     int times_;
     unsigned long long ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    // Time of every stop, per iteration if several are stopped at once.
+    std::vector<double> samples_;
 
     // Section with timer fixed timer names for ease of use
     static const std::string perf_timer;
     static const std::string ref_timer;
+    // Wall time of the concurrent performance runs and the number of
+    // iterations of all of them.
+    static const std::string wall_timer;
 };
 
 struct timer_map_t {
     timer_t &get_timer(const std::string &name);
 
     timer_t &perf_timer();
+    timer_t &wall_timer();
 
     std::map<std::string, timer_t> timers;
 };
@@ -14,7 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdio>
+#include <string>
 #include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
@@ -76,4 +85,143 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestMultithreading) {
 INSTANTIATE_TEST_SUITE_P(AllEngineKinds, engine_test_t,
         ::testing::Values(engine::kind::cpu, engine::kind::gpu));
 
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+#define NUMA_TEST_LINUX 1
+
+namespace {
+// Reads a sysfs list like "0-3,8,10-11".
+std::vector<int> read_sysfs_list(const std::string &path) {
+    std::vector<int> list;
+    FILE *f = fopen(path.c_str(), "r");
+    if (f == nullptr) return list;
+    int first = 0, last = 0;
+    char sep = 0;
+    while (fscanf(f, "%d", &first) == 1) {
+        last = first;
+        if (fscanf(f, "%c", &sep) == 1 && sep == '-') {
+            if (fscanf(f, "%d", &last) != 1) break;
+            if (fscanf(f, "%c", &sep) != 1) sep = 0;
+        }
+        for (int i = first; i <= last; i++)
+            list.push_back(i);
+        if (sep != ',') break;
+    }
+    fclose(f);
+    return list;
+}
+
+// Checks that the calling thread runs on the CPUs of the system node `id`
+// unless the process cannot run on any of them.
+void check_affinity(int id, const cpu_set_t &process_cpus) {
+    const auto node_cpus = read_sysfs_list("/sys/devices/system/node/node"
+            + std::to_string(id) + "/cpulist");
+    bool can_run = false;
+    for (int c : node_cpus)
+        can_run = can_run || (c < CPU_SETSIZE && CPU_ISSET(c, &process_cpus));
+    if (!can_run) return;
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpus), &cpus), 0);
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &cpus)) continue;
+        bool on_node = false;
+        for (int c : node_cpus)
+            on_node = on_node || c == cpu;
+        EXPECT_TRUE(on_node) << "CPU " << cpu << " is not on node " << id;
+    }
+}
+
+// Checks that most pages of the buffer are on the system node `id`. The
+// pages are bound with a preferred policy, so a few of them may be placed
+// elsewhere if the node is short of memory.
+void check_placement(const void *ptr, size_t size, int id) {
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const int mpol_f_node = 1, mpol_f_addr = 2;
+    size_t npages = 0, on_node = 0;
+    for (size_t off = 0; off < size; off += 16 * page_size) {
+        int page_node = -1;
+        const auto *addr = static_cast<const char *>(ptr) + off;
+        if (syscall(SYS_get_mempolicy, &page_node, nullptr, 0, addr,
+                    mpol_f_node | mpol_f_addr)
+                != 0)
+            continue;
+        npages++;
+        on_node += page_node == id;
+    }
+    EXPECT_GE(10 * on_node, 9 * npages);
+}
+} // namespace
+#endif
+
+HANDLE_EXCEPTIONS_FOR_TEST(engine_numa_test_t, TestNumaNode) {
+    const int nnodes = (int)engine::get_numa_node_count();
+    SKIP_IF(nnodes == 0, "Binding CPU engines to NUMA nodes is unsupported.");
+    EXPECT_ANY_THROW(engine::cpu_on_numa_node(-1));
+    EXPECT_ANY_THROW(engine::cpu_on_numa_node(nnodes));
+
+    engine def_eng(engine::kind::cpu, 0);
+    EXPECT_EQ(def_eng.get_numa_node(), -1);
+
+    // Big enough for the memory to be touched by the thread team
+    const memory::dim n = 1 << 20;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::x);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f);
+    auto run_relu = [&](const engine &eng, memory &src, memory &dst) {
+        auto *s = static_cast<float *>(src.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            s[i] = float(i % 7) - 3.f;
+
+        stream strm(eng);
+        eltwise_forward({relu_d, eng})
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        const auto *d = static_cast<const float *>(dst.get_data_handle());
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(d[i], s[i] > 0.f ? s[i] : 0.f);
+    };
+
+#ifdef NUMA_TEST_LINUX
+    // The placement is only observable on systems with several nodes.
+    const auto node_ids = read_sysfs_list("/sys/devices/system/node/online");
+    const bool check_numa = nnodes > 1 && (int)node_ids.size() == nnodes;
+    cpu_set_t initial_cpus;
+    CPU_ZERO(&initial_cpus);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(initial_cpus), &initial_cpus), 0);
+#endif
+
+    for (int node = 0; node < nnodes; node++) {
+        engine eng = engine::cpu_on_numa_node(node);
+        EXPECT_EQ(eng.get_kind(), engine::kind::cpu);
+        EXPECT_EQ(eng.get_numa_node(), node);
+
+        memory src(md, eng), dst(md, eng);
+        run_relu(eng, src, dst);
+
+#ifdef NUMA_TEST_LINUX
+        if (check_numa) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+            // The calling thread is the master of the team that executed
+            // the primitive.
+            check_affinity(node_ids[node], initial_cpus);
+#endif
+            check_placement(
+                    dst.get_data_handle(), md.get_size(), node_ids[node]);
+        }
+#endif
+    }
+
+    // An unbound engine gives the threads their affinity back.
+    memory src(md, def_eng), dst(md, def_eng);
+    run_relu(def_eng, src, dst);
+#ifdef NUMA_TEST_LINUX
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpus), &cpus), 0);
+    EXPECT_TRUE(CPU_EQUAL(&cpus, &initial_cpus));
+#endif
+}
+
 } // namespace dnnl
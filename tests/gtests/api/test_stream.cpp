@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl.h"
 
+#include <string>
 #include <tuple>
 
 namespace dnnl {
@@ -137,6 +138,206 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+HANDLE_EXCEPTIONS_FOR_TEST(stream_test_cpp_t, Profiling) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0, "Engine not found.");
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    EXPECT_TRUE(s.get_profiling_records().empty());
+
+    memory::desc md({2, 16, 8, 8}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory src(md, eng), dst(md, eng);
+    auto relu = eltwise_forward({{prop_kind::forward_inference,
+                                         algorithm::eltwise_relu, md, 0.f},
+            eng});
+    auto run_relu = [&](int n) {
+        for (int i = 0; i < n; i++)
+            relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        s.wait();
+    };
+
+    // Nothing is recorded until the profiling is enabled.
+    run_relu(1);
+    EXPECT_TRUE(s.get_profiling_records().empty());
+
+    // The ring buffer keeps the most recent records.
+    const int capacity = 3;
+    s.set_profiling_capacity(capacity);
+    run_relu(capacity + 2);
+    auto records = s.get_profiling_records();
+    ASSERT_EQ((int)records.size(), capacity);
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto &r = records[i];
+        EXPECT_EQ(r.kind, dnnl_eltwise);
+        EXPECT_EQ(r.phase, nullptr);
+        EXPECT_EQ(r.depth, 0);
+        EXPECT_LE(r.start_ns, r.end_ns);
+        if (i > 0) { EXPECT_LE(records[i - 1].end_ns, r.start_ns); }
+        EXPECT_NE(std::string(r.info).find("eltwise"), std::string::npos);
+        EXPECT_NE(std::string(r.info).find("2x16x8x8"), std::string::npos);
+    }
+
+    const std::string trace = s.get_profiling_trace();
+    EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"eltwise\""), std::string::npos);
+
+    s.reset_profiling();
+    EXPECT_TRUE(s.get_profiling_records().empty());
+
+    // The phases of an implementation are nested in the execution of the
+    // primitive and are recorded before it.
+    memory::desc wei_md({16, 16, 3, 3}, memory::data_type::f32,
+            memory::format_tag::oihw);
+    memory::desc deconv_dst_md({2, 16, 10, 10}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    post_ops ops;
+    ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    auto deconv_pd = deconvolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::deconvolution_direct,
+                    md, wei_md, deconv_dst_md, {1, 1}, {0, 0}, {0, 0}},
+            attr, eng);
+    memory wei(wei_md, eng), deconv_dst(deconv_dst_md, eng);
+    deconvolution_forward(deconv_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, deconv_dst}});
+    s.wait();
+
+    records = s.get_profiling_records();
+    ASSERT_FALSE(records.empty());
+    const auto &prim = records.back();
+    EXPECT_EQ(prim.kind, dnnl_deconvolution);
+    EXPECT_EQ(prim.phase, nullptr);
+    for (size_t i = 0; i + 1 < records.size(); i++) {
+        const auto &r = records[i];
+        EXPECT_EQ(r.kind, dnnl_deconvolution);
+        EXPECT_NE(r.phase, nullptr);
+        EXPECT_GE(r.depth, 1);
+        EXPECT_GE(r.start_ns, prim.start_ns);
+        EXPECT_LE(r.end_ns, prim.end_ns);
+        EXPECT_STREQ(r.impl_name, prim.impl_name);
+    }
+
+    // Disabling the profiling drops the records.
+    s.set_profiling_capacity(0);
+    run_relu(1);
+    EXPECT_TRUE(s.get_profiling_records().empty());
+    EXPECT_ANY_THROW(s.set_profiling_capacity(-1));
+}
+
+TEST(stream_test_c_t, ProfilingInvalidArguments) {
+    dnnl_profiling_record_t record;
+    int count = 0;
+    size_t size = 0;
+    ASSERT_EQ(dnnl_stream_set_profiling_capacity(nullptr, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_get_profiling_records_count(nullptr, &count),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_get_profiling_record(nullptr, 0, &record),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_get_profiling_trace(nullptr, &size, nullptr),
+            dnnl_invalid_arguments);
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    dnnl_engine_t engine;
+    DNNL_CHECK(dnnl_engine_create(&engine, dnnl_cpu, 0));
+    dnnl_stream_t stream;
+    DNNL_CHECK(dnnl_stream_create(&stream, engine, dnnl_stream_default_flags));
+
+    DNNL_CHECK(dnnl_stream_set_profiling_capacity(stream, 4));
+    ASSERT_EQ(dnnl_stream_get_profiling_record(stream, 0, &record),
+            dnnl_invalid_arguments);
+    DNNL_CHECK(dnnl_stream_get_profiling_trace(stream, &size, nullptr));
+    std::string trace(size, ' ');
+    size_t small_size = size - 1;
+    ASSERT_EQ(dnnl_stream_get_profiling_trace(stream, &small_size, &trace[0]),
+            dnnl_invalid_arguments);
+    DNNL_CHECK(dnnl_stream_get_profiling_trace(stream, &size, &trace[0]));
+
+    DNNL_CHECK(dnnl_stream_destroy(stream));
+    DNNL_CHECK(dnnl_engine_destroy(engine));
+#endif
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(stream_test_cpp_t, CaptureReplay) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0, "Engine not found.");
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    const memory::dim n = 64;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::x);
+    memory src(md, eng), tmp(md, eng), dst(md, eng);
+    auto linear = [&](float alpha, float beta) {
+        return eltwise_forward({{prop_kind::forward_inference,
+                                        algorithm::eltwise_linear, md, alpha,
+                                        beta},
+                eng});
+    };
+    auto fill = [&](memory &m, float v) {
+        auto p = map_memory<float>(m);
+        for (memory::dim i = 0; i < n; i++)
+            p[i] = v;
+    };
+    auto check = [&](memory &m, float v) {
+        auto p = map_memory<float>(m);
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(p[i], v);
+    };
+
+    // dst = 3 * (2 * src + 1) - 1
+    fill(src, 1.f);
+    fill(dst, 0.f);
+    s.begin_capture();
+    linear(2.f, 1.f).execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, tmp}});
+    linear(3.f, -1.f).execute(s, {{DNNL_ARG_SRC, tmp}, {DNNL_ARG_DST, dst}});
+    auto graph = s.end_capture();
+    s.wait();
+    ASSERT_EQ(graph.get_size(), 2);
+
+    // Nothing is executed until the graph is replayed, and the primitives
+    // are kept alive by the graph.
+    check(dst, 0.f);
+    s.replay(graph).wait();
+    check(dst, 8.f);
+
+    // The graph works on the current data handles of the memory objects.
+    memory src2(md, eng);
+    fill(src2, 2.f);
+    src.set_data_handle(src2.get_data_handle());
+    s.replay(graph).wait();
+    check(dst, 14.f);
+
+    // The graph can be replayed with the profiling enabled.
+    s.set_profiling_capacity(8);
+    s.replay(graph).wait();
+    EXPECT_EQ(s.get_profiling_records().size(), 2u);
+    s.set_profiling_capacity(0);
+
+    // Invalid arguments are reported at the capture.
+    s.begin_capture();
+    EXPECT_ANY_THROW(s.begin_capture());
+    EXPECT_ANY_THROW(linear(1.f, 0.f).execute(s, {{DNNL_ARG_DST, dst}}));
+    EXPECT_ANY_THROW(s.replay(graph));
+    EXPECT_EQ(s.end_capture().get_size(), 0);
+    EXPECT_ANY_THROW(s.end_capture());
+
+    // A graph is replayed in the stream it was captured in only.
+    stream s2(eng);
+    EXPECT_ANY_THROW(s2.replay(graph));
+}
+
+TEST(stream_test_c_t, CaptureInvalidArguments) {
+    dnnl_exec_graph_t graph;
+    int size = 0;
+    ASSERT_EQ(dnnl_stream_begin_capture(nullptr), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_end_capture(nullptr, &graph), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_stream_replay(nullptr, nullptr), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_exec_graph_get_size(nullptr, &size), dnnl_invalid_arguments);
+    DNNL_CHECK(dnnl_exec_graph_destroy(nullptr));
+}
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
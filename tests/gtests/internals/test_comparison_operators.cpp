@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021 Intel Corporation
+* Copyright 2021-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -139,6 +139,12 @@ TEST(comparison_operators_t, TestLayerNormDesc) {
     TEST_SELF_COMPARISON(lnorm_desc);
 }
 
+TEST(comparison_operators_t, TestLayerNormV2Desc) {
+    auto lnorm_desc = dnnl::impl::layer_normalization_v2_desc_t();
+    lnorm_desc.layer_norm_epsilon = NAN;
+    TEST_SELF_COMPARISON(lnorm_desc);
+}
+
 TEST(comparison_operators_t, TestLRNDesc) {
     auto lrn_desc = dnnl::impl::lrn_desc_t();
     lrn_desc.lrn_alpha = NAN;
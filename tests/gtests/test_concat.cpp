@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2021 Intel Corporation
+* Copyright 2016-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -426,4 +426,275 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+struct concat_mixed_src_t {
+    memory::dims dims;
+    memory::data_type dt;
+    memory::format_tag tag;
+    float scale; // 0 stands for no scale
+};
+
+struct concat_mixed_test_params_t {
+    int concat_dimension;
+    std::vector<concat_mixed_src_t> srcs;
+    memory::data_type dst_dt;
+    memory::format_tag dst_tag;
+    bool runtime_scales;
+};
+
+// Concat of sources with different data types, layouts and scales.
+class concat_mixed_test_t
+    : public ::testing::TestWithParam<concat_mixed_test_params_t> {
+protected:
+    void SetUp() override {
+        const auto &p = GetParam();
+        for (const auto &s : p.srcs)
+            SKIP_IF(unsupported_data_type(s.dt),
+                    "Engine does not support this data type.");
+        SKIP_IF(unsupported_data_type(p.dst_dt),
+                "Engine does not support this data type.");
+        Test();
+    }
+
+    static float get_value(
+            const void *ptr, memory::data_type dt, memory::dim off) {
+        switch (dt) {
+            case memory::data_type::f32: return ((const float *)ptr)[off];
+            case memory::data_type::s32: return ((const int32_t *)ptr)[off];
+            case memory::data_type::s8: return ((const int8_t *)ptr)[off];
+            case memory::data_type::u8: return ((const uint8_t *)ptr)[off];
+            default: assert(!"unsupported data type");
+        }
+        return NAN;
+    }
+
+    static void set_value(
+            void *ptr, memory::data_type dt, memory::dim off, float v) {
+        switch (dt) {
+            case memory::data_type::f32: ((float *)ptr)[off] = v; break;
+            case memory::data_type::s32: ((int32_t *)ptr)[off] = v; break;
+            case memory::data_type::s8: ((int8_t *)ptr)[off] = v; break;
+            case memory::data_type::u8: ((uint8_t *)ptr)[off] = v; break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Converts the scaled value as the conversion to the destination does.
+    static float cvt_dst(float v, memory::data_type dt) {
+        if (dt == memory::data_type::f32) return v;
+        float lo = 0.f, hi = 0.f;
+        switch (dt) {
+            case memory::data_type::s32: lo = INT32_MIN, hi = INT32_MAX; break;
+            case memory::data_type::s8: lo = INT8_MIN, hi = INT8_MAX; break;
+            case memory::data_type::u8: lo = 0, hi = UINT8_MAX; break;
+            default: assert(!"unsupported data type");
+        }
+        return nearbyintf(std::min(hi, std::max(lo, v)));
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const int n = (int)p.srcs.size();
+
+        primitive_attr attr;
+        std::vector<memory::desc> srcs_md;
+        memory::dims dst_dims = p.srcs[0].dims;
+        dst_dims[p.concat_dimension] = 0;
+        for (int i = 0; i < n; i++) {
+            const auto &s = p.srcs[i];
+            srcs_md.emplace_back(s.dims, s.dt, s.tag);
+            dst_dims[p.concat_dimension] += s.dims[p.concat_dimension];
+            if (s.scale != 0.f)
+                attr.set_scales(DNNL_ARG_MULTIPLE_SRC + i, 0,
+                        std::vector<float> {p.runtime_scales
+                                        ? DNNL_RUNTIME_F32_VAL
+                                        : s.scale});
+        }
+
+        memory::desc dst_md(dst_dims, p.dst_dt, p.dst_tag);
+        auto concat_pd = concat::primitive_desc(
+                dst_md, p.concat_dimension, srcs_md, eng, attr);
+        auto dst = test::make_memory(concat_pd.dst_desc(), eng);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_DST, dst}};
+        std::vector<memory> srcs;
+        for (int i = 0; i < n; i++) {
+            srcs.push_back(test::make_memory(srcs_md[i], eng));
+            {
+                auto ptr = map_memory<char>(srcs[i]);
+                const dnnl::impl::memory_desc_wrapper mdw(srcs_md[i].data);
+                const bool is_u8 = p.srcs[i].dt == memory::data_type::u8;
+                for (memory::dim e = 0; e < mdw.nelems(); e++)
+                    set_value(ptr, p.srcs[i].dt, mdw.off_l(e),
+                            float(e % 13) - (is_u8 ? 0.f : 6.f));
+            }
+            args.insert({DNNL_ARG_MULTIPLE_SRC + i, srcs[i]});
+
+            if (p.runtime_scales && p.srcs[i].scale != 0.f) {
+                memory scale_mem(
+                        {{1}, memory::data_type::f32, memory::format_tag::x},
+                        eng);
+                {
+                    auto ptr = map_memory<float>(scale_mem);
+                    ptr[0] = p.srcs[i].scale;
+                }
+                args.insert({DNNL_ARG_ATTR_INPUT_SCALES
+                                    | (DNNL_ARG_MULTIPLE_SRC + i),
+                        scale_mem});
+            }
+        }
+
+        concat(concat_pd).execute(strm, args);
+        strm.wait();
+
+        auto dst_ptr = map_memory<const char>(dst);
+        const dnnl::impl::memory_desc_wrapper dst_mdw(
+                concat_pd.dst_desc().data);
+        const int ndims = (int)dst_dims.size();
+        memory::dim offset = 0;
+        for (int i = 0; i < n; i++) {
+            const auto &s = p.srcs[i];
+            auto src_ptr = map_memory<const char>(srcs[i]);
+            const dnnl::impl::memory_desc_wrapper src_mdw(srcs_md[i].data);
+            const float scale = s.scale != 0.f ? s.scale : 1.f;
+            for (memory::dim e = 0; e < src_mdw.nelems(); e++) {
+                dnnl::impl::dims_t pos;
+                dnnl::impl::utils::l_dims_by_l_offset(
+                        pos, e, src_mdw.dims(), ndims);
+                const float expected = cvt_dst(
+                        scale * get_value(src_ptr, s.dt, src_mdw.off_l(e)),
+                        p.dst_dt);
+                pos[p.concat_dimension] += offset;
+                const float got = get_value(
+                        dst_ptr, p.dst_dt, dst_mdw.off_v(pos));
+                ASSERT_NEAR(expected, got, 1e-6f * std::abs(expected))
+                        << "src " << i << " element " << e;
+            }
+            offset += s.dims[p.concat_dimension];
+        }
+    }
+};
+
+TEST_P(concat_mixed_test_t, TestsConcat) {}
+
+static auto cases_mixed = []() {
+    using dt = memory::data_type;
+    return ::testing::Values(
+            // int8 detection heads: blocked f32 and plain s8 into plain s8
+            concat_mixed_test_params_t {1,
+                    {{{2, 32, 7, 5}, dt::f32, fmt::nChw16c, 0.25f},
+                            {{2, 24, 7, 5}, dt::s8, fmt::nhwc, 2.f}},
+                    dt::s8, fmt::nhwc, false},
+            concat_mixed_test_params_t {1,
+                    {{{2, 32, 7, 5}, dt::f32, fmt::nChw16c, 0.25f},
+                            {{2, 24, 7, 5}, dt::s8, fmt::nhwc, 2.f}},
+                    dt::s8, fmt::nhwc, true},
+            concat_mixed_test_params_t {1,
+                    {{{2, 16, 3, 3}, dt::s8, fmt::nhwc, 0.f},
+                            {{2, 16, 3, 3}, dt::u8, fmt::nchw, 0.5f},
+                            {{2, 32, 3, 3}, dt::s32, fmt::nChw8c, 3.f}},
+                    dt::f32, fmt::nChw16c, false},
+            concat_mixed_test_params_t {1,
+                    {{{3, 5, 4, 4}, dt::f32, fmt::nchw, 10.f},
+                            {{3, 7, 4, 4}, dt::f32, fmt::nhwc, 0.f}},
+                    dt::u8, fmt::nchw, false},
+            concat_mixed_test_params_t {0,
+                    {{{1, 64, 2, 2}, dt::s8, fmt::nhwc, 0.f},
+                            {{3, 64, 2, 2}, dt::f32, fmt::nChw16c, 1.5f}},
+                    dt::f32, fmt::nhwc, true},
+            concat_mixed_test_params_t {2,
+                    {{{2, 16, 3, 4}, dt::s8, fmt::nChw16c, 0.f},
+                            {{2, 16, 5, 4}, dt::s8, fmt::nchw, 0.f}},
+                    dt::s8, fmt::nChw16c, false});
+};
+CPU_INSTANTIATE_TEST_SUITE_P(TestConcat_Mixed, concat_mixed_test_t,
+        cases_mixed());
+
+// Sources written in their images in the destination by the convolutions
+// producing them, which makes the concat a no-op.
+class concat_inplace_test_t : public ::testing::Test {};
+
+CPU_TEST_F(concat_inplace_test_t, TestConvolutionProducers) {
+    using dt = memory::data_type;
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dim mb = 2, ic = 8, h = 5, w = 6;
+    const std::vector<memory::dim> ocs = {16, 24};
+    const memory::dim oc_tot = ocs[0] + ocs[1];
+    memory::desc src_md({mb, ic, h, w}, dt::f32, fmt::nhwc);
+    memory::desc dst_md({mb, oc_tot, h, w}, dt::f32, fmt::nhwc);
+    auto src = test::make_memory(src_md, eng);
+    fill_data<float>(mb * ic * h * w, src, 1.f, 1.f);
+    auto dst = test::make_memory(dst_md, eng);
+
+    std::vector<memory::desc> images_md;
+    memory::dim off = 0;
+    for (auto oc : ocs) {
+        images_md.push_back(
+                dst_md.submemory_desc({mb, oc, h, w}, {0, off, 0, 0}));
+        off += oc;
+    }
+
+    // A dense source is not in the destination memory.
+    auto dense_pd = concat::primitive_desc(dst_md, 1,
+            {{{mb, ocs[0], h, w}, dt::f32, fmt::nhwc}, images_md[1]}, eng);
+    ASSERT_FALSE(dense_pd.src_inplace(0));
+    ASSERT_TRUE(dense_pd.src_inplace(1));
+
+    auto concat_pd = concat::primitive_desc(dst_md, 1, images_md, eng);
+    std::unordered_map<int, memory> concat_args = {{DNNL_ARG_DST, dst}};
+    std::vector<memory> refs;
+    for (size_t i = 0; i < ocs.size(); i++) {
+        ASSERT_TRUE(concat_pd.src_inplace((int)i));
+
+        const memory::dims wei_dims = {ocs[i], ic, 3, 3};
+        memory::desc wei_md(wei_dims, dt::f32, fmt::oihw);
+        auto wei = test::make_memory(wei_md, eng);
+        fill_data<float>(ocs[i] * ic * 3 * 3, wei, 1.f, 1.f);
+
+        auto run_conv = [&](const memory::desc &d_md, const memory &d) {
+            auto conv_d = convolution_forward::desc(
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, src_md,
+                    {wei_dims, dt::f32, fmt::any}, d_md, {1, 1}, {1, 1},
+                    {1, 1});
+            auto conv_pd = convolution_forward::primitive_desc(conv_d, eng);
+            memory conv_wei = wei;
+            if (conv_pd.weights_desc() != wei_md) {
+                conv_wei = test::make_memory(conv_pd.weights_desc(), eng);
+                reorder(wei, conv_wei).execute(strm, wei, conv_wei);
+            }
+            convolution_forward(conv_pd).execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, conv_wei},
+                            {DNNL_ARG_DST, d}});
+        };
+
+        // The image shares the buffer of the destination.
+        memory image(images_md[i], eng, dst.get_data_handle());
+        run_conv(images_md[i], image);
+        concat_args.insert({DNNL_ARG_MULTIPLE_SRC + (int)i, image});
+
+        memory::desc ref_md({mb, ocs[i], h, w}, dt::f32, fmt::nhwc);
+        refs.push_back(test::make_memory(ref_md, eng));
+        run_conv(ref_md, refs.back());
+    }
+
+    concat(concat_pd).execute(strm, concat_args);
+    strm.wait();
+
+    auto dst_ptr = map_memory<const float>(dst);
+    off = 0;
+    for (size_t i = 0; i < ocs.size(); i++) {
+        auto ref_ptr = map_memory<const float>(refs[i]);
+        for (memory::dim p = 0; p < mb * h * w; p++)
+            for (memory::dim c = 0; c < ocs[i]; c++)
+                ASSERT_EQ(ref_ptr[p * ocs[i] + c],
+                        dst_ptr[p * oc_tot + off + c])
+                        << "src " << i << " pixel " << p << " channel " << c;
+        off += ocs[i];
+    }
+}
+
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2021 Intel Corporation
+* Copyright 2018-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -512,6 +512,15 @@ CPU_INST_TEST_CASE(SimpleSmall_NCHW,
 
 );
 
+CPU_INST_TEST_CASE(Strided_NHWC,
+        PARAMS(nhwc, hwio, x, nhwc, 2, 1, 6, 4, 4, 4, 7, 7, 3, 3, 1, 1, 2, 2),
+        PARAMS(nhwc, hwio, x, nhwc, 2, 1, 6, 5, 5, 10, 10, 10, 4, 4, 1, 1, 2,
+                2),
+        PARAMS(nhwc, hwio, x, nhwc, 2, 1, 8, 3, 7, 70, 7, 21, 3, 3, 1, 0, 3,
+                3),
+        PARAMS(nhwc, hwio, x, nhwc, 2, 1, 6, 4, 4, 4, 7, 7, 3, 3, 2, 2, 2, 2,
+                1, 1));
+
 CPU_INST_TEST_CASE(SimpleSmall_Blocked,
         PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED, FMT_BIAS,
                 FMT_DATA_BLOCKED, 2, 1, 32, 12, 12, 32, 13, 13, 3, 3, 0, 0, 1,
@@ -0,0 +1,272 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+struct gemm_batch_test_params_t {
+    char transa;
+    char transb;
+    memory::dim M;
+    memory::dim N;
+    memory::dim K;
+    memory::dim batch_size;
+    // Every problem of the grouped GEMMs has its sizes shifted by its index
+    // modulo this value.
+    memory::dim size_variation;
+};
+
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_test_params_t> {
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<gemm_batch_test_params_t>::GetParam();
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "GEMM is only supported on CPU.");
+    }
+
+    // The sizes and the leading dimensions of the problem `i`.
+    struct problem_t {
+        memory::dim M, N, K, lda, ldb, ldc;
+        size_t a_size, b_size, c_size;
+    };
+
+    problem_t get_problem(memory::dim i, bool grouped) const {
+        const memory::dim shift = grouped ? i % p.size_variation : 0;
+        problem_t pr;
+        pr.M = p.M + shift;
+        pr.N = p.N + 2 * shift;
+        pr.K = p.K + shift;
+        const bool tr_a = p.transa == 'T', tr_b = p.transb == 'T';
+        pr.lda = (tr_a ? pr.M : pr.K) + 1;
+        pr.ldb = (tr_b ? pr.K : pr.N) + 2;
+        pr.ldc = pr.N + 3;
+        // One more element for the matrices to not be empty.
+        pr.a_size = (size_t)(tr_a ? pr.K : pr.M) * pr.lda + 1;
+        pr.b_size = (size_t)(tr_b ? pr.N : pr.K) * pr.ldb + 1;
+        pr.c_size = (size_t)pr.M * pr.ldc + 1;
+        return pr;
+    }
+
+    template <typename T>
+    static void fill(std::vector<T> &v, int seed) {
+        for (size_t i = 0; i < v.size(); i++)
+            v[i] = T((int)((i * 7 + seed * 13) % 11) - 5);
+    }
+
+    gemm_batch_test_params_t p;
+};
+
+TEST_P(gemm_batch_test_t, TestSgemmBatchStrided) {
+    const auto pr = get_problem(0, false);
+    const memory::dim bs = p.batch_size;
+    std::vector<float> A(pr.a_size * bs), B(pr.b_size * bs);
+    std::vector<float> C(pr.c_size * bs), C_ref;
+    fill(A, 1);
+    fill(B, 2);
+    fill(C, 3);
+    C_ref = C;
+
+    const float alpha = 0.5f, beta = 1.5f;
+    ASSERT_EQ(dnnl_sgemm_batch_strided(p.transa, p.transb, pr.M, pr.N, pr.K,
+                      alpha, A.data(), pr.lda, pr.a_size, B.data(), pr.ldb,
+                      pr.b_size, beta, C.data(), pr.ldc, pr.c_size, bs),
+            dnnl_success);
+    for (memory::dim i = 0; i < bs; i++)
+        ASSERT_EQ(dnnl_sgemm(p.transa, p.transb, pr.M, pr.N, pr.K, alpha,
+                          A.data() + i * pr.a_size, pr.lda,
+                          B.data() + i * pr.b_size, pr.ldb, beta,
+                          C_ref.data() + i * pr.c_size, pr.ldc),
+                dnnl_success);
+
+    for (size_t i = 0; i < C.size(); i++)
+        ASSERT_NEAR(C[i], C_ref[i], 1e-5f * std::max(1.f, std::fabs(C_ref[i])))
+                << "index: " << i;
+}
+
+TEST_P(gemm_batch_test_t, TestSgemmGrouped) {
+    const memory::dim count = p.batch_size;
+    std::vector<char> transa(count, p.transa), transb(count, p.transb);
+    std::vector<memory::dim> M, N, K, lda, ldb, ldc;
+    std::vector<float> alpha, beta;
+    std::vector<std::vector<float>> A(count), B(count), C(count), C_ref(count);
+    std::vector<const float *> A_ptrs, B_ptrs;
+    std::vector<float *> C_ptrs;
+    for (memory::dim i = 0; i < count; i++) {
+        const auto pr = get_problem(i, true);
+        M.push_back(pr.M);
+        N.push_back(pr.N);
+        K.push_back(pr.K);
+        lda.push_back(pr.lda);
+        ldb.push_back(pr.ldb);
+        ldc.push_back(pr.ldc);
+        alpha.push_back(1.f + 0.25f * (i % 3));
+        beta.push_back(i % 2 ? 0.f : 1.f);
+        A[i].resize(pr.a_size);
+        B[i].resize(pr.b_size);
+        C[i].resize(pr.c_size);
+        fill(A[i], (int)i);
+        fill(B[i], (int)i + 1);
+        fill(C[i], (int)i + 2);
+        C_ref[i] = C[i];
+        A_ptrs.push_back(A[i].data());
+        B_ptrs.push_back(B[i].data());
+        C_ptrs.push_back(C[i].data());
+    }
+
+    ASSERT_EQ(dnnl_sgemm_grouped(count, transa.data(), transb.data(),
+                      M.data(), N.data(), K.data(), alpha.data(),
+                      A_ptrs.data(), lda.data(), B_ptrs.data(), ldb.data(),
+                      beta.data(), C_ptrs.data(), ldc.data()),
+            dnnl_success);
+    for (memory::dim i = 0; i < count; i++) {
+        ASSERT_EQ(dnnl_sgemm(transa[i], transb[i], M[i], N[i], K[i], alpha[i],
+                          A[i].data(), lda[i], B[i].data(), ldb[i], beta[i],
+                          C_ref[i].data(), ldc[i]),
+                dnnl_success);
+        for (size_t j = 0; j < C[i].size(); j++)
+            ASSERT_NEAR(C[i][j], C_ref[i][j],
+                    1e-5f * std::max(1.f, std::fabs(C_ref[i][j])))
+                    << "problem: " << i << " index: " << j;
+    }
+}
+
+TEST_P(gemm_batch_test_t, TestGemmU8S8S32BatchStrided) {
+    const auto pr = get_problem(0, false);
+    const memory::dim bs = p.batch_size;
+    std::vector<uint8_t> A(pr.a_size * bs);
+    std::vector<int8_t> B(pr.b_size * bs);
+    std::vector<int32_t> C(pr.c_size * bs), C_ref;
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = (uint8_t)(i % 13);
+    fill(B, 4);
+    fill(C, 5);
+    C_ref = C;
+
+    const int32_t co = 7;
+    ASSERT_EQ(dnnl_gemm_u8s8s32_batch_strided(p.transa, p.transb, 'F', pr.M,
+                      pr.N, pr.K, 1.f, A.data(), pr.lda, pr.a_size, 3,
+                      B.data(), pr.ldb, pr.b_size, -2, 1.f, C.data(), pr.ldc,
+                      pr.c_size, &co, bs),
+            dnnl_success);
+    for (memory::dim i = 0; i < bs; i++)
+        ASSERT_EQ(dnnl_gemm_u8s8s32(p.transa, p.transb, 'F', pr.M, pr.N, pr.K,
+                          1.f, A.data() + i * pr.a_size, pr.lda, 3,
+                          B.data() + i * pr.b_size, pr.ldb, -2, 1.f,
+                          C_ref.data() + i * pr.c_size, pr.ldc, &co),
+                dnnl_success);
+
+    for (size_t i = 0; i < C.size(); i++)
+        ASSERT_EQ(C[i], C_ref[i]) << "index: " << i;
+}
+
+TEST_P(gemm_batch_test_t, TestGemmS8S8S32Grouped) {
+    const memory::dim count = p.batch_size;
+    std::vector<char> transa(count, p.transa), transb(count, p.transb);
+    std::vector<char> offsetc(count, 'R');
+    std::vector<memory::dim> M, N, K, lda, ldb, ldc;
+    std::vector<float> alpha(count, 1.f), beta(count, 0.f);
+    std::vector<int8_t> ao(count, 0), bo(count, 0);
+    std::vector<std::vector<int8_t>> A(count), B(count);
+    std::vector<std::vector<int32_t>> C(count), C_ref(count), co(count);
+    std::vector<const int8_t *> A_ptrs, B_ptrs;
+    std::vector<int32_t *> C_ptrs;
+    std::vector<const int32_t *> co_ptrs;
+    for (memory::dim i = 0; i < count; i++) {
+        const auto pr = get_problem(i, true);
+        M.push_back(pr.M);
+        N.push_back(pr.N);
+        K.push_back(pr.K);
+        lda.push_back(pr.lda);
+        ldb.push_back(pr.ldb);
+        ldc.push_back(pr.ldc);
+        A[i].resize(pr.a_size);
+        B[i].resize(pr.b_size);
+        C[i].resize(pr.c_size);
+        co[i].resize(pr.N);
+        fill(A[i], (int)i);
+        fill(B[i], (int)i + 1);
+        fill(co[i], (int)i + 2);
+        C_ref[i] = C[i];
+        A_ptrs.push_back(A[i].data());
+        B_ptrs.push_back(B[i].data());
+        C_ptrs.push_back(C[i].data());
+        co_ptrs.push_back(co[i].data());
+    }
+
+    ASSERT_EQ(dnnl_gemm_s8s8s32_grouped(count, transa.data(), transb.data(),
+                      offsetc.data(), M.data(), N.data(), K.data(),
+                      alpha.data(), A_ptrs.data(), lda.data(), ao.data(),
+                      B_ptrs.data(), ldb.data(), bo.data(), beta.data(),
+                      C_ptrs.data(), ldc.data(), co_ptrs.data()),
+            dnnl_success);
+    for (memory::dim i = 0; i < count; i++) {
+        ASSERT_EQ(dnnl_gemm_s8s8s32(transa[i], transb[i], offsetc[i], M[i],
+                          N[i], K[i], alpha[i], A[i].data(), lda[i], ao[i],
+                          B[i].data(), ldb[i], bo[i], beta[i],
+                          C_ref[i].data(), ldc[i], co[i].data()),
+                dnnl_success);
+        for (size_t j = 0; j < C[i].size(); j++)
+            ASSERT_EQ(C[i][j], C_ref[i][j])
+                    << "problem: " << i << " index: " << j;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(gemm_batch_test_params_t {'N', 'N', 1, 1, 1, 1, 1},
+                gemm_batch_test_params_t {'N', 'N', 16, 24, 32, 100, 5},
+                gemm_batch_test_params_t {'T', 'N', 13, 7, 64, 37, 4},
+                gemm_batch_test_params_t {'N', 'T', 64, 64, 64, 3, 2},
+                gemm_batch_test_params_t {'T', 'T', 200, 150, 300, 2, 3},
+                gemm_batch_test_params_t {'N', 'N', 8, 8, 0, 9, 1}));
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_iface_test_t, TestInvalidArguments) {
+    float A[4] = {0}, B[4] = {0}, C[4] = {0};
+    // Negative batch size
+    EXPECT_EQ(dnnl_sgemm_batch_strided('N', 'N', 2, 2, 2, 1.f, A, 2, 0, B, 2,
+                      0, 0.f, C, 2, 0, -1),
+            dnnl_invalid_arguments);
+    // Packed matrices are not supported
+    EXPECT_EQ(dnnl_sgemm_batch_strided('P', 'N', 2, 2, 2, 1.f, A, 2, 0, B, 2,
+                      0, 0.f, C, 2, 0, 1),
+            dnnl_invalid_arguments);
+    // Too small leading dimension in the second problem: the first one is
+    // not computed either.
+    C[0] = 1.f;
+    const char trans[2] = {'N', 'N'};
+    const memory::dim dims[2] = {2, 2}, ldc[2] = {2, 1};
+    const float alpha[2] = {1.f, 1.f}, beta[2] = {0.f, 0.f};
+    const float *A_ptrs[2] = {A, A}, *B_ptrs[2] = {B, B};
+    float *C_ptrs[2] = {C, C};
+    EXPECT_EQ(dnnl_sgemm_grouped(2, trans, trans, dims, dims, dims, alpha,
+                      A_ptrs, dims, B_ptrs, dims, beta, C_ptrs, ldc),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(C[0], 1.f);
+    // Empty batches are valid
+    EXPECT_EQ(dnnl_sgemm_grouped(0, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, nullptr),
+            dnnl_success);
+}
+
+} // namespace dnnl
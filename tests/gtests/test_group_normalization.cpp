@@ -0,0 +1,325 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gnorm_test_params_t {
+    memory::dims dims;
+    memory::dim groups;
+    memory::format_tag tag;
+    normalization_flags flags;
+    bool with_silu;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class group_normalization_test_t
+    : public ::testing::TestWithParam<gnorm_test_params_t> {
+private:
+    gnorm_test_params_t p;
+    memory::dim MB, C, CG, SP;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<gnorm_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    bool has(normalization_flags f) const {
+        return (p.flags & f) != normalization_flags::none;
+    }
+
+    // The tests use dense memory, the position of an element is taken from
+    // the memory descriptor for the blocked layouts.
+    static memory::dim off(const memory::desc &md, memory::dim n,
+            memory::dim c, memory::dim sp) {
+        const auto &d = md.data;
+        const auto &blk = d.format_desc.blocking;
+        memory::dims pos(d.ndims, 0);
+        pos[0] = n;
+        pos[1] = c;
+        for (int i = d.ndims - 1; i >= 2; --i) {
+            pos[i] = sp % d.dims[i];
+            sp /= d.dims[i];
+        }
+        memory::dim blk_sz = 1, inner_off = 0;
+        for (int i = blk.inner_nblks - 1; i >= 0; --i) {
+            const int dim = blk.inner_idxs[i];
+            inner_off += (pos[dim] % blk.inner_blks[i]) * blk_sz;
+            pos[dim] /= blk.inner_blks[i];
+            blk_sz *= blk.inner_blks[i];
+        }
+        memory::dim o = inner_off;
+        for (int i = 0; i < d.ndims; ++i)
+            o += pos[i] * blk.strides[i];
+        return o;
+    }
+
+    void compute_stats(const memory::desc &md, const float *src,
+            std::vector<float> &mean, std::vector<float> &var) const {
+        for_(memory::dim n = 0; n < MB; ++n)
+        for (memory::dim g = 0; g < p.groups; ++g) {
+            double s = 0, s2 = 0;
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp)
+                s += src[off(md, n, c, sp)];
+            const double m = s / (CG * SP);
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp) {
+                const double d = src[off(md, n, c, sp)] - m;
+                s2 += d * d;
+            }
+            mean[n * p.groups + g] = (float)m;
+            var[n * p.groups + g] = (float)(s2 / (CG * SP));
+        }
+    }
+
+    static void check(float got, float ref, const char *what, memory::dim n,
+            memory::dim c, memory::dim sp) {
+        ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::fabs(ref)))
+                << what << " n: " << n << " c: " << c << " sp: " << sp;
+    }
+
+    void Test() {
+        using dt = memory::data_type;
+        using fwd_t = group_normalization_forward;
+        using bwd_t = group_normalization_backward;
+        const float eps = 1e-5f;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        MB = p.dims[0];
+        C = p.dims[1];
+        SP = 1;
+        for (size_t d = 2; d < p.dims.size(); ++d)
+            SP *= p.dims[d];
+
+        auto data_md = memory::desc(p.dims, dt::f32, p.tag);
+        const auto fwd_flags = p.flags & ~normalization_flags::use_global_stats;
+        const auto fwd_prop = p.with_silu ? prop_kind::forward_inference
+                                          : prop_kind::forward_training;
+
+        post_ops ops;
+        if (p.with_silu)
+            ops.append_eltwise(1.f, algorithm::eltwise_swish, 1.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        auto fwd_desc = fwd_t::desc(
+                fwd_prop, data_md, data_md, p.groups, eps, fwd_flags);
+        auto fwd_pd = fwd_t::primitive_desc(fwd_desc, attr, eng);
+        CG = C / p.groups;
+        ASSERT_TRUE(fwd_pd.src_desc() == data_md);
+        ASSERT_TRUE(fwd_pd.dst_desc() == data_md);
+        auto fwd = fwd_t(fwd_pd);
+
+        const bool use_scale = has(normalization_flags::use_scale);
+        const bool use_shift = has(normalization_flags::use_shift);
+        auto ss_md = memory::desc({C}, dt::f32, memory::format_tag::x);
+        auto stat_md = memory::desc(
+                {MB, p.groups}, dt::f32, memory::format_tag::ab);
+
+        auto mem_src = test::make_memory(data_md, eng);
+        auto mem_dst = test::make_memory(data_md, eng);
+        auto mem_scale = test::make_memory(ss_md, eng);
+        auto mem_shift = test::make_memory(ss_md, eng);
+        auto mem_mean = test::make_memory(stat_md, eng);
+        auto mem_var = test::make_memory(stat_md, eng);
+        fill_data<float>(data_md.get_size() / sizeof(float), mem_src, 1.f, 2.f);
+        fill_data<float>(C, mem_scale, 1.f, 0.5f);
+        fill_data<float>(C, mem_shift, 0.f, 1.f);
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst}};
+        if (use_scale) args.insert({DNNL_ARG_SCALE, mem_scale});
+        if (use_shift) args.insert({DNNL_ARG_SHIFT, mem_shift});
+        if (fwd_prop == prop_kind::forward_training) {
+            args.insert({DNNL_ARG_MEAN, mem_mean});
+            args.insert({DNNL_ARG_VARIANCE, mem_var});
+        }
+        fwd.execute(strm, args);
+        strm.wait();
+
+        std::vector<float> mean(MB * p.groups), var(MB * p.groups);
+        {
+            auto src = map_memory<float>(mem_src);
+            auto dst = map_memory<float>(mem_dst);
+            auto scale = map_memory<float>(mem_scale);
+            auto shift = map_memory<float>(mem_shift);
+            compute_stats(data_md, src, mean, var);
+            for_(memory::dim n = 0; n < MB; ++n)
+            for_(memory::dim c = 0; c < C; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp) {
+                const memory::dim s = n * p.groups + c / CG;
+                float ref = (src[off(data_md, n, c, sp)] - mean[s])
+                        / std::sqrt(var[s] + eps);
+                if (use_scale) ref *= scale[c];
+                if (use_shift) ref += shift[c];
+                if (p.with_silu) ref = ref / (1.f + std::exp(-ref));
+                check(dst[off(data_md, n, c, sp)], ref, "dst", n, c, sp);
+            }
+        }
+
+        if (p.with_silu) return;
+
+        auto bwd_desc = bwd_t::desc(use_scale || use_shift
+                        ? prop_kind::backward
+                        : prop_kind::backward_data,
+                data_md, data_md, data_md, p.groups, eps, p.flags);
+        auto bwd_pd = bwd_t::primitive_desc(bwd_desc, eng, fwd_pd);
+        auto bwd = bwd_t(bwd_pd);
+
+        auto mem_diff_dst = test::make_memory(data_md, eng);
+        auto mem_diff_src = test::make_memory(data_md, eng);
+        auto mem_diff_scale = test::make_memory(ss_md, eng);
+        auto mem_diff_shift = test::make_memory(ss_md, eng);
+        fill_data<float>(
+                data_md.get_size() / sizeof(float), mem_diff_dst, 0.f, 1.f);
+
+        args = {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_MEAN, mem_mean},
+                {DNNL_ARG_VARIANCE, mem_var}, {DNNL_ARG_DIFF_DST, mem_diff_dst},
+                {DNNL_ARG_DIFF_SRC, mem_diff_src}};
+        if (use_scale) {
+            args.insert({DNNL_ARG_SCALE, mem_scale});
+            args.insert({DNNL_ARG_DIFF_SCALE, mem_diff_scale});
+        }
+        if (use_shift) {
+            args.insert({DNNL_ARG_SHIFT, mem_shift});
+            args.insert({DNNL_ARG_DIFF_SHIFT, mem_diff_shift});
+        }
+        bwd.execute(strm, args);
+        strm.wait();
+
+        auto src = map_memory<float>(mem_src);
+        auto diff_dst = map_memory<float>(mem_diff_dst);
+        auto diff_src = map_memory<float>(mem_diff_src);
+        auto scale = map_memory<float>(mem_scale);
+        auto diff_scale = map_memory<float>(mem_diff_scale);
+        auto diff_shift = map_memory<float>(mem_diff_shift);
+        const bool global_stats = has(normalization_flags::use_global_stats);
+        const float M = CG * SP;
+
+        for (memory::dim c = 0; c < C; ++c) {
+            double dg = 0, db = 0;
+            for_(memory::dim n = 0; n < MB; ++n)
+            for (memory::dim sp = 0; sp < SP; ++sp) {
+                const memory::dim s = n * p.groups + c / CG;
+                const float dd = diff_dst[off(data_md, n, c, sp)];
+                dg += dd * (src[off(data_md, n, c, sp)] - mean[s])
+                        / std::sqrt(var[s] + eps);
+                db += dd;
+            }
+            if (use_scale)
+                check(diff_scale[c], (float)dg, "diff_scale", 0, c, 0);
+            if (use_shift)
+                check(diff_shift[c], (float)db, "diff_shift", 0, c, 0);
+        }
+
+        for_(memory::dim n = 0; n < MB; ++n)
+        for (memory::dim g = 0; g < p.groups; ++g) {
+            const memory::dim s = n * p.groups + g;
+            const float r = 1.f / std::sqrt(var[s] + eps);
+            double A = 0, B = 0;
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp) {
+                const float gamma = use_scale ? scale[c] : 1.f;
+                const float dd = diff_dst[off(data_md, n, c, sp)];
+                A += gamma * dd;
+                B += gamma * dd * (src[off(data_md, n, c, sp)] - mean[s]);
+            }
+            for_(memory::dim c = g * CG; c < (g + 1) * CG; ++c)
+            for (memory::dim sp = 0; sp < SP; ++sp) {
+                const float gamma = use_scale ? scale[c] : 1.f;
+                const memory::dim o = off(data_md, n, c, sp);
+                float ref = gamma * diff_dst[o];
+                if (!global_stats)
+                    ref -= (float)(A / M
+                            + (src[o] - mean[s]) * B * r * r / M);
+                ref *= r;
+                check(diff_src[o], ref, "diff_src", n, c, sp);
+            }
+        }
+    }
+};
+
+using tag = memory::format_tag;
+using flags = normalization_flags;
+static const auto ss = flags::use_scale | flags::use_shift;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // channels not divisible by the groups
+            gnorm_test_params_t {{2, 30, 4, 4}, 4, tag::nhwc, flags::none,
+                    false, true, dnnl_invalid_arguments},
+            // zero groups
+            gnorm_test_params_t {{2, 32, 4, 4}, 0, tag::nhwc, flags::none,
+                    false, true, dnnl_invalid_arguments});
+};
+
+static auto channels_last_cases = []() {
+    return ::testing::Values(
+            gnorm_test_params_t {{2, 32}, 4, tag::nc, ss, false},
+            gnorm_test_params_t {{3, 24, 17}, 3, tag::nwc, flags::none, false},
+            gnorm_test_params_t {{2, 64, 9, 7}, 32, tag::nhwc, ss, false},
+            gnorm_test_params_t {{2, 20, 5, 6}, 5, tag::nhwc,
+                    flags::use_scale, false},
+            gnorm_test_params_t {{1, 320, 8, 8}, 32, tag::nhwc,
+                    ss | flags::use_global_stats, false},
+            gnorm_test_params_t {{2, 48, 3, 4, 5}, 4, tag::ndhwc, ss, false});
+};
+
+static auto blocked_cases = []() {
+    return ::testing::Values(
+            gnorm_test_params_t {{2, 32, 19}, 8, tag::nCw8c, ss, false},
+            gnorm_test_params_t {{2, 64, 7, 9}, 4, tag::nChw16c, ss, false},
+            gnorm_test_params_t {{1, 48, 6, 5}, 12, tag::nChw8c,
+                    flags::use_shift, false},
+            gnorm_test_params_t {{2, 32, 3, 4, 5}, 2, tag::nCdhw16c,
+                    ss | flags::use_global_stats, false});
+};
+
+static auto silu_cases = []() {
+    return ::testing::Values(
+            gnorm_test_params_t {{2, 64, 8, 8}, 32, tag::nhwc, ss, true},
+            gnorm_test_params_t {{2, 40, 5, 7}, 10, tag::nhwc, ss, true},
+            gnorm_test_params_t {{2, 64, 8, 8}, 16, tag::nChw16c, ss, true},
+            gnorm_test_params_t {{1, 32, 4, 4}, 8, tag::nchw, ss, true});
+};
+
+TEST_P(group_normalization_test_t, TestsGroupNormalization) {}
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationEF, group_normalization_test_t,
+        expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationChannelsLast,
+        group_normalization_test_t, channels_last_cases());
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationBlocked,
+        group_normalization_test_t, blocked_cases());
+INSTANTIATE_TEST_SUITE_P(TestGroupNormalizationSilu,
+        group_normalization_test_t, silu_cases());
+
+} // namespace dnnl
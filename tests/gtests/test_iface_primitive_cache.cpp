@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -109,6 +111,72 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestStats) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    reset_primitive_cache_stats();
+
+    fill_primitive_cache(6);
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.misses, 6u);
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.evictions, 2u);
+    ASSERT_EQ(stats.entries, 4u);
+    ASSERT_GT(stats.resident_bytes, 0u);
+
+    // Entries 2..5 are in the cache.
+    engine eng(get_test_engine_kind(), 0);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu,
+            {{5, 1, 1, 1}, memory::data_type::f32, memory::format_tag::nchw},
+            0.f, 0.f);
+    auto relu = eltwise_forward(eltwise_forward::primitive_desc(relu_d, eng));
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 6u);
+
+    reset_primitive_cache_stats();
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 0u);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_EQ(stats.creation_time_ns, 0u);
+    ASSERT_EQ(stats.entries, 4u);
+}
+
+TEST(primitive_cache_test, TestCapacityBytes) {
+    // The default budget can be set with the environment variable.
+    const size_t default_budget = get_primitive_cache_capacity_bytes();
+    if (!std::getenv("ONEDNN_PRIMITIVE_CACHE_CAPACITY_MB")
+            && !std::getenv("DNNL_PRIMITIVE_CACHE_CAPACITY_MB")) {
+        ASSERT_EQ(default_budget, 0u);
+    }
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    fill_primitive_cache(16);
+    auto stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.entries, 16u);
+
+    // Halving the budget must evict entries until the rest fits.
+    const size_t budget = stats.resident_bytes / 2;
+    set_primitive_cache_capacity_bytes(budget);
+    ASSERT_EQ(get_primitive_cache_capacity_bytes(), budget);
+    stats = get_primitive_cache_stats();
+    ASSERT_LT(stats.entries, 16u);
+    ASSERT_LE(stats.resident_bytes, budget);
+    ASSERT_EQ(get_primitive_cache_size(), (int)stats.entries);
+
+    // New entries keep the cache within the budget.
+    fill_primitive_cache(32);
+    stats = get_primitive_cache_stats();
+    ASSERT_LE(stats.resident_bytes, budget);
+
+    set_primitive_cache_capacity_bytes(0);
+    ASSERT_EQ(get_primitive_cache_capacity_bytes(), 0u);
+    set_primitive_cache_capacity_bytes(default_budget);
+}
 #endif
 
 } // namespace dnnl
@@ -14,6 +14,19 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -23,6 +36,14 @@ namespace dnnl {
 
 class persistent_cache_api_test_t : public ::testing::Test {};
 
+static dnnl_status_t get_cache_blob(
+        const primitive &p, std::vector<uint8_t> &cache_blob) {
+    try {
+        cache_blob = p.get_cache_blob();
+    } catch (error &err) { return err.status; }
+    return dnnl_success;
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPI) {
     engine e = get_test_engine();
@@ -44,20 +65,200 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
+    if (get_test_engine_kind() == engine::kind::gpu
+            && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
         EXPECT_ANY_THROW(convolution_forward(pd, cache_blob));
+        return;
+    }
+
+    ASSERT_EQ(cache_blob_id.empty(), false);
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        // On CPU a cache blob is available only for implementations with
+        // relocatable JIT kernels.
+        const dnnl_status_t status = get_cache_blob(p, cache_blob);
+        SKIP_IF(status == dnnl_unimplemented,
+                "The implementation does not support cache blobs.");
+        ASSERT_EQ(status, dnnl_success);
     } else {
-        ASSERT_EQ(cache_blob_id.empty(), false);
         ASSERT_NO_THROW(cache_blob = p.get_cache_blob());
-        ASSERT_EQ(cache_blob.empty(), false);
-        ASSERT_NO_THROW(p = convolution_forward(pd, cache_blob));
-        ASSERT_EQ(cache_blob, p.get_cache_blob());
+    }
+    ASSERT_EQ(cache_blob.empty(), false);
+    ASSERT_NO_THROW(p = convolution_forward(pd, cache_blob));
+    ASSERT_EQ(cache_blob, p.get_cache_blob());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIReorder) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Test is for CPU engine only");
+    engine e = get_test_engine();
+    memory::desc src_md(
+            {2, 32, 7, 7}, memory::data_type::f32, memory::format_tag::nchw);
+    memory::desc dst_md(
+            {2, 32, 7, 7}, memory::data_type::f32, memory::format_tag::nhwc);
+    auto pd = reorder::primitive_desc(e, src_md, e, dst_md);
+    auto p = reorder(pd);
+
+    std::vector<uint8_t> cache_blob;
+    const dnnl_status_t status = get_cache_blob(p, cache_blob);
+    SKIP_IF(status == dnnl_unimplemented,
+            "The implementation does not support cache blobs.");
+    ASSERT_EQ(status, dnnl_success);
+    ASSERT_EQ(cache_blob.empty(), false);
+
+    // Disable the primitive cache to make sure the primitive is created from
+    // the cache blob.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    reorder p_from_blob;
+    ASSERT_NO_THROW(p_from_blob = reorder(pd, cache_blob));
+    set_primitive_cache_capacity(capacity);
+    ASSERT_EQ(cache_blob, p_from_blob.get_cache_blob());
+
+    memory src(src_md, e), dst(dst_md, e), dst_ref(dst_md, e);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    stream s(e);
+    p.execute(s, src, dst_ref);
+    p_from_blob.execute(s, src, dst);
+    s.wait();
+    compare_data<float>(dst_ref, dst);
+}
+
+#ifndef _WIN32
+class jit_cache_dir_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char dir_template[] = "/tmp/onednn_jit_cache_XXXXXX";
+        ASSERT_NE(mkdtemp(dir_template), nullptr);
+        dir_ = dir_template;
+        capacity_ = get_primitive_cache_capacity();
+        // The primitive cache is disabled so that every primitive creation
+        // goes through the JIT cache directory.
+        set_primitive_cache_capacity(0);
+        ASSERT_EQ(set_jit_cache_dir(dir_), status::success);
+    }
+
+    void TearDown() override {
+        set_jit_cache_dir("");
+        set_primitive_cache_capacity(capacity_);
+        for (const auto &f : list_files())
+            std::remove(f.c_str());
+        rmdir(dir_.c_str());
+    }
+
+    std::vector<std::string> list_files() const {
+        std::vector<std::string> files;
+        DIR *d = opendir(dir_.c_str());
+        if (!d) return files;
+        while (const dirent *e = readdir(d)) {
+            const std::string name = e->d_name;
+            if (name != "." && name != "..") files.push_back(dir_ + "/" + name);
+        }
+        closedir(d);
+        return files;
+    }
+
+    static std::vector<uint8_t> read_file(const std::string &name) {
+        std::ifstream f(name, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), {});
+    }
+
+    static void write_file(
+            const std::string &name, const std::vector<uint8_t> &data) {
+        std::ofstream f(name, std::ios::binary | std::ios::trunc);
+        f.write(reinterpret_cast<const char *>(data.data()), data.size());
+    }
+
+    // The inode changes when an entry is (re)written, since entries are
+    // written to a temporary file that is renamed afterwards.
+    static ino_t get_inode(const std::string &name) {
+        struct stat st;
+        return stat(name.c_str(), &st) == 0 ? st.st_ino : 0;
+    }
+
+    // Creates and executes a reorder, checking it against the reference
+    // reorder created with the JIT cache directory disabled.
+    void create_and_check() {
+        engine e = get_test_engine();
+        memory::desc src_md({2, 32, 7, 7}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory::desc dst_md({2, 32, 7, 7}, memory::data_type::f32,
+                memory::format_tag::nhwc);
+        auto p = reorder(reorder::primitive_desc(e, src_md, e, dst_md));
+
+        set_jit_cache_dir("");
+        auto p_ref = reorder(reorder::primitive_desc(e, src_md, e, dst_md));
+        set_jit_cache_dir(dir_);
+
+        memory src(src_md, e), dst(dst_md, e), dst_ref(dst_md, e);
+        fill_data<float>(src_md.get_size() / sizeof(float), src);
+        stream s(e);
+        p.execute(s, src, dst);
+        p_ref.execute(s, src, dst_ref);
+        s.wait();
+        compare_data<float>(dst_ref, dst);
+    }
+
+    std::string dir_;
+    int capacity_ = 0;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(jit_cache_dir_test_t, TestStoreAndLoad) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Test is for CPU engine only");
+
+    create_and_check();
+    auto files = list_files();
+    SKIP_IF(files.empty(), "The implementation does not support cache blobs.");
+    ASSERT_EQ(files.size(), 1u);
+    const auto &entry = files[0];
+    const auto data = read_file(entry);
+    ASSERT_FALSE(data.empty());
+    const ino_t inode = get_inode(entry);
+
+    // The primitive is created from the entry, so the entry is not written
+    // again.
+    create_and_check();
+    ASSERT_EQ(list_files().size(), 1u);
+    ASSERT_EQ(get_inode(entry), inode);
+    ASSERT_EQ(read_file(entry), data);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(jit_cache_dir_test_t, TestCorruptedEntry) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Test is for CPU engine only");
+
+    create_and_check();
+    auto files = list_files();
+    SKIP_IF(files.empty(), "The implementation does not support cache blobs.");
+    ASSERT_EQ(files.size(), 1u);
+    const auto &entry = files[0];
+    const auto data = read_file(entry);
+    ASSERT_FALSE(data.empty());
+
+    // Damaged entries are ignored and replaced with a valid one: an entry
+    // with a stale ID, a truncated entry and an entry with garbage code.
+    std::vector<std::vector<uint8_t>> bad_entries;
+    auto stale = data;
+    // The ID follows the magic, the version and the ID size.
+    stale[2 * sizeof(uint32_t) + sizeof(size_t)] ^= 0xff;
+    bad_entries.push_back(stale);
+    bad_entries.emplace_back(data.begin(), data.begin() + data.size() / 2);
+    auto garbage = data;
+    for (size_t i = garbage.size() / 2; i < garbage.size(); i++)
+        garbage[i] = (uint8_t)i;
+    bad_entries.push_back(garbage);
+
+    for (const auto &bad : bad_entries) {
+        write_file(entry, bad);
+        create_and_check();
+        ASSERT_EQ(list_files().size(), 1u);
+        ASSERT_EQ(read_file(entry), data);
     }
 }
+#endif
 
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -102,4 +104,66 @@ TEST(primitive_cache_mt_test, TestMTCacheHit) {
     ASSERT_EQ(get_primitive_cache_size(), n_primitives);
 }
 
+// Checks the bookkeeping of the cache when all threads are hitting, missing
+// and evicting entries concurrently, and that entries stay reachable when
+// they are redistributed between the cache partitions.
+TEST(primitive_cache_mt_test, TestMTEviction) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    // Big enough for the cache to be partitioned.
+    const int capacity = 256;
+    const int n_iters = 128;
+
+    // Flush the cache
+    dnnl::set_primitive_cache_capacity(0);
+    dnnl::set_primitive_cache_capacity(capacity);
+    dnnl::reset_primitive_cache_stats();
+
+    auto create_eltwise_primitive = [&](int np) {
+        auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_relu,
+                {{np + 1, 1, 1, 1}, dt::f32, tag::nchw}, 0.f, 0.f);
+        auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
+        auto relu = eltwise_forward(relu_pd);
+    };
+
+    std::atomic<int> n_created(0);
+    dnnl::impl::parallel(0, [&](int ithr, int nthr) {
+        for (int i = 0; i < n_iters; i++) {
+            // Even iterations reuse a small set of keys shared by all the
+            // threads, odd ones use keys unique for every thread.
+            const int np = i % 2 == 0 ? i % 16 : 16 + ithr * n_iters + i;
+            create_eltwise_primitive(np);
+            n_created++;
+        }
+    });
+
+    auto stats = dnnl::get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses, (uint64_t)n_created);
+    ASSERT_LE(stats.entries, (uint64_t)capacity);
+    ASSERT_EQ(stats.entries, (uint64_t)get_primitive_cache_size());
+    ASSERT_EQ(stats.misses - stats.evictions, stats.entries);
+
+    // Shrinking the cache to a single partition keeps the entries that fit.
+    dnnl::set_primitive_cache_capacity(0);
+    dnnl::set_primitive_cache_capacity(capacity);
+    const int n_primitives = 64;
+    for (int i = 0; i < n_primitives; i++)
+        create_eltwise_primitive(i);
+    dnnl::set_primitive_cache_capacity(n_primitives);
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+
+    dnnl::reset_primitive_cache_stats();
+    dnnl::impl::parallel(0, [&](int ithr, int nthr) {
+        for (int i = ithr; i < n_primitives; i += nthr)
+            create_eltwise_primitive(i);
+    });
+    stats = dnnl::get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits, (uint64_t)n_primitives);
+    ASSERT_EQ(stats.misses, 0u);
+}
+
 } // namespace dnnl
@@ -0,0 +1,325 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct rnn_seq_lengths_params_t {
+    algorithm cell_kind;
+    // The data type of the layer and iteration states. The weights of u8
+    // RNNs are s8, the c states are always f32.
+    dt data_type;
+    rnn_direction direction;
+    std::vector<int32_t> seq_lengths;
+};
+
+// Checks that a batch run with per-sample sequence lengths matches the runs
+// of every sample alone on its own sequence length.
+class rnn_seq_lengths_test_t
+    : public ::testing::TestWithParam<rnn_seq_lengths_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "GPU engine does not support sequence lengths.");
+        auto p = ::testing::TestWithParam<
+                rnn_seq_lengths_params_t>::GetParam();
+        catch_expected_failures([=]() { Test(p); }, false, dnnl_success,
+                p.data_type == dt::u8);
+    }
+
+    // Fills `v` with values in [-0.5, 0.5] or, for u8 data, with integers in
+    // [78, 178].
+    static void fill(std::vector<float> &v, float seed, dt data_type) {
+        for (size_t i = 0; i < v.size(); i++) {
+            const float val = 0.5f * std::sin(seed + 0.37f * (float)i);
+            v[i] = data_type == dt::u8 ? std::round(128.f + 100.f * val) : val;
+        }
+    }
+
+    static memory make_memory(const memory::desc &md, const engine &eng,
+            const std::vector<float> &v) {
+        memory m(md, eng);
+        if (md.data_type() == dt::u8) {
+            auto *ptr = static_cast<uint8_t *>(m.get_data_handle());
+            for (size_t i = 0; i < v.size(); i++)
+                ptr[i] = static_cast<uint8_t>(v[i]);
+        } else {
+            std::memcpy(
+                    m.get_data_handle(), v.data(), v.size() * sizeof(float));
+        }
+        return m;
+    }
+
+    static void read_memory(const memory &m, std::vector<float> &v) {
+        if (m.get_desc().data_type() == dt::u8) {
+            const auto *ptr = static_cast<const uint8_t *>(m.get_data_handle());
+            for (size_t i = 0; i < v.size(); i++)
+                v[i] = ptr[i];
+        } else {
+            std::memcpy(
+                    v.data(), m.get_data_handle(), v.size() * sizeof(float));
+        }
+    }
+
+    // Creates the primitive descriptor of the RNN.
+    static rnn_primitive_desc_base create_pd(const rnn_seq_lengths_params_t &p,
+            const memory::desc &src_layer_md, const memory::desc &src_iter_md,
+            const memory::desc &src_iter_c_md, const memory::desc &wei_md,
+            const memory::desc &bias_md, const memory::desc &dst_layer_md,
+            rnn_flags flags, const primitive_attr &attr, const engine &eng) {
+        const auto prop = prop_kind::forward_inference;
+        switch (p.cell_kind) {
+            case algorithm::vanilla_lstm:
+                return lstm_forward::primitive_desc(
+                        {prop, p.direction, src_layer_md, src_iter_md,
+                                src_iter_c_md, wei_md, wei_md, bias_md,
+                                dst_layer_md, src_iter_md, src_iter_c_md,
+                                flags},
+                        attr, eng);
+            case algorithm::vanilla_gru:
+                return gru_forward::primitive_desc(
+                        {prop, p.direction, src_layer_md, src_iter_md, wei_md,
+                                wei_md, bias_md, dst_layer_md, src_iter_md,
+                                flags},
+                        attr, eng);
+            case algorithm::lbr_gru:
+                return lbr_gru_forward::primitive_desc(
+                        {prop, p.direction, src_layer_md, src_iter_md, wei_md,
+                                wei_md, bias_md, dst_layer_md, src_iter_md,
+                                flags},
+                        attr, eng);
+            default: assert(!"unexpected cell kind");
+        }
+        return rnn_primitive_desc_base();
+    }
+
+    // Runs the RNN on the whole batch or, if `b >= 0`, on sample `b` only.
+    void run(const rnn_seq_lengths_params_t &p, int b, memory::dim T,
+            std::vector<float> &dst_layer, std::vector<float> &dst_iter,
+            std::vector<float> &dst_iter_c) {
+        const memory::dim N = b < 0 ? MB : 1;
+        const memory::dim D
+                = p.direction == rnn_direction::bidirectional_concat ? 2 : 1;
+        const memory::dim DLC = D == 2 ? 2 * C : C;
+        const bool is_lstm = p.cell_kind == algorithm::vanilla_lstm;
+        const bool is_int8 = p.data_type == dt::u8;
+        const memory::dim G = is_lstm ? 4 : 3;
+        const memory::dim BG
+                = p.cell_kind == algorithm::lbr_gru ? G + 1 : G;
+
+        auto src_layer_md = memory::desc({T, N, C}, p.data_type, tag::tnc);
+        auto src_iter_md = memory::desc({L, D, N, C}, p.data_type, tag::ldnc);
+        auto src_iter_c_md = is_lstm
+                ? memory::desc({L, D, N, C}, dt::f32, tag::ldnc)
+                : memory::desc();
+        auto user_wei_md = memory::desc({L, D, C, G, C}, dt::f32, tag::ldigo);
+        auto wei_md = is_int8
+                ? memory::desc({L, D, C, G, C}, dt::s8, tag::any)
+                : user_wei_md;
+        auto bias_md = memory::desc({L, D, BG, C}, dt::f32, tag::ldgo);
+        auto dst_layer_md = memory::desc({T, N, DLC}, p.data_type, tag::tnc);
+
+        primitive_attr attr;
+        if (is_int8) {
+            attr.set_rnn_data_qparams(100.f, 128.f);
+            attr.set_rnn_weights_qparams(0, {120.f});
+        }
+        auto pd = create_pd(p, src_layer_md, src_iter_md, src_iter_c_md,
+                wei_md, bias_md, dst_layer_md,
+                b < 0 ? rnn_flags::seq_lengths : rnn_flags::undef, attr, eng);
+        if (b < 0) {
+            ASSERT_TRUE(pd.seq_lengths_desc()
+                    == memory::desc({MB}, dt::s32, tag::a));
+        }
+
+        // Slice the inputs of sample `b`
+        std::vector<float> src_layer(T * N * C), src_iter(L * D * N * C),
+                src_iter_c(L * D * N * C);
+        for (memory::dim t = 0; t < T; t++)
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim c = 0; c < C; c++) {
+                    const memory::dim bn = b < 0 ? n : b;
+                    src_layer[(t * N + n) * C + c]
+                            = src_layer_full[(t * MB + bn) * C + c];
+                }
+        for (memory::dim ld = 0; ld < L * D; ld++)
+            for (memory::dim n = 0; n < N; n++)
+                for (memory::dim c = 0; c < C; c++) {
+                    const memory::dim bn = b < 0 ? n : b;
+                    const size_t full = (ld * MB + bn) * C + c;
+                    src_iter[(ld * N + n) * C + c] = src_iter_full[full];
+                    src_iter_c[(ld * N + n) * C + c] = src_iter_c_full[full];
+                }
+
+        std::vector<float> wei_layer(L * D * C * G * C),
+                wei_iter(L * D * C * G * C), bias(L * D * BG * C);
+        fill(wei_layer, 1.f, dt::f32);
+        fill(wei_iter, 2.f, dt::f32);
+        fill(bias, 3.f, dt::f32);
+        std::vector<int32_t> seq_lengths = p.seq_lengths;
+
+        // The weights are quantized with the attributes of the RNN
+        stream strm(eng);
+        auto reorder_weights = [&](const memory::desc &md,
+                                       const std::vector<float> &v) {
+            auto user_mem = make_memory(user_wei_md, eng, v);
+            if (md == user_wei_md) return user_mem;
+            memory mem(md, eng);
+            reorder(reorder::primitive_desc(user_mem, mem, attr))
+                    .execute(strm, user_mem, mem);
+            strm.wait();
+            return mem;
+        };
+
+        auto dst_layer_mem = memory(dst_layer_md, eng);
+        auto dst_iter_mem = memory(src_iter_md, eng);
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC_LAYER, make_memory(src_layer_md, eng, src_layer)},
+                {DNNL_ARG_SRC_ITER, make_memory(src_iter_md, eng, src_iter)},
+                {DNNL_ARG_WEIGHTS_LAYER,
+                        reorder_weights(pd.weights_layer_desc(), wei_layer)},
+                {DNNL_ARG_WEIGHTS_ITER,
+                        reorder_weights(pd.weights_iter_desc(), wei_iter)},
+                {DNNL_ARG_BIAS, make_memory(bias_md, eng, bias)},
+                {DNNL_ARG_DST_LAYER, dst_layer_mem},
+                {DNNL_ARG_DST_ITER, dst_iter_mem}};
+        memory dst_iter_c_mem;
+        if (is_lstm) {
+            dst_iter_c_mem = memory(src_iter_c_md, eng);
+            args.insert({DNNL_ARG_SRC_ITER_C,
+                    make_memory(src_iter_c_md, eng, src_iter_c)});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c_mem});
+        }
+        if (b < 0)
+            args.insert({DNNL_ARG_SEQ_LENGTHS,
+                    memory({{MB}, dt::s32, tag::a}, eng, seq_lengths.data())});
+
+        primitive(pd).execute(strm, args);
+        strm.wait();
+
+        dst_layer.resize(T * N * DLC);
+        dst_iter.resize(L * D * N * C);
+        read_memory(dst_layer_mem, dst_layer);
+        read_memory(dst_iter_mem, dst_iter);
+        if (is_lstm) {
+            dst_iter_c.resize(L * D * N * C);
+            read_memory(dst_iter_c_mem, dst_iter_c);
+        } else {
+            dst_iter_c.clear();
+        }
+    }
+
+    void Test(const rnn_seq_lengths_params_t &p) {
+        MB = (memory::dim)p.seq_lengths.size();
+        src_layer_full.resize(T_max * MB * C);
+        src_iter_full.resize(L * 2 * MB * C);
+        src_iter_c_full.resize(L * 2 * MB * C);
+        fill(src_layer_full, 4.f, p.data_type);
+        fill(src_iter_full, 5.f, p.data_type);
+        fill(src_iter_c_full, 6.f, dt::f32);
+
+        const memory::dim D
+                = p.direction == rnn_direction::bidirectional_concat ? 2 : 1;
+        const memory::dim DLC = D == 2 ? 2 * C : C;
+        const bool is_lstm = p.cell_kind == algorithm::vanilla_lstm;
+
+        std::vector<float> dst_layer, dst_iter, dst_iter_c;
+        run(p, -1, T_max, dst_layer, dst_iter, dst_iter_c);
+
+        // Quantized states may differ by one unit due to rounding
+        const float eps = p.data_type == dt::u8 ? 1.f : 1e-5f;
+        const float eps_c = 1e-5f;
+        for (int b = 0; b < MB; b++) {
+            const memory::dim len = p.seq_lengths[b];
+            for (memory::dim t = len; t < T_max; t++)
+                for (memory::dim c = 0; c < DLC; c++)
+                    ASSERT_EQ(dst_layer[(t * MB + b) * DLC + c], 0.f);
+
+            // The states of an empty sequence are the initial ones
+            if (len == 0) {
+                for (memory::dim ld = 0; ld < L * D; ld++)
+                    for (memory::dim c = 0; c < C; c++) {
+                        const size_t off = (ld * MB + b) * C + c;
+                        ASSERT_EQ(dst_iter[off], src_iter_full[off]);
+                        if (is_lstm) {
+                            ASSERT_EQ(dst_iter_c[off], src_iter_c_full[off]);
+                        }
+                    }
+                continue;
+            }
+
+            std::vector<float> ref_layer, ref_iter, ref_iter_c;
+            run(p, b, len, ref_layer, ref_iter, ref_iter_c);
+
+            for (memory::dim t = 0; t < len; t++)
+                for (memory::dim c = 0; c < DLC; c++)
+                    ASSERT_NEAR(dst_layer[(t * MB + b) * DLC + c],
+                            ref_layer[t * DLC + c], eps);
+            for (memory::dim ld = 0; ld < L * D; ld++)
+                for (memory::dim c = 0; c < C; c++) {
+                    const size_t off = (ld * MB + b) * C + c;
+                    ASSERT_NEAR(dst_iter[off], ref_iter[ld * C + c], eps);
+                    if (is_lstm) {
+                        ASSERT_NEAR(dst_iter_c[off], ref_iter_c[ld * C + c],
+                                eps_c);
+                    }
+                }
+        }
+    }
+
+    const memory::dim L = 2, C = 8, T_max = 6;
+    memory::dim MB = 0;
+    std::vector<float> src_layer_full, src_iter_full, src_iter_c_full;
+    engine eng = get_test_engine();
+};
+
+TEST_P(rnn_seq_lengths_test_t, TestsSeqLengths) {}
+
+namespace {
+std::vector<rnn_seq_lengths_params_t> cases(algorithm cell_kind, dt data_type) {
+    return {{cell_kind, data_type, rnn_direction::unidirectional,
+                    {6, 4, 4, 1}},
+            {cell_kind, data_type, rnn_direction::unidirectional,
+                    {2, 6, 0, 5}},
+            {cell_kind, data_type, rnn_direction::unidirectional_right2left,
+                    {3, 6, 1}},
+            {cell_kind, data_type, rnn_direction::bidirectional_concat,
+                    {5, 2, 6}}};
+}
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengthsLSTM, rnn_seq_lengths_test_t,
+        ::testing::ValuesIn(cases(algorithm::vanilla_lstm, dt::f32)));
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengthsGRU, rnn_seq_lengths_test_t,
+        ::testing::ValuesIn(cases(algorithm::vanilla_gru, dt::f32)));
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengthsLBRGRU, rnn_seq_lengths_test_t,
+        ::testing::ValuesIn(cases(algorithm::lbr_gru, dt::f32)));
+INSTANTIATE_TEST_SUITE_P(TestRnnSeqLengthsLSTMInt8, rnn_seq_lengths_test_t,
+        ::testing::ValuesIn(cases(algorithm::vanilla_lstm, dt::u8)));
+
+} // namespace dnnl
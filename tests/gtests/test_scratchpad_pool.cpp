@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class scratchpad_pool_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        default_capacity_ = get_scratchpad_pool_capacity_bytes();
+    }
+    void TearDown() override {
+        set_scratchpad_pool_capacity_bytes(default_capacity_);
+    }
+
+    // RNN primitives always require a scratchpad.
+    vanilla_rnn_forward::primitive_desc make_pd(const engine &eng) {
+        const memory::dim T = 4, N = 8, C = 64;
+        auto src_layer_md = memory::desc({T, N, C}, dt::f32, tag::tnc);
+        auto wei_md = memory::desc({1, 1, C, 1, C}, dt::f32, tag::any);
+        auto bias_md = memory::desc({1, 1, 1, C}, dt::f32, tag::ldgo);
+        auto dst_layer_md = memory::desc({T, N, C}, dt::f32, tag::tnc);
+        auto desc = vanilla_rnn_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_tanh,
+                rnn_direction::unidirectional_left2right, src_layer_md,
+                memory::desc(), wei_md, wei_md, bias_md, dst_layer_md,
+                memory::desc());
+        return vanilla_rnn_forward::primitive_desc(desc, eng);
+    }
+
+    size_t default_capacity_ = 0;
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(scratchpad_pool_test_t, TestReuse) {
+    engine eng(engine::kind::cpu, 0);
+    auto pd = make_pd(eng);
+    ASSERT_GT(pd.scratchpad_desc().get_size(), 0U);
+
+    set_scratchpad_pool_capacity_bytes(size_t(64) << 20);
+    ASSERT_EQ(get_scratchpad_pool_capacity_bytes(), size_t(64) << 20);
+
+    // The scratchpad buffer is retained when the primitive is destroyed...
+    { auto rnn = vanilla_rnn_forward(pd); }
+    auto stats = get_scratchpad_pool_stats();
+    ASSERT_GT(stats.retained_bytes, 0U);
+    ASSERT_GE(stats.peak_bytes, stats.retained_bytes);
+
+    // ...and reused by the next one.
+    reset_scratchpad_pool_stats();
+    {
+        auto rnn = vanilla_rnn_forward(pd);
+        stats = get_scratchpad_pool_stats();
+        ASSERT_GT(stats.in_use_bytes, 0U);
+    }
+    ASSERT_GE(stats.hits, 1U);
+    ASSERT_EQ(stats.misses, 0U);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(scratchpad_pool_test_t, TestZeroCapacity) {
+    engine eng(engine::kind::cpu, 0);
+    auto pd = make_pd(eng);
+
+    set_scratchpad_pool_capacity_bytes(size_t(64) << 20);
+    { auto rnn = vanilla_rnn_forward(pd); }
+    ASSERT_GT(get_scratchpad_pool_stats().retained_bytes, 0U);
+
+    // Reducing the capacity frees the retained buffers.
+    set_scratchpad_pool_capacity_bytes(0);
+    ASSERT_EQ(get_scratchpad_pool_stats().retained_bytes, 0U);
+
+    { auto rnn = vanilla_rnn_forward(pd); }
+    ASSERT_EQ(get_scratchpad_pool_stats().retained_bytes, 0U);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(scratchpad_pool_test_t, TestEngineLifetime) {
+    set_scratchpad_pool_capacity_bytes(size_t(64) << 20);
+    {
+        engine eng(engine::kind::cpu, 0);
+        auto pd = make_pd(eng);
+        { auto rnn = vanilla_rnn_forward(pd); }
+        ASSERT_GT(get_scratchpad_pool_stats().retained_bytes, 0U);
+    }
+    // The pool of a destroyed engine releases its buffers. Other engines
+    // created by the tests must not hold any.
+    ASSERT_EQ(get_scratchpad_pool_stats().retained_bytes, 0U);
+}
+
+} // namespace dnnl
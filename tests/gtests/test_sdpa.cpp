@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct sdpa_test_params_t {
+    memory::dims q_dims;
+    memory::dims k_dims;
+    memory::dims v_dims;
+    memory::dims mask_dims; // Empty if there is no mask.
+    bool causal;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class sdpa_test_t : public ::testing::TestWithParam<sdpa_test_params_t> {
+private:
+    sdpa_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<sdpa_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static memory::format_tag plain_tag(size_t ndims) {
+        switch (ndims) {
+            case 2: return memory::format_tag::ab;
+            case 3: return memory::format_tag::abc;
+            case 4: return memory::format_tag::abcd;
+            default: return memory::format_tag::undef;
+        }
+    }
+
+    // Computes the attention for the plain layouts and compares it with
+    // `dst`.
+    void check(const float *q, const float *k, const float *v,
+            const float *mask, const float *dst, float scale) {
+        const size_t nd = p.q_dims.size();
+        memory::dim MB = 1;
+        for (size_t d = 0; d < nd - 2; d++)
+            MB *= p.q_dims[d];
+        const memory::dim SQ = p.q_dims[nd - 2], D = p.q_dims[nd - 1];
+        const memory::dim SKV = p.k_dims[nd - 2], DV = p.v_dims[nd - 1];
+        // The masks of the tests are 3D and broadcast along their
+        // dimensions set to one.
+        const bool with_mask = mask != nullptr;
+        const memory::dim mask_mb_stride
+                = with_mask && p.mask_dims[0] > 1 ? p.mask_dims[1] * SKV : 0;
+        const memory::dim mask_q_stride
+                = with_mask && p.mask_dims[1] > 1 ? SKV : 0;
+
+        std::vector<float> s(SKV);
+        for_(memory::dim mb = 0; mb < MB; mb++)
+        for (memory::dim i = 0; i < SQ; i++) {
+            const memory::dim n_keys = p.causal
+                    ? std::max<memory::dim>(
+                            0, std::min(SKV, i + SKV - SQ + 1))
+                    : SKV;
+            float max_s = -INFINITY;
+            for (memory::dim j = 0; j < n_keys; j++) {
+                float acc = 0;
+                for (memory::dim c = 0; c < D; c++)
+                    acc += q[(mb * SQ + i) * D + c] * k[(mb * SKV + j) * D + c];
+                s[j] = acc * scale;
+                if (with_mask)
+                    s[j] += mask[mb * mask_mb_stride + i * mask_q_stride + j];
+                max_s = std::max(max_s, s[j]);
+            }
+            float denom = 0;
+            for (memory::dim j = 0; j < n_keys; j++) {
+                s[j] = std::exp(s[j] - max_s);
+                denom += s[j];
+            }
+            for (memory::dim c = 0; c < DV; c++) {
+                float ref = 0;
+                for (memory::dim j = 0; j < n_keys; j++)
+                    ref += s[j] * v[(mb * SKV + j) * DV + c];
+                ref = n_keys > 0 ? ref / denom : 0.f;
+                const float got = dst[(mb * SQ + i) * DV + c];
+                ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::fabs(ref)))
+                        << "mb: " << mb << " i: " << i << " c: " << c;
+            }
+        }
+    }
+
+    void Test() {
+        using op_desc_t = sdpa_forward::desc;
+        using pd_t = sdpa_forward::primitive_desc;
+        using dt = memory::data_type;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const size_t nd = p.q_dims.size();
+        const bool with_mask = !p.mask_dims.empty();
+        auto q_md = memory::desc(p.q_dims, dt::f32, plain_tag(nd));
+        auto k_md = memory::desc(p.k_dims, dt::f32, plain_tag(nd));
+        auto v_md = memory::desc(p.v_dims, dt::f32, plain_tag(nd));
+        auto mask_md = with_mask
+                ? memory::desc(p.mask_dims, dt::f32, plain_tag(nd))
+                : memory::desc();
+        memory::dims dst_dims = p.q_dims;
+        if (nd >= 2) dst_dims[nd - 1] = p.v_dims[nd - 1];
+        auto dst_md = memory::desc(dst_dims, dt::f32, memory::format_tag::any);
+
+        const float scale = nd >= 2 ? 1.f / std::sqrt((float)p.q_dims[nd - 1])
+                                    : 1.f;
+        const auto flags
+                = p.causal ? sdpa_flags::causal : sdpa_flags::none;
+
+        // default op desc ctor
+        auto op_desc = op_desc_t();
+        // regular op desc ctors
+        op_desc = with_mask
+                ? op_desc_t(prop_kind::forward_inference, q_md, k_md, v_md,
+                        mask_md, dst_md, scale, flags)
+                : op_desc_t(prop_kind::forward_inference, q_md, k_md, v_md,
+                        dst_md, scale, flags);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        ASSERT_NO_THROW(pd = pd_t(op_desc, eng));
+
+        // default primitive ctor
+        auto prim = sdpa_forward();
+        // regular primitive ctor
+        prim = sdpa_forward(pd);
+
+        ASSERT_TRUE(pd.queries_desc() == q_md);
+        ASSERT_TRUE(pd.keys_desc() == k_md);
+        ASSERT_TRUE(pd.values_desc() == v_md);
+        ASSERT_TRUE(pd.mask_desc() == mask_md);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == pd.dst_desc());
+
+        auto mem_q = test::make_memory(q_md, eng);
+        auto mem_k = test::make_memory(k_md, eng);
+        auto mem_v = test::make_memory(v_md, eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+        fill_data<float>(
+                q_md.get_size() / sizeof(float), mem_q, 0.f, 1.f);
+        fill_data<float>(
+                k_md.get_size() / sizeof(float), mem_k, 0.f, 1.f);
+        fill_data<float>(
+                v_md.get_size() / sizeof(float), mem_v, 0.f, 1.f);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, mem_q},
+                {DNNL_ARG_KEYS, mem_k}, {DNNL_ARG_VALUES, mem_v},
+                {DNNL_ARG_DST, mem_dst}};
+        memory mem_mask;
+        if (with_mask) {
+            mem_mask = test::make_memory(mask_md, eng);
+            fill_data<float>(
+                mask_md.get_size() / sizeof(float), mem_mask, 0.f, 1.f);
+            args.insert({DNNL_ARG_ATTN_MASK, mem_mask});
+        }
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto q = map_memory<float>(mem_q);
+        auto k = map_memory<float>(mem_k);
+        auto v = map_memory<float>(mem_v);
+        auto dst = map_memory<float>(mem_dst);
+        if (with_mask) {
+            auto mask = map_memory<float>(mem_mask);
+            check(q, k, v, mask, dst, scale);
+        } else {
+            check(q, k, v, nullptr, dst, scale);
+        }
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // inconsistent head sizes
+            sdpa_test_params_t {{2, 8, 16}, {2, 8, 8}, {2, 8, 16}, {},
+                    false, true, dnnl_invalid_arguments},
+            // inconsistent numbers of keys and values
+            sdpa_test_params_t {{2, 8, 16}, {2, 8, 16}, {2, 4, 16}, {},
+                    false, true, dnnl_invalid_arguments},
+            // inconsistent batches
+            sdpa_test_params_t {{2, 8, 16}, {1, 8, 16}, {1, 8, 16}, {},
+                    false, true, dnnl_invalid_arguments},
+            // mask of a wrong shape
+            sdpa_test_params_t {{2, 8, 16}, {2, 8, 16}, {2, 8, 16},
+                    {2, 4, 8}, false, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            sdpa_test_params_t {{1, 1, 16}, {1, 1, 16}, {1, 1, 16}, {}, false},
+            sdpa_test_params_t {{4, 16}, {7, 16}, {7, 8}, {}, false},
+            sdpa_test_params_t {{2, 3, 33, 64}, {2, 3, 77, 64},
+                    {2, 3, 77, 32}, {}, false},
+            sdpa_test_params_t {{2, 130, 32}, {2, 1030, 32}, {2, 1030, 32},
+                    {}, false});
+};
+
+static auto mask_cases = []() {
+    return ::testing::Values(
+            sdpa_test_params_t {{2, 17, 32}, {2, 40, 32}, {2, 40, 32},
+                    {2, 17, 40}, false},
+            // The mask is broadcast along the batch and the queries.
+            sdpa_test_params_t {{3, 17, 32}, {3, 40, 32}, {3, 40, 32},
+                    {1, 1, 40}, false},
+            sdpa_test_params_t {{2, 64, 32}, {2, 64, 32}, {2, 64, 32}, {},
+                    true},
+            // More queries than keys leave the first queries with all the
+            // keys masked out.
+            sdpa_test_params_t {{2, 70, 32}, {2, 50, 32}, {2, 50, 16}, {},
+                    true},
+            sdpa_test_params_t {{2, 33, 32}, {2, 600, 32}, {2, 600, 32},
+                    {1, 33, 600}, true});
+};
+
+TEST_P(sdpa_test_t, TestsSdpa) {}
+INSTANTIATE_TEST_SUITE_P(TestSdpaEF, sdpa_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestSdpaSimple, sdpa_test_t, simple_cases());
+INSTANTIATE_TEST_SUITE_P(TestSdpaMask, sdpa_test_t, mask_cases());
+
+} // namespace dnnl